@@ -0,0 +1,491 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/magister-stats-module.h"
+#include "ns3/network-module.h"
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Microbenchmark suite of the collectors, aggregators, and helpers of the
+ * module, meant for tracking performance regressions across releases. It
+ * measures:
+ *
+ * - the time per sample of every trace sink of DistributionCollector (with
+ *   adaptive and static bins), ScalarCollector, IntervalRateCollector, and
+ *   UnitConversionCollector;
+ * - the lines per second written by MultiFileAggregator in every file type,
+ *   with and without the `MemoryMapped` attribute, and by
+ *   MagisterGnuplotAggregator::Write2d();
+ * - the time taken by Install() of the throughput and delay helpers with
+ *   1000, 10000, and 100000 nodes (up to `MaxNodes`), each node having a
+ *   PacketSink application, so that the time includes creating the probes
+ *   and connecting them to the applications.
+ *
+ * The results are printed as a single JSON object, either to the standard
+ * output or to the file given by `JsonFile`. A measurement which is not a
+ * finite number, e.g., when the clock did not advance, is written as `null`. The files written by the
+ * aggregators and the helpers are placed in `OutputPath`.
+ *
+ * Example usage:
+ *
+ *     $ ./ns3 run "magister-stats-benchmark --NumOfSamples=1000000 --JsonFile=bench.json"
+ */
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("MagisterStatsBenchmark");
+
+/// The clock used for all measurements.
+typedef std::chrono::steady_clock Clock_t;
+
+/**
+ * @param start the start of the measurement.
+ * @return the seconds elapsed since start.
+ */
+static double
+GetElapsedSeconds(Clock_t::time_point start)
+{
+    return std::chrono::duration<double>(Clock_t::now() - start).count();
+}
+
+/**
+ * @brief Feed samples to a trace sink and measure the time per sample.
+ * @param sink invoked with every sample, normally a lambda calling a trace
+ *             sink of a collector.
+ * @param input the samples, used cyclically.
+ * @param numOfSamples the number of samples to feed.
+ * @return the time per sample, in nanoseconds.
+ */
+template <typename F>
+static double
+MeasureNsPerSample(F sink, const std::vector<double>& input, uint32_t numOfSamples)
+{
+    const uint32_t mask = input.size() - 1; // the size is a power of two
+    const Clock_t::time_point start = Clock_t::now();
+    for (uint32_t i = 0; i < numOfSamples; i++)
+    {
+        sink(input[i & mask]);
+    }
+    return GetElapsedSeconds(start) * 1e9 / numOfSamples;
+}
+
+/// Accumulates the entries of a JSON array of measurements.
+class JsonArray
+{
+  public:
+    /**
+     * @param str a string.
+     * @return the string as a JSON string literal, including the quotes.
+     */
+    static std::string Quote(const std::string& str)
+    {
+        std::ostringstream oss;
+        oss << '"';
+        for (const char c : str)
+        {
+            if (c == '"' || c == '\\')
+            {
+                oss << '\\' << c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                oss << "\\u00" << "0123456789abcdef"[c >> 4] << "0123456789abcdef"[c & 0xF];
+            }
+            else
+            {
+                oss << c;
+            }
+        }
+        oss << '"';
+        return oss.str();
+    }
+
+    /**
+     * @brief Add an entry to the array.
+     * @param name the name of the measurement.
+     * @param key the name of the measured quantity.
+     * @param value the measured value.
+     * @param extra additional members of the entry, already formatted as
+     *              `, "key": value` pairs.
+     */
+    void Add(std::string name, std::string key, double value, std::string extra = "")
+    {
+        std::ostringstream oss;
+        oss << "    {\"name\": " << Quote(name) << ", " << Quote(key) << ": ";
+        if (std::isfinite(value))
+        {
+            oss << value;
+        }
+        else
+        {
+            oss << "null"; // JSON has no infinity nor NaN
+        }
+        oss << extra << "}";
+        m_entries.push_back(oss.str());
+        NS_LOG_INFO(name << ": " << value << " " << key);
+    }
+
+    /**
+     * @return the array in JSON.
+     */
+    std::string ToString() const
+    {
+        std::string ret = "[\n";
+        for (uint32_t i = 0; i < m_entries.size(); i++)
+        {
+            ret += m_entries[i] + (i + 1 < m_entries.size() ? ",\n" : "\n");
+        }
+        return ret + "  ]";
+    }
+
+  private:
+    std::vector<std::string> m_entries; ///< The formatted entries.
+};
+
+/**
+ * @brief Measure the time per sample of a trace sink and add it to the results.
+ * @param results the array to add the result to.
+ * @param name the name of the measurement.
+ * @param input the samples, used cyclically.
+ * @param numOfSamples the number of samples to feed.
+ * @param sink invoked with every sample.
+ */
+template <typename F>
+static void
+Measure(JsonArray& results,
+        std::string name,
+        const std::vector<double>& input,
+        uint32_t numOfSamples,
+        F sink)
+{
+    results.Add(name, "nsPerSample", MeasureNsPerSample(sink, input, numOfSamples));
+}
+
+/**
+ * @brief Measure every trace sink of DistributionCollector with one bin type.
+ */
+static void
+BenchmarkDistributionCollector(DistributionCollector::DistributionBinType_t binType,
+                               const std::vector<double>& input,
+                               uint32_t numOfSamples,
+                               JsonArray& results)
+{
+    const std::string prefix =
+        "DistributionCollector/" + DistributionCollector::GetBinTypeName(binType) + "/";
+
+    // Every sink gets a fresh collector, so that the bins settle the same way.
+    std::vector<Ptr<DistributionCollector>> c(10);
+    for (uint32_t i = 0; i < c.size(); i++)
+    {
+        c[i] = CreateObject<DistributionCollector>();
+        c[i]->SetBinType(binType);
+        c[i]->SetSmallestSettlingValue(0.0);
+        c[i]->SetLargestSettlingValue(128.0);
+        c[i]->InitializeBins();
+    }
+
+    // clang-format off
+    Measure(results, prefix + "TraceSinkDouble1", input, numOfSamples,
+            [&](double v) { c[0]->TraceSinkDouble1(v); });
+    Measure(results, prefix + "TraceSinkDouble", input, numOfSamples,
+            [&](double v) { c[1]->TraceSinkDouble(0.0, v); });
+    Measure(results, prefix + "TraceSinkInteger8", input, numOfSamples,
+            [&](double v) { c[2]->TraceSinkInteger8(0, static_cast<int8_t>(v)); });
+    Measure(results, prefix + "TraceSinkInteger16", input, numOfSamples,
+            [&](double v) { c[3]->TraceSinkInteger16(0, static_cast<int16_t>(v)); });
+    Measure(results, prefix + "TraceSinkInteger32", input, numOfSamples,
+            [&](double v) { c[4]->TraceSinkInteger32(0, static_cast<int32_t>(v)); });
+    Measure(results, prefix + "TraceSinkInteger64", input, numOfSamples,
+            [&](double v) { c[5]->TraceSinkInteger64(0, static_cast<int64_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger8", input, numOfSamples,
+            [&](double v) { c[6]->TraceSinkUinteger8(0, static_cast<uint8_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger16", input, numOfSamples,
+            [&](double v) { c[7]->TraceSinkUinteger16(0, static_cast<uint16_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger32", input, numOfSamples,
+            [&](double v) { c[8]->TraceSinkUinteger32(0, static_cast<uint32_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger64", input, numOfSamples,
+            [&](double v) { c[9]->TraceSinkUinteger64(0, static_cast<uint64_t>(v)); });
+    // clang-format on
+}
+
+/**
+ * @brief Measure every trace sink of a collector which has a `InputDataType`
+ *        attribute, i.e., ScalarCollector or IntervalRateCollector.
+ */
+template <typename C>
+static void
+BenchmarkTypedCollector(std::string prefix,
+                        const std::vector<double>& input,
+                        uint32_t numOfSamples,
+                        JsonArray& results)
+{
+    Ptr<C> d = CreateObject<C>();
+    d->SetInputDataType(C::INPUT_DATA_TYPE_DOUBLE);
+    Ptr<C> u = CreateObject<C>();
+    u->SetInputDataType(C::INPUT_DATA_TYPE_UINTEGER);
+    Ptr<C> b = CreateObject<C>();
+    b->SetInputDataType(C::INPUT_DATA_TYPE_BOOLEAN);
+
+    // clang-format off
+    Measure(results, prefix + "TraceSinkDouble", input, numOfSamples,
+            [&](double v) { d->TraceSinkDouble(0.0, v); });
+    Measure(results, prefix + "TraceSinkUinteger8", input, numOfSamples,
+            [&](double v) { u->TraceSinkUinteger8(0, static_cast<uint8_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger16", input, numOfSamples,
+            [&](double v) { u->TraceSinkUinteger16(0, static_cast<uint16_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger32", input, numOfSamples,
+            [&](double v) { u->TraceSinkUinteger32(0, static_cast<uint32_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger64", input, numOfSamples,
+            [&](double v) { u->TraceSinkUinteger64(0, static_cast<uint64_t>(v)); });
+    Measure(results, prefix + "TraceSinkBoolean", input, numOfSamples,
+            [&](double v) { b->TraceSinkBoolean(false, v > 64.0); });
+    // clang-format on
+}
+
+/**
+ * @brief Measure every trace sink of UnitConversionCollector.
+ */
+static void
+BenchmarkUnitConversionCollector(const std::vector<double>& input,
+                                 uint32_t numOfSamples,
+                                 JsonArray& results)
+{
+    const std::string prefix = "UnitConversionCollector/";
+    Ptr<UnitConversionCollector> c = CreateObject<UnitConversionCollector>();
+    c->SetConversionType(UnitConversionCollector::FROM_BYTES_TO_KBIT);
+
+    // clang-format off
+    Measure(results, prefix + "TraceSinkDouble", input, numOfSamples,
+            [&](double v) { c->TraceSinkDouble(0.0, v); });
+    Measure(results, prefix + "TraceSinkInteger8", input, numOfSamples,
+            [&](double v) { c->TraceSinkInteger8(0, static_cast<int8_t>(v)); });
+    Measure(results, prefix + "TraceSinkInteger16", input, numOfSamples,
+            [&](double v) { c->TraceSinkInteger16(0, static_cast<int16_t>(v)); });
+    Measure(results, prefix + "TraceSinkInteger32", input, numOfSamples,
+            [&](double v) { c->TraceSinkInteger32(0, static_cast<int32_t>(v)); });
+    Measure(results, prefix + "TraceSinkInteger64", input, numOfSamples,
+            [&](double v) { c->TraceSinkInteger64(0, static_cast<int64_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger8", input, numOfSamples,
+            [&](double v) { c->TraceSinkUinteger8(0, static_cast<uint8_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger16", input, numOfSamples,
+            [&](double v) { c->TraceSinkUinteger16(0, static_cast<uint16_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger32", input, numOfSamples,
+            [&](double v) { c->TraceSinkUinteger32(0, static_cast<uint32_t>(v)); });
+    Measure(results, prefix + "TraceSinkUinteger64", input, numOfSamples,
+            [&](double v) { c->TraceSinkUinteger64(0, static_cast<uint64_t>(v)); });
+    // clang-format on
+}
+
+/**
+ * @brief Measure the lines per second written by the aggregators, including
+ *        flushing the files when the aggregators are disposed.
+ */
+static void
+BenchmarkAggregators(std::string outputPath,
+                     const std::vector<double>& input,
+                     uint32_t numOfLines,
+                     JsonArray& results)
+{
+    const uint32_t mask = input.size() - 1;
+    const MultiFileAggregator::FileType fileTypes[] = {MultiFileAggregator::FORMATTED,
+                                                       MultiFileAggregator::SPACE_SEPARATED,
+                                                       MultiFileAggregator::COMMA_SEPARATED,
+                                                       MultiFileAggregator::TAB_SEPARATED};
+    const char* fileTypeNames[] = {"FORMATTED",
+                                   "SPACE_SEPARATED",
+                                   "COMMA_SEPARATED",
+                                   "TAB_SEPARATED"};
+
+    for (uint32_t t = 0; t < 8; t++)
+    {
+        const bool isMemoryMapped = (t >= 4);
+        const std::string name =
+            std::string(fileTypeNames[t % 4]) + (isMemoryMapped ? "-MMAP" : "");
+
+        Ptr<MultiFileAggregator> aggregator = CreateObject<MultiFileAggregator>();
+        aggregator->SetAttribute("OutputFileName", StringValue(outputPath + "/benchmark-" + name));
+        aggregator->SetFileType(fileTypes[t % 4]);
+        aggregator->SetAttribute("MultiFileMode", BooleanValue(false));
+        aggregator->SetAttribute("MemoryMapped", BooleanValue(isMemoryMapped));
+
+        const Clock_t::time_point start = Clock_t::now();
+        for (uint32_t i = 0; i < numOfLines; i++)
+        {
+            aggregator->Write2d("0", i, input[i & mask]);
+        }
+        // Dispose() truncates the memory-mapped files, and the destructor
+        // writes the headings.
+        aggregator->Dispose();
+        aggregator = nullptr;
+        results.Add("MultiFileAggregator/" + name + "/Write2d",
+                    "linesPerSecond",
+                    numOfLines / GetElapsedSeconds(start));
+    }
+
+    Ptr<MagisterGnuplotAggregator> plot = CreateObject<MagisterGnuplotAggregator>();
+    plot->SetAttribute("OutputPath", StringValue(outputPath));
+    plot->SetAttribute("OutputFileName", StringValue("benchmark-gnuplot"));
+    plot->Add2dDataset("0", "0");
+
+    const Clock_t::time_point start = Clock_t::now();
+    for (uint32_t i = 0; i < numOfLines; i++)
+    {
+        plot->Write2d("0", i, input[i & mask]);
+    }
+    plot->Dispose();
+    results.Add("MagisterGnuplotAggregator/Write2d",
+                "linesPerSecond",
+                numOfLines / GetElapsedSeconds(start));
+}
+
+/**
+ * @brief Measure the time taken by Install() of a helper.
+ * @param nodes the nodes to install the helper on, each having at least one
+ *              application.
+ * @param identifierType the identifier type of the helper.
+ * @return the seconds taken by Install().
+ */
+template <typename H>
+static double
+MeasureInstall(NodeContainer nodes, StatsHelper::IdentifierType_t identifierType)
+{
+    Ptr<H> helper = CreateObject<H>();
+    helper->SetName("benchmark-install");
+    helper->SetIdentifierType(identifierType);
+    helper->SetOutputType(StatsHelper::OUTPUT_SCALAR_FILE);
+    helper->InstallNodes(nodes);
+
+    const Clock_t::time_point start = Clock_t::now();
+    helper->Install();
+    const double seconds = GetElapsedSeconds(start);
+
+    helper->Dispose();
+    return seconds;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numOfSamples = 1000000;
+    uint32_t numOfLines = 100000;
+    uint32_t maxNodes = 100000;
+    std::string outputPath = ".";
+    std::string jsonFile = "";
+
+    CommandLine cmd;
+    cmd.AddValue("NumOfSamples", "Number of samples fed to every trace sink.", numOfSamples);
+    cmd.AddValue("NumOfLines", "Number of lines written by every aggregator.", numOfLines);
+    cmd.AddValue("MaxNodes", "Largest number of nodes the helpers are installed on.", maxNodes);
+    cmd.AddValue("OutputPath", "Path of the files written by the aggregators.", outputPath);
+    cmd.AddValue("JsonFile", "File to write the results to (default: stdout).", jsonFile);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(numOfSamples == 0 || numOfLines == 0, "Nothing to measure");
+
+    // Samples in [0, 128), which fit into every integer type.
+    Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable>();
+    rng->SetAttribute("Min", DoubleValue(0.0));
+    rng->SetAttribute("Max", DoubleValue(128.0));
+    std::vector<double> input(1 << 16);
+    for (uint32_t i = 0; i < input.size(); i++)
+    {
+        input[i] = rng->GetValue();
+    }
+
+    JsonArray collectors;
+    BenchmarkDistributionCollector(DistributionCollector::BIN_TYPE_ADAPTIVE,
+                                   input,
+                                   numOfSamples,
+                                   collectors);
+    BenchmarkDistributionCollector(DistributionCollector::BIN_TYPE_STATIC,
+                                   input,
+                                   numOfSamples,
+                                   collectors);
+    BenchmarkTypedCollector<ScalarCollector>("ScalarCollector/", input, numOfSamples, collectors);
+    BenchmarkTypedCollector<IntervalRateCollector>("IntervalRateCollector/",
+                                                   input,
+                                                   numOfSamples,
+                                                   collectors);
+    BenchmarkUnitConversionCollector(input, numOfSamples, collectors);
+
+    JsonArray aggregators;
+    BenchmarkAggregators(outputPath, input, numOfLines, aggregators);
+
+    Config::SetDefault("ns3::StatsHelper::OutputPath", StringValue(outputPath));
+    JsonArray helpers;
+    for (uint32_t numOfNodes = 1000; numOfNodes <= maxNodes; numOfNodes *= 10)
+    {
+        NodeContainer nodes;
+        nodes.Create(numOfNodes);
+
+        // The applications are never started, so no socket is created.
+        PacketSinkHelper sinkHelper("ns3::UdpSocketFactory",
+                                    InetSocketAddress(Ipv4Address::GetAny(), 9));
+        sinkHelper.Install(nodes);
+        std::ostringstream extra;
+        extra << ", \"numOfNodes\": " << numOfNodes;
+
+        helpers.Add("StatsAppThroughputHelper/IDENTIFIER_NODE",
+                    "installSeconds",
+                    MeasureInstall<StatsAppThroughputHelper>(nodes, StatsHelper::IDENTIFIER_NODE),
+                    extra.str());
+        helpers.Add("StatsAppDelayHelper/IDENTIFIER_NODE",
+                    "installSeconds",
+                    MeasureInstall<StatsAppDelayHelper>(nodes, StatsHelper::IDENTIFIER_NODE),
+                    extra.str());
+        helpers.Add("StatsAppThroughputHelper/IDENTIFIER_GLOBAL",
+                    "installSeconds",
+                    MeasureInstall<StatsAppThroughputHelper>(nodes, StatsHelper::IDENTIFIER_GLOBAL),
+                    extra.str());
+    }
+
+    std::ostringstream json;
+    json << "{\n"
+         << "  \"benchmark\": \"magister-stats\",\n"
+         << "  \"numOfSamples\": " << numOfSamples << ",\n"
+         << "  \"numOfLines\": " << numOfLines << ",\n"
+         << "  \"collectors\": " << collectors.ToString() << ",\n"
+         << "  \"aggregators\": " << aggregators.ToString() << ",\n"
+         << "  \"helpers\": " << helpers.ToString() << "\n"
+         << "}\n";
+
+    if (jsonFile.empty())
+    {
+        std::cout << json.str();
+    }
+    else
+    {
+        std::ofstream ofs(jsonFile.c_str());
+        NS_ABORT_MSG_UNLESS(ofs.is_open(), "Unable to open " << jsonFile);
+        ofs << json.str();
+    }
+
+    Simulator::Destroy();
+    return 0;
+}
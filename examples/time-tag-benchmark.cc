@@ -0,0 +1,162 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#include "ns3/core-module.h"
+#include "ns3/magister-stats-module.h"
+#include "ns3/network-module.h"
+#include "ns3/traffic-time-tag.h"
+
+#include <chrono>
+#include <iostream>
+
+/**
+ * Microbenchmark of the TrafficTimeTag handling of the delay helpers, using
+ * packets which carry many other byte tags. Two ways are compared:
+ *
+ * - per helper: each of the delay helpers attaches its own TrafficTimeTag when
+ *   the packet is sent, and looks up the tag when the packet is received, like
+ *   the delay helpers did before they shared SharedAppProbe;
+ * - shared: the tag is attached once (unless already present) and looked up
+ *   once using SharedAppProbe::PeekTrafficTimeTag().
+ *
+ * The other byte tags are attached before the TrafficTimeTag, which is the
+ * worst case for the lookup, e.g., packets of a relay application.
+ *
+ * Both ways scan the byte tags linearly. The shared way saves the repeated
+ * tagging and scanning per helper, not the scan itself.
+ *
+ * Example usage:
+ *
+ *     $ ./ns3 run "time-tag-benchmark --NumOfTags=64 --NumOfHelpers=10"
+ */
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("TimeTagBenchmark");
+
+/**
+ * @param numOfTags the number of other byte tags to attach.
+ * @return a new packet carrying the given number of PhyTimeTag byte tags.
+ */
+static Ptr<Packet>
+CreateTaggedPacket(uint32_t numOfTags)
+{
+    Ptr<Packet> packet = Create<Packet>(1000);
+    for (uint32_t i = 0; i < numOfTags; i++)
+    {
+        packet->AddByteTag(PhyTimeTag(NanoSeconds(i)));
+    }
+    return packet;
+}
+
+/**
+ * @brief Look up the TrafficTimeTag like the delay helpers used to do.
+ * @param packet a packet.
+ * @param timeTag the tag found, if any.
+ * @return true if the packet has a TrafficTimeTag, otherwise false.
+ */
+static bool
+PeekPerHelper(Ptr<const Packet> packet, TrafficTimeTag& timeTag)
+{
+    ByteTagIterator it = packet->GetByteTagIterator();
+    while (it.HasNext())
+    {
+        ByteTagIterator::Item item = it.Next();
+        if (item.GetTypeId() == TrafficTimeTag::GetTypeId())
+        {
+            item.GetTag(timeTag);
+            return true;
+        }
+    }
+    return false;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numOfPackets = 100000;
+    uint32_t numOfTags = 64;
+    uint32_t numOfHelpers = 10;
+
+    CommandLine cmd;
+    cmd.AddValue("NumOfPackets", "Number of packets sent and received.", numOfPackets);
+    cmd.AddValue("NumOfTags", "Number of other byte tags in each packet.", numOfTags);
+    cmd.AddValue("NumOfHelpers", "Number of delay helpers monitoring the packets.", numOfHelpers);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(numOfPackets == 0 || numOfHelpers == 0, "Nothing to measure");
+
+    typedef std::chrono::steady_clock Clock_t;
+    TrafficTimeTag timeTag;
+    uint64_t numOfFound = 0;
+
+    // Creating the packets alone.
+    Clock_t::time_point start = Clock_t::now();
+    for (uint32_t p = 0; p < numOfPackets; p++)
+    {
+        Ptr<Packet> packet = CreateTaggedPacket(numOfTags);
+        numOfFound += packet->GetSize() > 0 ? 0 : 1;
+    }
+    const double baselineNs =
+        std::chrono::duration<double, std::nano>(Clock_t::now() - start).count() / numOfPackets;
+
+    // Every helper tags the packet and looks up the tag.
+    start = Clock_t::now();
+    for (uint32_t p = 0; p < numOfPackets; p++)
+    {
+        Ptr<Packet> packet = CreateTaggedPacket(numOfTags);
+        for (uint32_t h = 0; h < numOfHelpers; h++)
+        {
+            packet->AddByteTag(TrafficTimeTag(NanoSeconds(p)));
+        }
+        for (uint32_t h = 0; h < numOfHelpers; h++)
+        {
+            numOfFound += PeekPerHelper(packet, timeTag) ? 1 : 0;
+        }
+    }
+    const double perHelperNs =
+        std::chrono::duration<double, std::nano>(Clock_t::now() - start).count() / numOfPackets;
+
+    // The tag is attached and looked up once.
+    start = Clock_t::now();
+    for (uint32_t p = 0; p < numOfPackets; p++)
+    {
+        Ptr<Packet> packet = CreateTaggedPacket(numOfTags);
+        if (!SharedAppProbe::PeekTrafficTimeTag(packet, timeTag))
+        {
+            packet->AddByteTag(TrafficTimeTag(NanoSeconds(p)));
+        }
+        numOfFound += SharedAppProbe::PeekTrafficTimeTag(packet, timeTag) ? 1 : 0;
+    }
+    const double sharedNs =
+        std::chrono::duration<double, std::nano>(Clock_t::now() - start).count() / numOfPackets;
+
+    NS_ABORT_MSG_IF(numOfFound != static_cast<uint64_t>(numOfPackets) * (numOfHelpers + 1),
+                    "Missing TrafficTimeTag");
+
+    std::cout << numOfPackets << " packets with " << numOfTags << " other byte tags, "
+              << numOfHelpers << " delay helpers" << std::endl;
+    std::cout << "  packet creation only: " << baselineNs << " ns/packet" << std::endl;
+    std::cout << "  per helper:           " << perHelperNs - baselineNs << " ns/packet"
+              << std::endl;
+    std::cout << "  shared:               " << sharedNs - baselineNs << " ns/packet" << std::endl;
+
+    return 0;
+}
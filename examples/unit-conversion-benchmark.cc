@@ -0,0 +1,153 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/magister-stats-module.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Microbenchmark of the dB / dBm conversion of UnitConversionCollector. The
+ * per-sample path (one virtual Convert() call per sample) is compared against
+ * the batch conversion API with the exact and the approximate logarithm. The
+ * maximum absolute error of the approximate logarithm is reported as well.
+ *
+ * Example usage:
+ *
+ *     $ ./ns3 run "unit-conversion-benchmark --NumOfSamples=100000 --Dbm=1"
+ */
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("UnitConversionBenchmark");
+
+/// Exposes the per-sample conversion of UnitConversionCollector.
+class PerSampleConversion : public UnitConversionCollector
+{
+  public:
+    /**
+     * @param original the sample to convert.
+     * @return the converted sample.
+     */
+    double ConvertSample(double original) const
+    {
+        return Convert(original);
+    }
+};
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numOfSamples = 1 << 16;
+    uint32_t numOfRepetitions = 100;
+    bool isDbm = false;
+
+    CommandLine cmd;
+    cmd.AddValue("NumOfSamples", "Number of samples in each batch.", numOfSamples);
+    cmd.AddValue("NumOfRepetitions", "Number of times each batch is converted.", numOfRepetitions);
+    cmd.AddValue("Dbm", "Convert to dBm instead of dB.", isDbm);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(numOfSamples == 0 || numOfRepetitions == 0, "Nothing to convert");
+
+    const UnitConversionCollector::ConversionType_t conversionType =
+        isDbm ? UnitConversionCollector::FROM_LINEAR_TO_DBM
+              : UnitConversionCollector::FROM_LINEAR_TO_DB;
+
+    // Positive samples spread over twelve orders of magnitude.
+    Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable>();
+    rng->SetAttribute("Min", DoubleValue(-9.0));
+    rng->SetAttribute("Max", DoubleValue(3.0));
+    std::vector<double> input(numOfSamples);
+    for (uint32_t i = 0; i < numOfSamples; i++)
+    {
+        input[i] = std::pow(10.0, rng->GetValue());
+    }
+
+    std::vector<double> perSample(numOfSamples);
+    std::vector<double> exact(numOfSamples);
+    std::vector<double> approximate(numOfSamples);
+
+    Ptr<PerSampleConversion> collector = CreateObject<PerSampleConversion>();
+    collector->SetConversionType(conversionType);
+
+    typedef std::chrono::steady_clock Clock_t;
+    const double totalSamples = static_cast<double>(numOfSamples) * numOfRepetitions;
+
+    Clock_t::time_point start = Clock_t::now();
+    for (uint32_t r = 0; r < numOfRepetitions; r++)
+    {
+        for (uint32_t i = 0; i < numOfSamples; i++)
+        {
+            perSample[i] = collector->ConvertSample(input[i]);
+        }
+    }
+    const double perSampleNs =
+        std::chrono::duration<double, std::nano>(Clock_t::now() - start).count() / totalSamples;
+
+    start = Clock_t::now();
+    for (uint32_t r = 0; r < numOfRepetitions; r++)
+    {
+        UnitConversionCollector::ConvertBatch(conversionType,
+                                              input.data(),
+                                              exact.data(),
+                                              numOfSamples,
+                                              false);
+    }
+    const double exactNs =
+        std::chrono::duration<double, std::nano>(Clock_t::now() - start).count() / totalSamples;
+
+    start = Clock_t::now();
+    for (uint32_t r = 0; r < numOfRepetitions; r++)
+    {
+        UnitConversionCollector::ConvertBatch(conversionType,
+                                              input.data(),
+                                              approximate.data(),
+                                              numOfSamples,
+                                              true);
+    }
+    const double approximateNs =
+        std::chrono::duration<double, std::nano>(Clock_t::now() - start).count() / totalSamples;
+
+    double maxBatchDiff = 0.0;
+    double maxError = 0.0;
+    for (uint32_t i = 0; i < numOfSamples; i++)
+    {
+        maxBatchDiff = std::max(maxBatchDiff, std::fabs(exact[i] - perSample[i]));
+        maxError = std::max(maxError, std::fabs(approximate[i] - perSample[i]));
+    }
+
+    std::cout << UnitConversionCollector::GetConversionTypeName(conversionType) << ", "
+              << numOfSamples << " samples x " << numOfRepetitions << " repetitions"
+              << std::endl;
+    std::cout << "  per-sample Convert():       " << perSampleNs << " ns/sample" << std::endl;
+    std::cout << "  ConvertBatch (exact):       " << exactNs << " ns/sample"
+              << " (max difference " << maxBatchDiff << ")" << std::endl;
+    std::cout << "  ConvertBatch (approximate): " << approximateNs << " ns/sample"
+              << " (max error " << maxError << " "
+              << UnitConversionCollector::GetConversionUnitName(conversionType) << ")"
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,385 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#include "shared-app-probe.h"
+
+#include "ns3/application.h"
+#include "ns3/assert.h"
+#include "ns3/callback.h"
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/traffic-time-tag.h"
+
+NS_LOG_COMPONENT_DEFINE("SharedAppProbe");
+
+namespace ns3
+{
+
+NS_OBJECT_ENSURE_REGISTERED(SharedAppProbe);
+
+SharedAppProbe::SharedAppProbe(Ptr<Application> application)
+    : m_application(application),
+      m_hasRxTraceSource(false),
+      m_hasTxTraceSource(false),
+      m_isRxConnected(false),
+      m_isTxConnected(false),
+      m_numOfTimeTagRequests(0),
+      m_numOfSourceIdTagRequests(0),
+      m_sourceIdTag(),
+      m_hasSourceIdTag(false)
+{
+    NS_LOG_FUNCTION(this << application);
+    NS_ASSERT(application != nullptr);
+
+    // Find the index of the application within its node, for SourceIdTag.
+    Ptr<Node> node = application->GetNode();
+    if (node != nullptr && node->GetId() <= SourceIdTag::MAX_NODE_ID)
+    {
+        for (uint32_t i = 0; i < node->GetNApplications() && i < SourceIdTag::ANY_APPLICATION;
+             i++)
+        {
+            if (node->GetApplication(i) == application)
+            {
+                m_sourceIdTag.SetSource(node->GetId(), i);
+                m_hasSourceIdTag = true;
+                break;
+            }
+        }
+    }
+
+    if (!m_hasSourceIdTag)
+    {
+        NS_LOG_LOGIC(this << " packets of application " << application
+                          << " will not be tagged with SourceIdTag");
+    }
+
+    // The trace sources are connected later, when the first sink is connected.
+    const TypeId applicationTypeId = application->GetInstanceTypeId();
+    m_hasRxTraceSource = (applicationTypeId.LookupTraceSourceByName("Rx") != nullptr);
+    m_hasTxTraceSource = (applicationTypeId.LookupTraceSourceByName("Tx") != nullptr);
+}
+
+TypeId // static
+SharedAppProbe::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::SharedAppProbe")
+            .SetParent<Object>()
+            .AddTraceSource("Rx",
+                            "A packet received by the application.",
+                            MakeTraceSourceAccessor(&SharedAppProbe::m_rxTrace),
+                            "ns3::Packet::AddressTracedCallback")
+            .AddTraceSource("RxDelay",
+                            "The delay of a packet received by the application, "
+                            "computed from the TrafficTimeTag of the packet.",
+                            MakeTraceSourceAccessor(&SharedAppProbe::m_rxDelayTrace),
+                            "ns3::Application::DelayAddressCallback")
+            .AddTraceSource("Tx",
+                            "A packet transmitted by the application.",
+                            MakeTraceSourceAccessor(&SharedAppProbe::m_txTrace),
+                            "ns3::Packet::TracedCallback");
+    return tid;
+}
+
+void
+SharedAppProbe::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_application != nullptr)
+    {
+        if (m_isRxConnected)
+        {
+            m_application->TraceDisconnectWithoutContext(
+                "Rx",
+                MakeCallback(&SharedAppProbe::RxSink, this));
+        }
+
+        if (m_isTxConnected)
+        {
+            m_application->TraceDisconnectWithoutContext(
+                "Tx",
+                MakeCallback(&SharedAppProbe::TxSink, this));
+        }
+
+        m_application = nullptr;
+    }
+
+    m_isRxConnected = false;
+    m_isTxConnected = false;
+    Object::DoDispose();
+}
+
+Ptr<SharedAppProbe> // static
+SharedAppProbe::Get(Ptr<Application> application)
+{
+    NS_LOG_FUNCTION(application);
+    NS_ASSERT(application != nullptr);
+
+    std::map<Application*, Ptr<SharedAppProbe>>& registry = GetRegistry();
+    std::map<Application*, Ptr<SharedAppProbe>>::const_iterator it =
+        registry.find(PeekPointer(application));
+
+    if (it != registry.end())
+    {
+        return it->second;
+    }
+
+    if (registry.empty())
+    {
+        Simulator::ScheduleDestroy(&SharedAppProbe::ClearRegistry);
+    }
+
+    Ptr<SharedAppProbe> probe = CreateObject<SharedAppProbe>(application);
+    registry[PeekPointer(application)] = probe;
+    return probe;
+}
+
+uint32_t // static
+SharedAppProbe::GetNumOfProbes()
+{
+    return GetRegistry().size();
+}
+
+bool // static
+SharedAppProbe::PeekTrafficTimeTag(Ptr<const Packet> packet, TrafficTimeTag& timeTag)
+{
+    static const TypeId timeTagTypeId = TrafficTimeTag::GetTypeId();
+
+    ByteTagIterator it = packet->GetByteTagIterator();
+    while (it.HasNext())
+    {
+        ByteTagIterator::Item item = it.Next();
+        if (item.GetTypeId() == timeTagTypeId)
+        {
+            item.GetTag(timeTag);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Ptr<Application>
+SharedAppProbe::GetApplication() const
+{
+    return m_application;
+}
+
+bool
+SharedAppProbe::HasRxTraceSource() const
+{
+    return m_hasRxTraceSource;
+}
+
+bool
+SharedAppProbe::HasTxTraceSource() const
+{
+    return m_hasTxTraceSource;
+}
+
+bool
+SharedAppProbe::ConnectSink(std::string traceSourceName, const CallbackBase& callback)
+{
+    NS_LOG_FUNCTION(this << traceSourceName);
+
+    if (!TraceConnectWithoutContext(traceSourceName, callback))
+    {
+        return false;
+    }
+
+    UpdateConnections();
+    return true;
+}
+
+bool
+SharedAppProbe::DisconnectSink(std::string traceSourceName, const CallbackBase& callback)
+{
+    NS_LOG_FUNCTION(this << traceSourceName);
+
+    if (!TraceDisconnectWithoutContext(traceSourceName, callback))
+    {
+        return false;
+    }
+
+    UpdateConnections();
+    return true;
+}
+
+void
+SharedAppProbe::RequestTimeTag()
+{
+    NS_LOG_FUNCTION(this << m_numOfTimeTagRequests);
+    m_numOfTimeTagRequests++;
+    UpdateConnections();
+}
+
+void
+SharedAppProbe::ReleaseTimeTag()
+{
+    NS_LOG_FUNCTION(this << m_numOfTimeTagRequests);
+    NS_ASSERT_MSG(m_numOfTimeTagRequests > 0, "TrafficTimeTag has not been requested");
+    m_numOfTimeTagRequests--;
+    UpdateConnections();
+}
+
+void
+SharedAppProbe::RequestSourceIdTag()
+{
+    NS_LOG_FUNCTION(this << m_numOfSourceIdTagRequests);
+    m_numOfSourceIdTagRequests++;
+    UpdateConnections();
+}
+
+void
+SharedAppProbe::ReleaseSourceIdTag()
+{
+    NS_LOG_FUNCTION(this << m_numOfSourceIdTagRequests);
+    NS_ASSERT_MSG(m_numOfSourceIdTagRequests > 0, "SourceIdTag has not been requested");
+    m_numOfSourceIdTagRequests--;
+    UpdateConnections();
+}
+
+void
+SharedAppProbe::UpdateConnections()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_application == nullptr)
+    {
+        return; // Already disposed.
+    }
+
+    const bool isRxNeeded =
+        m_hasRxTraceSource && (!m_rxTrace.IsEmpty() || !m_rxDelayTrace.IsEmpty());
+    const bool isTxNeeded =
+        m_hasTxTraceSource && (!m_txTrace.IsEmpty() || m_numOfTimeTagRequests > 0 ||
+                               m_numOfSourceIdTagRequests > 0);
+
+    if (isRxNeeded != m_isRxConnected)
+    {
+        Callback<void, Ptr<const Packet>, const Address&> rxSink =
+            MakeCallback(&SharedAppProbe::RxSink, this);
+        if (isRxNeeded)
+        {
+            m_application->TraceConnectWithoutContext("Rx", rxSink);
+        }
+        else
+        {
+            m_application->TraceDisconnectWithoutContext("Rx", rxSink);
+        }
+        m_isRxConnected = isRxNeeded;
+        NS_LOG_INFO(this << (isRxNeeded ? " connected to" : " disconnected from")
+                         << " Rx of application " << m_application);
+    }
+
+    if (isTxNeeded != m_isTxConnected)
+    {
+        Callback<void, Ptr<const Packet>> txSink = MakeCallback(&SharedAppProbe::TxSink, this);
+        if (isTxNeeded)
+        {
+            m_application->TraceConnectWithoutContext("Tx", txSink);
+        }
+        else
+        {
+            m_application->TraceDisconnectWithoutContext("Tx", txSink);
+        }
+        m_isTxConnected = isTxNeeded;
+        NS_LOG_INFO(this << (isTxNeeded ? " connected to" : " disconnected from")
+                         << " Tx of application " << m_application);
+    }
+}
+
+void
+SharedAppProbe::RxSink(Ptr<const Packet> packet, const Address& from)
+{
+    // NS_LOG_FUNCTION (this << packet << from);
+
+    m_rxTrace(packet, from);
+
+    if (!m_rxDelayTrace.IsEmpty())
+    {
+        TrafficTimeTag timeTag;
+        if (PeekTrafficTimeTag(packet, timeTag))
+        {
+            m_rxDelayTrace(Simulator::Now() - timeTag.GetSenderTimestamp(), from);
+            return;
+        }
+
+        NS_LOG_WARN(this << " discarding a packet of " << packet->GetSize()
+                         << " bytes from delay statistics"
+                         << " because it does not contain any TrafficTimeTag");
+    }
+}
+
+void
+SharedAppProbe::TxSink(Ptr<const Packet> packet)
+{
+    // NS_LOG_FUNCTION (this << packet);
+
+    if (m_numOfTimeTagRequests > 0)
+    {
+        TrafficTimeTag existingTag;
+        if (!PeekTrafficTimeTag(packet, existingTag))
+        {
+            TrafficTimeTag timeTag(Simulator::Now());
+            packet->AddByteTag(timeTag);
+        }
+    }
+
+    if (m_numOfSourceIdTagRequests > 0 && m_hasSourceIdTag)
+    {
+        // A forwarded packet keeps the tag of its original sender.
+        SourceIdTag existingTag;
+        if (!packet->PeekPacketTag(existingTag))
+        {
+            packet->AddPacketTag(m_sourceIdTag);
+        }
+    }
+
+    m_txTrace(packet);
+}
+
+std::map<Application*, Ptr<SharedAppProbe>>& // static
+SharedAppProbe::GetRegistry()
+{
+    static std::map<Application*, Ptr<SharedAppProbe>> registry;
+    return registry;
+}
+
+void // static
+SharedAppProbe::ClearRegistry()
+{
+    NS_LOG_FUNCTION_NOARGS();
+
+    std::map<Application*, Ptr<SharedAppProbe>>& registry = GetRegistry();
+
+    for (std::map<Application*, Ptr<SharedAppProbe>>::iterator it = registry.begin();
+         it != registry.end();
+         ++it)
+    {
+        it->second->Dispose();
+    }
+
+    registry.clear();
+}
+
+} // end of namespace ns3
@@ -0,0 +1,250 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#ifndef SHARED_APP_PROBE_H
+#define SHARED_APP_PROBE_H
+
+#include "ns3/address.h"
+#include "ns3/callback.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/packet.h"
+#include "ns3/ptr.h"
+#include "ns3/source-id-tag.h"
+#include "ns3/traced-callback.h"
+
+#include <map>
+#include <stdint.h>
+#include <string>
+
+namespace ns3
+{
+
+class Application;
+class TrafficTimeTag;
+
+/**
+ * @ingroup stats
+ * @brief Single listener of the `Rx` and `Tx` trace sources of an
+ *        application, shared by every statistics helper interested in it.
+ *
+ * When several helpers monitor the same application, connecting each of them
+ * to the application's trace sources multiplies the callbacks invoked for
+ * every packet, and the per-packet work (e.g., looking up the TrafficTimeTag)
+ * is repeated by each of them. Instead, Get() returns the one instance
+ * registered for the application, and the helpers connect to the trace
+ * sources of this instance with ConnectSink().
+ *
+ * The instance is connected to the application's `Rx` trace source only while
+ * at least one sink is connected to its `Rx` or `RxDelay` trace sources, and
+ * to the application's `Tx` trace source only while at least one sink is
+ * connected to its `Tx` trace source or a tag is requested. Hence, an
+ * application whose helpers are all disabled (see StatsHelper::SetEnabled())
+ * invokes no callback of this instance.
+ *
+ * The `RxDelay` trace source fires with the delay computed from the
+ * TrafficTimeTag of the received packet. The tag is only looked up while at
+ * least one sink is connected to `RxDelay`.
+ *
+ * RequestTimeTag() asks for a TrafficTimeTag to be attached to every packet
+ * transmitted by the application. The tag is attached once per packet,
+ * regardless of the number of helpers, and only while at least one request
+ * has not been released by ReleaseTimeTag(). A packet which already has a
+ * TrafficTimeTag (e.g., a packet forwarded by a relay application) keeps its
+ * original tag. Hence, disabling every delay helper (see
+ * StatsHelper::SetEnabled()) also stops the tagging.
+ *
+ * Likewise, RequestSourceIdTag() asks for a SourceIdTag packet tag carrying
+ * the node ID and the index of the application to be attached, for the
+ * helpers which identify the received packets by their sender (see
+ * StatsHelper::SetIdentifyBySender()).
+ *
+ * The registry is emptied when the simulator is destroyed.
+ */
+class SharedAppProbe : public Object
+{
+  public:
+    /**
+     * @brief Creates a new instance connected to the given application. Use
+     *        Get() instead, to share the instance with other helpers.
+     * @param application the application to listen to.
+     */
+    SharedAppProbe(Ptr<Application> application);
+
+    // inherited from ObjectBase base class
+    static TypeId GetTypeId();
+
+    /**
+     * @param application an application.
+     * @return the instance registered for the application, created on the
+     *         first call.
+     */
+    static Ptr<SharedAppProbe> Get(Ptr<Application> application);
+
+    /**
+     * @return the number of instances in the registry.
+     */
+    static uint32_t GetNumOfProbes();
+
+    /**
+     * @brief Find the TrafficTimeTag of a packet.
+     * @param packet a packet.
+     * @param timeTag the tag found, if any.
+     * @return true if the packet has a TrafficTimeTag, otherwise false.
+     *
+     * The byte tags are visited in the order they were added, and the search
+     * stops at the first TrafficTimeTag, so the lookup takes time linear in
+     * the number of byte tags of the packet. The TypeId of the tag is looked
+     * up once, not for every visited tag.
+     *
+     * There is no constant-time lookup. It would need a packet tag, which is
+     * lost when TCP segments and reassembles the payload.
+     */
+    static bool PeekTrafficTimeTag(Ptr<const Packet> packet, TrafficTimeTag& timeTag);
+
+    /**
+     * @return the application this instance listens to.
+     */
+    Ptr<Application> GetApplication() const;
+
+    /**
+     * @return true if the application has an `Rx` trace source.
+     */
+    bool HasRxTraceSource() const;
+
+    /**
+     * @return true if the application has a `Tx` trace source.
+     */
+    bool HasTxTraceSource() const;
+
+    /**
+     * @brief Connect a trace sink to a trace source of this instance, and
+     *        connect this instance to the application if needed.
+     * @param traceSourceName the name of the trace source.
+     * @param callback the trace sink.
+     * @return true if this instance has the given trace source, otherwise
+     *         false.
+     *
+     * Use this method instead of `TraceConnectWithoutContext`, which does not
+     * connect this instance to the application.
+     */
+    bool ConnectSink(std::string traceSourceName, const CallbackBase& callback);
+
+    /**
+     * @brief Disconnect a trace sink connected by ConnectSink(), and
+     *        disconnect this instance from the application if it was the last
+     *        one.
+     * @param traceSourceName the name of the trace source.
+     * @param callback the trace sink.
+     * @return true if this instance has the given trace source, otherwise
+     *         false.
+     */
+    bool DisconnectSink(std::string traceSourceName, const CallbackBase& callback);
+
+    /**
+     * @brief Start attaching a TrafficTimeTag to the transmitted packets.
+     *
+     * Requests are counted, and every request must be released by
+     * ReleaseTimeTag().
+     */
+    void RequestTimeTag();
+
+    /**
+     * @brief Release a request made by RequestTimeTag().
+     */
+    void ReleaseTimeTag();
+
+    /**
+     * @brief Start attaching a SourceIdTag to the transmitted packets.
+     *
+     * Requests are counted, and every request must be released by
+     * ReleaseSourceIdTag().
+     */
+    void RequestSourceIdTag();
+
+    /**
+     * @brief Release a request made by RequestSourceIdTag().
+     */
+    void ReleaseSourceIdTag();
+
+  protected:
+    // Inherited from Object base class
+    virtual void DoDispose();
+
+  private:
+    /**
+     * @brief Connect to, or disconnect from, the application's `Rx` and `Tx`
+     *        trace sources, depending on whether they are needed.
+     */
+    void UpdateConnections();
+
+    /**
+     * @brief Trace sink for the application's `Rx` trace source.
+     * @param packet the received packet.
+     * @param from the address of the sender of the packet.
+     */
+    void RxSink(Ptr<const Packet> packet, const Address& from);
+
+    /**
+     * @brief Trace sink for the application's `Tx` trace source.
+     * @param packet the transmitted packet.
+     */
+    void TxSink(Ptr<const Packet> packet);
+
+    /**
+     * @return the registry of instances, indexed by application.
+     */
+    static std::map<Application*, Ptr<SharedAppProbe>>& GetRegistry();
+
+    /// Dispose every instance in the registry and empty it.
+    static void ClearRegistry();
+
+    Ptr<Application> m_application; ///< The application this instance listens to.
+    bool m_hasRxTraceSource;        ///< Whether the application has an `Rx` trace source.
+    bool m_hasTxTraceSource;        ///< Whether the application has a `Tx` trace source.
+    bool m_isRxConnected;           ///< Whether the `Rx` trace source is connected.
+    bool m_isTxConnected;           ///< Whether the `Tx` trace source is connected.
+
+    /// `Rx` trace source.
+    TracedCallback<Ptr<const Packet>, const Address&> m_rxTrace;
+
+    /// `RxDelay` trace source.
+    TracedCallback<const Time&, const Address&> m_rxDelayTrace;
+
+    /// `Tx` trace source.
+    TracedCallback<Ptr<const Packet>> m_txTrace;
+
+    /// Number of unreleased requests made by RequestTimeTag().
+    uint32_t m_numOfTimeTagRequests;
+
+    /// Number of unreleased requests made by RequestSourceIdTag().
+    uint32_t m_numOfSourceIdTagRequests;
+
+    /// The tag attached to the transmitted packets, see #m_hasSourceIdTag.
+    SourceIdTag m_sourceIdTag;
+
+    /// Whether the node ID and the application index fit in #m_sourceIdTag.
+    bool m_hasSourceIdTag;
+
+}; // end of class SharedAppProbe
+
+} // end of namespace ns3
+
+#endif /* SHARED_APP_PROBE_H */
@@ -0,0 +1,314 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#include "stats-checkpoint-helper.h"
+
+#include "stats-helper.h"
+
+#include "ns3/abort.h"
+#include "ns3/buffer.h"
+#include "ns3/collector-state.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+NS_LOG_COMPONENT_DEFINE("StatsCheckpointHelper");
+
+namespace ns3
+{
+
+NS_OBJECT_ENSURE_REGISTERED(StatsCheckpointHelper);
+
+StatsCheckpointHelper::StatsCheckpointHelper()
+    : m_fileName("stats-checkpoint.bin"),
+      m_interval(Seconds(0)),
+      m_isWritten(true)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+StatsCheckpointHelper::~StatsCheckpointHelper()
+{
+    NS_LOG_FUNCTION(this);
+    JoinWriter();
+}
+
+TypeId // static
+StatsCheckpointHelper::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::StatsCheckpointHelper")
+            .SetParent<Object>()
+            .AddConstructor<StatsCheckpointHelper>()
+            .AddAttribute("FileName",
+                          "The name of the snapshot file.",
+                          StringValue("stats-checkpoint.bin"),
+                          MakeStringAccessor(&StatsCheckpointHelper::SetFileName,
+                                             &StatsCheckpointHelper::GetFileName),
+                          MakeStringChecker())
+            .AddAttribute("Interval",
+                          "If non-zero, a snapshot is saved with this interval.",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&StatsCheckpointHelper::SetInterval,
+                                           &StatsCheckpointHelper::GetInterval),
+                          MakeTimeChecker());
+    return tid;
+}
+
+void
+StatsCheckpointHelper::SetFileName(std::string fileName)
+{
+    NS_LOG_FUNCTION(this << fileName);
+    m_fileName = fileName;
+}
+
+std::string
+StatsCheckpointHelper::GetFileName() const
+{
+    return m_fileName;
+}
+
+void
+StatsCheckpointHelper::SetInterval(Time interval)
+{
+    NS_LOG_FUNCTION(this << interval.GetSeconds());
+    m_interval = interval;
+    m_nextSave.Cancel();
+
+    if (m_interval > Seconds(0))
+    {
+        m_nextSave = Simulator::Schedule(m_interval, &StatsCheckpointHelper::PeriodicSave, this);
+    }
+}
+
+Time
+StatsCheckpointHelper::GetInterval() const
+{
+    return m_interval;
+}
+
+void
+StatsCheckpointHelper::AddHelper(Ptr<StatsHelper> helper)
+{
+    NS_LOG_FUNCTION(this << helper);
+    NS_ASSERT(helper != nullptr);
+
+    for (const Ptr<StatsHelper>& h : m_helpers)
+    {
+        if (h->GetName() == helper->GetName())
+        {
+            NS_FATAL_ERROR("A helper named " << helper->GetName() << " has already been added");
+        }
+    }
+
+    m_helpers.push_back(helper);
+}
+
+void
+StatsCheckpointHelper::Save()
+{
+    NS_LOG_FUNCTION(this);
+
+    uint32_t size = 4 + 4 + 8 + 4;
+    for (const Ptr<StatsHelper>& helper : m_helpers)
+    {
+        size += CollectorState::GetStringSize(helper->GetName()) + 4 +
+                helper->GetSerializedStateSize();
+    }
+
+    Buffer buffer;
+    buffer.AddAtStart(size);
+    Buffer::Iterator i = buffer.Begin();
+    i.WriteHtonU32(MAGIC);
+    i.WriteU32(VERSION);
+    CollectorState::WriteTime(i, Simulator::Now());
+    i.WriteU32(m_helpers.size());
+
+    for (const Ptr<StatsHelper>& helper : m_helpers)
+    {
+        const uint32_t helperSize = helper->GetSerializedStateSize();
+        CollectorState::WriteString(i, helper->GetName());
+        i.WriteU32(helperSize);
+        helper->SerializeState(i);
+        i.Next(helperSize);
+    }
+
+    std::vector<uint8_t> data(size);
+    buffer.CopyData(data.data(), size);
+
+    // Only the writing of the file is left to the background thread.
+    JoinWriter();
+    m_isWritten = false;
+    m_writerFileName = m_fileName;
+    m_writer = std::thread(&StatsCheckpointHelper::WriteFile,
+                           m_fileName,
+                           std::move(data),
+                           &m_isWritten);
+    NS_LOG_INFO(this << " saving a snapshot of " << size << " bytes to " << m_fileName);
+}
+
+void
+StatsCheckpointHelper::Restore()
+{
+    NS_LOG_FUNCTION(this);
+
+    // The file may still be written by Save().
+    JoinWriter();
+
+    std::ifstream ifs(m_fileName, std::ios::in | std::ios::binary);
+    if (!ifs || !(ifs.is_open()))
+    {
+        NS_FATAL_ERROR("Error reading file " << m_fileName);
+    }
+
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(ifs)),
+                                    std::istreambuf_iterator<char>());
+    ifs.close();
+
+    if (data.size() < 4 + 4 + 8 + 4)
+    {
+        NS_FATAL_ERROR("File " << m_fileName << " is not a statistics snapshot");
+    }
+
+    Buffer buffer;
+    buffer.AddAtStart(data.size());
+    Buffer::Iterator i = buffer.Begin();
+    i.Write(data.data(), data.size());
+    i = buffer.Begin();
+
+    if (i.ReadNtohU32() != MAGIC)
+    {
+        NS_FATAL_ERROR("File " << m_fileName << " is not a statistics snapshot");
+    }
+
+    const uint32_t version = i.ReadU32();
+    if (version != VERSION)
+    {
+        NS_FATAL_ERROR("File " << m_fileName << " has an unsupported version " << version);
+    }
+
+    const Time time = CollectorState::ReadTime(i);
+    if (time != Simulator::Now())
+    {
+        NS_LOG_WARN(this << " restoring a snapshot taken at " << time.GetSeconds()
+                         << " at time " << Simulator::Now().GetSeconds());
+    }
+
+    uint32_t numOfRestored = 0;
+    for (uint32_t n = i.ReadU32(); n > 0; n--)
+    {
+        // Check the lengths of the record against the file before reading it.
+        NS_ABORT_MSG_IF(i.GetRemainingSize() < 4, "File " << m_fileName << " is truncated");
+        Buffer::Iterator j = i;
+        const uint64_t nameSize = j.ReadU32();
+        NS_ABORT_MSG_IF(i.GetRemainingSize() < 4 + nameSize + 4,
+                        "File " << m_fileName << " is truncated");
+
+        const std::string name = CollectorState::ReadString(i);
+        const uint32_t helperSize = i.ReadU32();
+        NS_ABORT_MSG_IF(i.GetRemainingSize() < helperSize,
+                        "File " << m_fileName << " is truncated in the saved state of helper "
+                                << name);
+        Ptr<StatsHelper> helper;
+
+        for (const Ptr<StatsHelper>& h : m_helpers)
+        {
+            if (h->GetName() == name)
+            {
+                helper = h;
+                break;
+            }
+        }
+
+        if (helper == nullptr)
+        {
+            NS_LOG_WARN(this << " skipping the saved state of unknown helper " << name);
+        }
+        else
+        {
+            const uint32_t read = helper->DeserializeState(i);
+            NS_ABORT_MSG_IF(read != helperSize,
+                            "Read " << read << " bytes of the saved state of helper " << name
+                                    << " instead of " << helperSize);
+            numOfRestored++;
+        }
+
+        i.Next(helperSize);
+    }
+
+    if (numOfRestored < m_helpers.size())
+    {
+        NS_LOG_WARN(this << " the snapshot has no state for "
+                         << m_helpers.size() - numOfRestored << " helpers");
+    }
+
+    NS_LOG_INFO(this << " restored " << numOfRestored << " helpers from " << m_fileName);
+}
+
+void
+StatsCheckpointHelper::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_nextSave.Cancel();
+    JoinWriter();
+    m_helpers.clear();
+    Object::DoDispose();
+}
+
+void // static
+StatsCheckpointHelper::WriteFile(std::string fileName, std::vector<uint8_t> data, bool* isWritten)
+{
+    const std::string tempFileName = fileName + ".temp";
+    std::ofstream ofs(tempFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    ofs.write(reinterpret_cast<const char*>(data.data()), data.size());
+    ofs.close();
+
+    // The failure is reported by JoinWriter(), in the thread of the simulator.
+    *isWritten = ofs && (std::rename(tempFileName.c_str(), fileName.c_str()) == 0);
+}
+
+void
+StatsCheckpointHelper::JoinWriter()
+{
+    if (m_writer.joinable())
+    {
+        m_writer.join();
+
+        if (!m_isWritten)
+        {
+            NS_FATAL_ERROR("Error writing file " << m_writerFileName);
+        }
+    }
+}
+
+void
+StatsCheckpointHelper::PeriodicSave()
+{
+    NS_LOG_FUNCTION(this);
+    Save();
+    m_nextSave = Simulator::Schedule(m_interval, &StatsCheckpointHelper::PeriodicSave, this);
+}
+
+} // end of namespace ns3
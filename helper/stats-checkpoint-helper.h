@@ -0,0 +1,173 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#ifndef STATS_CHECKPOINT_HELPER_H
+#define STATS_CHECKPOINT_HELPER_H
+
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ns3
+{
+
+class StatsHelper;
+
+/**
+ * @ingroup stats
+ * @brief Saving the state of statistics helpers into a snapshot file, and
+ *        restoring it into freshly installed helpers.
+ *
+ * The snapshot holds, for every helper added with AddHelper(), the state of
+ * the collectors and aggregators it has created, see
+ * StatsHelper::SerializeState() and CollectorState. It is a compact binary
+ * file made of a header (the `MSCK` magic, a format version, and the
+ * simulation time of the snapshot) and one record per helper, identified by
+ * the name of the helper.
+ *
+ * Save() takes the snapshot in memory and leaves writing it to the file to a
+ * background thread, so that the event loop is only stalled for the time of
+ * copying the state. The file is first written under a temporary name and
+ * then renamed, so that a crash while writing does not corrupt the previous
+ * snapshot. Setting the `Interval` attribute saves a snapshot periodically.
+ *
+ * Restore() reads the snapshot and restores the state of every helper added
+ * with AddHelper() which has a record in it. The helpers must have been
+ * configured and installed in the same way as the helpers the snapshot was
+ * taken from. Since the saved times are absolute simulation times, Restore()
+ * is intended to be invoked at the simulation time of the snapshot.
+ */
+class StatsCheckpointHelper : public Object
+{
+  public:
+    /// Creates a new helper instance.
+    StatsCheckpointHelper();
+
+    /// Destructor.
+    virtual ~StatsCheckpointHelper();
+
+    // inherited from ObjectBase base class
+    static TypeId GetTypeId();
+
+    /**
+     * @param fileName the name of the snapshot file.
+     */
+    void SetFileName(std::string fileName);
+
+    /**
+     * @return the name of the snapshot file.
+     */
+    std::string GetFileName() const;
+
+    /**
+     * @param interval the interval of saving the snapshot periodically, or
+     *                 zero to disable it.
+     */
+    void SetInterval(Time interval);
+
+    /**
+     * @return the interval of saving the snapshot periodically.
+     */
+    Time GetInterval() const;
+
+    /**
+     * @brief Add a helper whose state is saved and restored.
+     * @param helper a statistics helper, whose name is unique among the
+     *               helpers added to this instance.
+     */
+    void AddHelper(Ptr<StatsHelper> helper);
+
+    /**
+     * @brief Take a snapshot of the state of the helpers and write it to the
+     *        file in the background.
+     *
+     * A snapshot still being written by the previous call is completed first.
+     * A failure to write the file is reported when the writing is completed,
+     * i.e., by the next Save() or Restore(), or when this instance is
+     * disposed.
+     */
+    void Save();
+
+    /**
+     * @brief Read the snapshot from the file and restore the state of the
+     *        helpers.
+     *
+     * The simulation is aborted if the file is truncated or does not match
+     * the helpers.
+     */
+    void Restore();
+
+  protected:
+    // Inherited from Object base class
+    virtual void DoDispose();
+
+  private:
+    /**
+     * @brief Write a snapshot to a file, through a temporary file.
+     * @param fileName the name of the file.
+     * @param data the snapshot.
+     * @param isWritten set to whether the file has been written.
+     *
+     * Runs in the background thread.
+     */
+    static void WriteFile(std::string fileName, std::vector<uint8_t> data, bool* isWritten);
+
+    /**
+     * @brief Wait until the snapshot being written in the background is
+     *        complete, and stop the simulation if it could not be written.
+     */
+    void JoinWriter();
+
+    /// Save the snapshot and schedule the next one.
+    void PeriodicSave();
+
+    std::string m_fileName; ///< `FileName` attribute.
+    Time m_interval;        ///< `Interval` attribute.
+    EventId m_nextSave;     ///< The next periodic saving.
+
+    /// The helpers whose state is saved and restored.
+    std::vector<Ptr<StatsHelper>> m_helpers;
+
+    /// The thread writing the last snapshot.
+    std::thread m_writer;
+
+    /// The file written by #m_writer.
+    std::string m_writerFileName;
+
+    /// Whether #m_writer has written its file, read after it is joined.
+    bool m_isWritten;
+
+    /// The magic number at the start of a snapshot file.
+    static const uint32_t MAGIC = 0x4d53434b; // "MSCK"
+
+    /// The version of the format of the snapshot file.
+    static const uint32_t VERSION = 1;
+
+}; // end of class StatsCheckpointHelper
+
+} // end of namespace ns3
+
+#endif /* STATS_CHECKPOINT_HELPER_H */
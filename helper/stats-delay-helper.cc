@@ -25,6 +25,7 @@
 #include "ns3/application.h"
 #include "ns3/boolean.h"
 #include "ns3/callback.h"
+#include "ns3/collector-state.h"
 #include "ns3/data-collection-object.h"
 #include "ns3/distribution-collector.h"
 #include "ns3/enum.h"
@@ -33,6 +34,7 @@
 #include "ns3/log.h"
 #include "ns3/mac48-address.h"
 #include "ns3/magister-gnuplot-aggregator.h"
+#include "ns3/memory-usage.h"
 #include "ns3/multi-file-aggregator.h"
 #include "ns3/net-device.h"
 #include "ns3/node-container.h"
@@ -40,7 +42,9 @@
 #include "ns3/packet.h"
 #include "ns3/probe.h"
 #include "ns3/scalar-collector.h"
+#include "ns3/shared-app-probe.h"
 #include "ns3/singleton.h"
+#include "ns3/source-id-tag.h"
 #include "ns3/string.h"
 #include "ns3/traffic-time-tag.h"
 #include "ns3/unit-conversion-collector.h"
@@ -96,6 +100,48 @@ StatsDelayHelper::GetAveragingMode() const
     return m_averagingMode;
 }
 
+uint64_t
+StatsDelayHelper::DoGetMemoryUsage() const
+{
+    uint64_t usage = sizeof(StatsDelayHelper) - sizeof(StatsHelper);
+    usage += m_terminalCollectors.GetMemoryUsage();
+    usage += MemoryUsage::GetObjectUsage(m_averagingCollector);
+    usage += MemoryUsage::GetObjectUsage(m_aggregator);
+    usage += m_identifierMap.GetMemoryUsage();
+    usage += MemoryUsage::GetVectorUsage(m_collectorTable);
+    return usage;
+}
+
+uint32_t
+StatsDelayHelper::DoGetSerializedStateSize() const
+{
+    return m_terminalCollectors.GetSerializedStateSize() +
+           CollectorState::GetSerializedSize(m_averagingCollector) +
+           CollectorState::GetSerializedSize(m_aggregator);
+}
+
+void
+StatsDelayHelper::DoSerializeState(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    m_terminalCollectors.SerializeState(i);
+    i.Next(m_terminalCollectors.GetSerializedStateSize());
+    CollectorState::Serialize(m_averagingCollector, i);
+    i.Next(CollectorState::GetSerializedSize(m_averagingCollector));
+    CollectorState::Serialize(m_aggregator, i);
+}
+
+uint32_t
+StatsDelayHelper::DoDeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this);
+    Buffer::Iterator i = start;
+    i.Next(m_terminalCollectors.DeserializeState(i));
+    i.Next(CollectorState::Deserialize(m_averagingCollector, i));
+    i.Next(CollectorState::Deserialize(m_aggregator, i));
+    return i.GetDistanceFrom(start);
+}
+
 void
 StatsDelayHelper::DoInstall()
 {
@@ -397,9 +443,25 @@ StatsDelayHelper::DoInstall()
         break;
     }
 
+    // Index the collectors for PassSampleToCollector().
+    m_collectorTable.clear();
+    for (CollectorMap::Iterator it = m_terminalCollectors.Begin();
+         it != m_terminalCollectors.End();
+         ++it)
+    {
+        if (it->first >= m_collectorTable.size())
+        {
+            m_collectorTable.resize(it->first + 1);
+        }
+        m_collectorTable[it->first] = it->second;
+    }
+
     // Setup probes and connect them to the collectors.
     InstallProbes();
 
+    // Let the steady-state controller monitor the collectors, if requested.
+    ConnectCollectorsToSteadyStateController(m_terminalCollectors);
+
 } // end of `void DoInstall ();`
 
 void
@@ -480,8 +542,9 @@ StatsDelayHelper::PassSampleToCollector(Time delay, uint32_t identifier)
 {
     // NS_LOG_FUNCTION (this << delay.GetSeconds () << identifier);
 
-    Ptr<DataCollectionObject> collector = m_terminalCollectors.Get(identifier);
-    NS_ASSERT_MSG(collector != nullptr, "Unable to find collector with identifier " << identifier);
+    NS_ASSERT_MSG(identifier < m_collectorTable.size() && m_collectorTable[identifier] != nullptr,
+                  "Unable to find collector with identifier " << identifier);
+    Ptr<DataCollectionObject> collector = m_collectorTable[identifier];
 
     switch (GetOutputType())
     {
@@ -552,6 +615,21 @@ StatsAppDelayHelper::GetTypeId()
     return tid;
 }
 
+uint64_t
+StatsAppDelayHelper::DoGetMemoryUsage() const
+{
+    uint64_t usage = StatsDelayHelper::DoGetMemoryUsage();
+    usage += sizeof(StatsAppDelayHelper) - sizeof(StatsDelayHelper);
+    usage += MemoryUsage::GetListUsage(m_probes.size(), sizeof(Ptr<Probe>));
+
+    for (const Ptr<Probe>& probe : m_probes)
+    {
+        usage += MemoryUsage::GetObjectUsage(probe);
+    }
+
+    return usage;
+}
+
 void
 StatsAppDelayHelper::DoInstallProbes()
 {
@@ -561,40 +639,69 @@ StatsAppDelayHelper::DoInstallProbes()
     for (NodeContainer::Iterator it = nodes.Begin(); it != nodes.End(); ++it)
     {
         const int32_t id = (*it)->GetId();
-        uint32_t identifier = 0;
-        if (GetIdentifierType() == StatsHelper::IDENTIFIER_NODE)
-        {
-            identifier = id;
-        }
 
         for (uint32_t i = 0; i < (*it)->GetNApplications(); i++)
         {
             Ptr<Application> app = (*it)->GetApplication(i);
+            const uint32_t identifier = GetApplicationIdentifier(id, i);
             bool rxIsConnected = false;
             bool txIsConnected = false;
 
+            // The application's trace sources are shared with the other helpers.
+            Ptr<SharedAppProbe> shared = SharedAppProbe::Get(app);
+
             /**
-             * Connect to Rx trace sources of receiver applications in order to read
-             * traffic time tags.
+             * Connect to the delay computed from the traffic time tags of the
+             * packets received by receiver applications.
              */
-            if (app->GetInstanceTypeId().LookupTraceSourceByName("Rx") != nullptr)
+            if (shared->HasRxTraceSource())
             {
-                NS_LOG_INFO(this << " attempt to connect using Rx");
-                Callback<void, Ptr<const Packet>, const Address&> rxCallback =
-                    MakeBoundCallback(&StatsAppDelayHelper::RxCallback, this, identifier);
-                rxIsConnected = app->TraceConnectWithoutContext("Rx", rxCallback);
+                StatsHelper::FlowTuple_t destination;
+
+                if (GetIdentifierType() == StatsHelper::IDENTIFIER_FLOW)
+                {
+                    if (GetFlowDestination(app, destination))
+                    {
+                        // The identifier is determined for each packet.
+                        NS_LOG_INFO(this << " attempt to connect using RxDelay for flows");
+                        Callback<void, const Time&, const Address&> rxCallback =
+                            MakeBoundCallback(&StatsAppDelayHelper::FlowRxDelayCallback,
+                                              this,
+                                              destination);
+                        rxIsConnected = ConnectTraceSource(shared, "RxDelay", rxCallback);
+                    }
+                }
+                else if (GetIdentifyBySender())
+                {
+                    // The identifier of the sender is determined for each packet.
+                    NS_LOG_INFO(this << " attempt to connect using Rx for sender identifiers");
+                    Callback<void, Ptr<const Packet>, const Address&> rxCallback =
+                        MakeBoundCallback(&StatsAppDelayHelper::SourceIdRxCallback, this);
+                    rxIsConnected = ConnectTraceSource(shared, "Rx", rxCallback);
+                }
+                else if (identifier != StatsHelper::INVALID_IDENTIFIER)
+                {
+                    NS_LOG_INFO(this << " attempt to connect using RxDelay");
+                    Callback<void, const Time&, const Address&> rxCallback =
+                        MakeBoundCallback(&StatsAppDelayHelper::RxDelayCallback, this, identifier);
+                    rxIsConnected = ConnectTraceSource(shared, "RxDelay", rxCallback);
+                }
             }
 
             /**
-             * Connect to Tx trace sources of sender applications in order to attach traffic time
-             * tags
+             * Request traffic time tags to be attached to the packets of sender
+             * applications. The tag is attached once, regardless of the number of
+             * helpers.
              */
-            if (app->GetInstanceTypeId().LookupTraceSourceByName("Tx") != nullptr)
+            if (shared->HasTxTraceSource())
             {
-                NS_LOG_INFO(this << " attempt to connect using Tx");
-                Callback<void, Ptr<const Packet>> txCallback =
-                    MakeBoundCallback(&StatsAppDelayHelper::TxCallback, this);
-                txIsConnected = app->TraceConnectWithoutContext("Tx", txCallback);
+                RequestTimeTag(shared);
+                txIsConnected = true;
+
+                if (GetIdentifyBySender() && GetIdentifierType() != StatsHelper::IDENTIFIER_FLOW)
+                {
+                    RequestSourceIdTag(shared);
+                }
             }
 
             if (rxIsConnected)
@@ -625,65 +732,80 @@ StatsAppDelayHelper::DoInstallProbes()
 } // end of `void DoInstallProbes ();`
 
 void // static
-StatsAppDelayHelper::RxCallback(Ptr<StatsAppDelayHelper> helper,
-                                uint32_t identifier,
-                                Ptr<const Packet> packet,
-                                const Address& from)
+StatsAppDelayHelper::RxDelayCallback(Ptr<StatsAppDelayHelper> helper,
+                                     uint32_t identifier,
+                                     const Time& delay,
+                                     const Address& from)
 {
-    NS_LOG_FUNCTION(helper << identifier << packet << packet->GetSize() << from);
+    NS_LOG_FUNCTION(helper << identifier << delay.As(Time::S) << from);
+    helper->PassSampleToCollector(delay, identifier);
+}
 
-    bool isTagged = false;
-    ByteTagIterator it = packet->GetByteTagIterator();
+void // static
+StatsAppDelayHelper::FlowRxDelayCallback(Ptr<StatsAppDelayHelper> helper,
+                                         StatsHelper::FlowTuple_t destination,
+                                         const Time& delay,
+                                         const Address& from)
+{
+    NS_LOG_FUNCTION(helper << delay.As(Time::S) << from);
 
-    while (!isTagged && it.HasNext())
+    if (!InetSocketAddress::IsMatchingType(from))
     {
-        ByteTagIterator::Item item = it.Next();
-
-        if (item.GetTypeId() == TrafficTimeTag::GetTypeId())
-        {
-            NS_LOG_DEBUG("Contains a TrafficTimeTag tag:" << " start=" << item.GetStart()
-                                                          << " end=" << item.GetEnd());
-            TrafficTimeTag timeTag;
-            item.GetTag(timeTag);
-            const Time delay = Simulator::Now() - timeTag.GetSenderTimestamp();
-            helper->PassSampleToCollector(delay, identifier);
-            isTagged = true; // this will exit the while loop.
-        }
+        NS_LOG_WARN("Discarding a delay sample from statistics collection"
+                    << " because of non-IPv4 sender address " << from);
+        return;
     }
 
-    if (!isTagged)
+    const InetSocketAddress source = InetSocketAddress::ConvertFrom(from);
+    destination.sourceAddress = source.GetIpv4();
+    destination.sourcePort = source.GetPort();
+    const uint32_t identifier = helper->GetFlowIdentifier(destination);
+
+    if (identifier == StatsHelper::INVALID_IDENTIFIER)
     {
-        NS_LOG_WARN("Discarding a packet of " << packet->GetSize() << " from statistics collection"
-                                              << " because it does not contain any TrafficTimeTag");
+        NS_LOG_INFO("Discarding a delay sample of unknown flow " << GetFlowName(destination));
     }
-
-    /*
-    TrafficTimeTag timeTag;
-    if (packet->PeekPacketTag (timeTag))
-      {
-        NS_LOG_DEBUG ("Contains a TrafficTimeTag tag");
-        const Time delay = Simulator::Now () - timeTag.GetSenderTimestamp ();
-        helper->PassSampleToCollector (delay, identifier);
-      }
     else
-      {
-        NS_LOG_WARN ("Discarding a packet of " << packet->GetSize ()
-                                               << " from statistics collection"
-                                               << " because it does not contain any
-    TrafficTimeTag");
-      }
-      */
+    {
+        helper->PassSampleToCollector(delay, identifier);
+    }
 }
 
 void // static
-StatsAppDelayHelper::TxCallback(Ptr<StatsAppDelayHelper> helper, Ptr<const Packet> packet)
+StatsAppDelayHelper::SourceIdRxCallback(Ptr<StatsAppDelayHelper> helper,
+                                        Ptr<const Packet> packet,
+                                        const Address& from)
 {
-    NS_LOG_FUNCTION(helper << packet << packet->GetSize());
+    NS_LOG_FUNCTION(helper << packet << packet->GetSize() << from);
 
-    TrafficTimeTag timeTag(Simulator::Now());
-    packet->AddByteTag(timeTag);
-    NS_LOG_INFO(helper << " attached TrafficTimeTag to packet " << packet << " of size "
-                       << packet->GetSize());
+    SourceIdTag sourceIdTag;
+    if (!packet->PeekPacketTag(sourceIdTag))
+    {
+        helper->DiscardUntaggedPacket(packet);
+        return;
+    }
+
+    TrafficTimeTag timeTag;
+    if (!SharedAppProbe::PeekTrafficTimeTag(packet, timeTag))
+    {
+        NS_LOG_WARN("Discarding a packet of " << packet->GetSize() << " from statistics collection"
+                                              << " because it does not contain any TrafficTimeTag");
+        return;
+    }
+
+    const uint32_t identifier = helper->GetSourceIdentifier(sourceIdTag);
+
+    if (identifier == StatsHelper::INVALID_IDENTIFIER)
+    {
+        NS_LOG_INFO("Discarding a delay sample of packet "
+                    << packet << " from statistics collection because of unknown sender "
+                    << sourceIdTag.GetNodeId() << "-" << sourceIdTag.GetApplicationIndex());
+    }
+    else
+    {
+        helper->PassSampleToCollector(Simulator::Now() - timeTag.GetSenderTimestamp(),
+                                      identifier);
+    }
 }
 
 } // end of namespace ns3
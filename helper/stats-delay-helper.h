@@ -24,12 +24,14 @@
 
 #include "stats-helper.h"
 
+#include "ns3/address-identifier-map.h"
 #include "ns3/address.h"
 #include "ns3/collector-map.h"
 #include "ns3/ptr.h"
 
 #include <list>
 #include <map>
+#include <vector>
 
 namespace ns3
 {
@@ -37,6 +39,7 @@ namespace ns3
 // BASE CLASS /////////////////////////////////////////////////////////////////
 
 class Node;
+class Packet;
 class Time;
 class DataCollectionObject;
 class DistributionCollector;
@@ -81,6 +84,18 @@ class StatsDelayHelper : public StatsHelper
     // inherited from StatsHelper base class
     void DoInstall();
 
+    // inherited from StatsHelper base class
+    uint64_t DoGetMemoryUsage() const;
+
+    // inherited from StatsHelper base class
+    uint32_t DoGetSerializedStateSize() const;
+
+    // inherited from StatsHelper base class
+    void DoSerializeState(Buffer::Iterator start) const;
+
+    // inherited from StatsHelper base class
+    uint32_t DoDeserializeState(Buffer::Iterator start);
+
     /**
      * @brief Install callbacks and probes to application trace sources,
      * if needed. Implemented by child classes.
@@ -112,9 +127,12 @@ class StatsDelayHelper : public StatsHelper
     Ptr<DataCollectionObject> m_aggregator;
 
     /// Map of address and the identifier associated with it (for return link).
-    std::map<const Address, uint32_t> m_identifierMap;
+    AddressIdentifierMap m_identifierMap;
 
   private:
+    /// Collector of each identifier, indexed by identifier.
+    std::vector<Ptr<DataCollectionObject>> m_collectorTable;
+
     bool m_averagingMode; ///< `AveragingMode` attribute.
 
 }; // end of class StatsDelayHelper
@@ -154,32 +172,59 @@ class StatsAppDelayHelper : public StatsDelayHelper
     static TypeId GetTypeId();
 
     /**
-     * @brief Receive inputs from trace sources and determine the right collector
-     *        to forward the inputs to.
+     * @brief Receive the delay of a received packet from SharedAppProbe and
+     *        forward it to the right collector.
      * @param helper Pointer to the delay statistics collector helper
      * @param identifier Identifier used to group statistics.
-     * @param packet the received packet, expected to have been tagged with
-     *               TrafficTimeTag.
+     * @param delay the delay computed from the TrafficTimeTag of the packet.
      * @param from the InetSocketAddress of the sender of the packet.
      */
-    static void RxCallback(Ptr<StatsAppDelayHelper> helper,
-                           uint32_t identifier,
-                           Ptr<const Packet> packet,
-                           const Address& from);
+    static void RxDelayCallback(Ptr<StatsAppDelayHelper> helper,
+                                uint32_t identifier,
+                                const Time& delay,
+                                const Address& from);
 
     /**
-     * @brief Receive inputs from trace sources and determine the right collector
-     *        to forward the inputs to.
+     * @brief Receive the delay of a received packet from SharedAppProbe and
+     *        determine the right collector from the packet's flow.
      * @param helper Pointer to the delay statistics collector helper
-     * @param identifier Identifier used to group statistics.
-     * @param packet the sent packet, yo which TrafficTimeTag will be attached.
+     * @param destination the destination half of the flow's 5-tuple, as
+     *                    determined by StatsHelper::GetFlowDestination().
+     * @param delay the delay computed from the TrafficTimeTag of the packet.
+     * @param from the InetSocketAddress of the sender of the packet.
+     *
+     * Used with `IDENTIFIER_FLOW`. Samples of flows which have not been given
+     * to AddFlow() are discarded.
      */
-    static void TxCallback(Ptr<StatsAppDelayHelper> helper, Ptr<const Packet> packet);
+    static void FlowRxDelayCallback(Ptr<StatsAppDelayHelper> helper,
+                                    StatsHelper::FlowTuple_t destination,
+                                    const Time& delay,
+                                    const Address& from);
+
+    /**
+     * @brief Receive a packet from SharedAppProbe and determine the right
+     *        collector from the SourceIdTag of the packet.
+     * @param helper Pointer to the delay statistics collector helper
+     * @param packet the received packet, expected to have been tagged with
+     *               TrafficTimeTag and SourceIdTag by its sender.
+     * @param from the address of the sender of the packet.
+     *
+     * Used when the `IdentifyBySender` attribute is enabled. The identifier
+     * is found by indexing into the identifier table with the SourceIdTag of
+     * the packet. Packets without the tag are discarded, see
+     * StatsHelper::DiscardUntaggedPacket().
+     */
+    static void SourceIdRxCallback(Ptr<StatsAppDelayHelper> helper,
+                                   Ptr<const Packet> packet,
+                                   const Address& from);
 
   protected:
     // inherited from StatsDelayHelper base class
     void DoInstallProbes();
 
+    // inherited from StatsHelper base class
+    uint64_t DoGetMemoryUsage() const;
+
   private:
     /// Maintains a list of probes created by this helper.
     std::list<Ptr<Probe>> m_probes;
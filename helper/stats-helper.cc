@@ -22,17 +22,36 @@
 
 #include "stats-helper.h"
 
+#include "ns3/abort.h"
 #include "ns3/address.h"
+#include "ns3/application.h"
+#include "ns3/boolean.h"
+#include "ns3/collector-bank.h"
 #include "ns3/collector-map.h"
 #include "ns3/data-collection-object.h"
 #include "ns3/enum.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/interval-rate-collector.h"
+#include "ns3/ipv4.h"
 #include "ns3/log.h"
 #include "ns3/mac48-address.h"
+#include "ns3/memory-usage.h"
 #include "ns3/node-container.h"
 #include "ns3/object-factory.h"
+#include "ns3/pointer.h"
+#include "ns3/scalar-collector.h"
+#include "ns3/simulator.h"
 #include "ns3/singleton.h"
+#include "ns3/source-id-tag.h"
+#include "ns3/steady-state-controller.h"
 #include "ns3/string.h"
+#include "ns3/tcp-l4-protocol.h"
+#include "ns3/tcp-socket-factory.h"
 #include "ns3/type-id.h"
+#include "ns3/udp-l4-protocol.h"
+#include "ns3/udp-socket-factory.h"
+#include "ns3/uinteger.h"
+#include "ns3/unit-conversion-collector.h"
 
 #include <sstream>
 #include <stdio.h>
@@ -55,6 +74,12 @@ StatsHelper::GetIdentifierTypeName(StatsHelper::IdentifierType_t identifierType)
         return "IDENTIFIER_GLOBAL";
     case StatsHelper::IDENTIFIER_NODE:
         return "IDENTIFIER_NODE";
+    case StatsHelper::IDENTIFIER_APPLICATION:
+        return "IDENTIFIER_APPLICATION";
+    case StatsHelper::IDENTIFIER_FLOW:
+        return "IDENTIFIER_FLOW";
+    case StatsHelper::IDENTIFIER_GROUP:
+        return "IDENTIFIER_GROUP";
     default:
         NS_FATAL_ERROR("StatsHelper - Invalid identifier type");
         break;
@@ -64,6 +89,42 @@ StatsHelper::GetIdentifierTypeName(StatsHelper::IdentifierType_t identifierType)
     return "";
 }
 
+StatsHelper::FlowTuple_t::FlowTuple_t()
+    : sourceAddress(),
+      destinationAddress(),
+      sourcePort(0),
+      destinationPort(0),
+      protocol(0)
+{
+}
+
+bool
+StatsHelper::FlowTuple_t::operator==(const StatsHelper::FlowTuple_t& other) const
+{
+    return sourceAddress == other.sourceAddress &&
+           destinationAddress == other.destinationAddress && sourcePort == other.sourcePort &&
+           destinationPort == other.destinationPort && protocol == other.protocol;
+}
+
+std::size_t
+StatsHelper::FlowTupleHash_t::operator()(const StatsHelper::FlowTuple_t& flow) const
+{
+    const uint64_t addresses = (static_cast<uint64_t>(flow.sourceAddress.Get()) << 32) |
+                               flow.destinationAddress.Get();
+    const uint64_t ports = (static_cast<uint64_t>(flow.sourcePort) << 24) |
+                           (static_cast<uint64_t>(flow.destinationPort) << 8) | flow.protocol;
+    return std::hash<uint64_t>()(addresses ^ (ports * 0x9E3779B97F4A7C15ULL));
+}
+
+std::string // static
+StatsHelper::GetFlowName(const StatsHelper::FlowTuple_t& flow)
+{
+    std::ostringstream oss;
+    oss << flow.sourceAddress << ":" << flow.sourcePort << "-" << flow.destinationAddress << ":"
+        << flow.destinationPort << "-" << static_cast<uint32_t>(flow.protocol);
+    return oss.str();
+}
+
 std::string // static
 StatsHelper::GetOutputTypeName(StatsHelper::OutputType_t outputType)
 {
@@ -106,7 +167,12 @@ StatsHelper::StatsHelper()
       m_identifierType(StatsHelper::IDENTIFIER_GLOBAL),
       m_outputType(StatsHelper::OUTPUT_SCATTER_FILE),
       m_isInstalled(false),
-      m_nodes(NodeContainer())
+      m_isEnabled(true),
+      m_identifyBySender(false),
+      m_nodes(NodeContainer()),
+      m_memoryUsageInterval(Seconds(0)),
+      m_numOfUntaggedPackets(0),
+      m_untaggedBytes(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -144,7 +210,13 @@ StatsHelper::GetTypeId()
                 MakeEnumChecker(StatsHelper::IDENTIFIER_GLOBAL,
                                 "GLOBAL",
                                 StatsHelper::IDENTIFIER_NODE,
-                                "NODE"))
+                                "NODE",
+                                StatsHelper::IDENTIFIER_APPLICATION,
+                                "APPLICATION",
+                                StatsHelper::IDENTIFIER_FLOW,
+                                "FLOW",
+                                StatsHelper::IDENTIFIER_GROUP,
+                                "GROUP"))
             .AddAttribute("OutputType",
                           "Determines the type and format of the output.",
                           EnumValue(StatsHelper::OUTPUT_SCATTER_FILE),
@@ -169,7 +241,43 @@ StatsHelper::GetTypeId()
                                           StatsHelper::OUTPUT_PDF_PLOT,
                                           "PDF_PLOT",
                                           StatsHelper::OUTPUT_CDF_PLOT,
-                                          "CDF_PLOT"));
+                                          "CDF_PLOT"))
+            .AddAttribute("SteadyStateController",
+                          "If set, the output of the collectors created by this helper "
+                          "is also passed to this controller, which stops the "
+                          "simulation once the statistics have converged.",
+                          PointerValue(),
+                          MakePointerAccessor(&StatsHelper::SetSteadyStateController,
+                                              &StatsHelper::GetSteadyStateController),
+                          MakePointerChecker<SteadyStateController>())
+            .AddAttribute("Enabled",
+                          "If false, the trace sinks of this helper are disconnected "
+                          "from the source objects, so that no sample is received and "
+                          "no processing cost is incurred.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&StatsHelper::SetEnabled, &StatsHelper::IsEnabled),
+                          MakeBooleanChecker())
+            .AddAttribute("IdentifyBySender",
+                          "If true, the application-level helpers report a received "
+                          "packet under the identifier of its sending application, "
+                          "carried by a SourceIdTag, instead of the receiving one. "
+                          "Ignored with the FLOW identifier type.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&StatsHelper::SetIdentifyBySender,
+                                              &StatsHelper::GetIdentifyBySender),
+                          MakeBooleanChecker())
+            .AddAttribute("MemoryUsageInterval",
+                          "If non-zero, the `MemoryUsage` trace source is fired with "
+                          "this interval, starting after Install(), to watch the "
+                          "memory growth of the statistics during long runs.",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&StatsHelper::m_memoryUsageInterval),
+                          MakeTimeChecker(Seconds(0)))
+            .AddTraceSource("MemoryUsage",
+                            "The estimated memory used by the statistics of this "
+                            "helper, in bytes.",
+                            MakeTraceSourceAccessor(&StatsHelper::m_memoryUsageTrace),
+                            "ns3::StatsHelper::MemoryUsageCallback");
     return tid;
 }
 
@@ -185,8 +293,15 @@ StatsHelper::Install()
     }
     else
     {
+        BuildIdentifierTable();
         DoInstall(); // this method is supposed to be implemented by the child class
         m_isInstalled = true;
+
+        if (m_memoryUsageInterval.IsStrictlyPositive())
+        {
+            m_memoryUsageEvent =
+                Simulator::Schedule(m_memoryUsageInterval, &StatsHelper::FireMemoryUsage, this);
+        }
     }
 }
 
@@ -270,6 +385,277 @@ StatsHelper::IsInstalled() const
     return m_isInstalled;
 }
 
+void
+StatsHelper::SetSteadyStateController(Ptr<SteadyStateController> controller)
+{
+    NS_LOG_FUNCTION(this << controller);
+
+    if (m_isInstalled)
+    {
+        NS_LOG_WARN(this << " cannot modify the current steady-state controller"
+                         << " because this instance have already been installed");
+    }
+    else
+    {
+        m_steadyStateController = controller;
+    }
+}
+
+Ptr<SteadyStateController>
+StatsHelper::GetSteadyStateController() const
+{
+    return m_steadyStateController;
+}
+
+void
+StatsHelper::SetIdentifyBySender(bool identifyBySender)
+{
+    NS_LOG_FUNCTION(this << identifyBySender);
+
+    if (m_isInstalled)
+    {
+        NS_LOG_WARN(this << " cannot modify the sender identification"
+                         << " because this instance have already been installed");
+    }
+    else
+    {
+        m_identifyBySender = identifyBySender;
+    }
+}
+
+bool
+StatsHelper::GetIdentifyBySender() const
+{
+    return m_identifyBySender;
+}
+
+void
+StatsHelper::AddFlow(const StatsHelper::FlowTuple_t& flow)
+{
+    NS_LOG_FUNCTION(this << GetFlowName(flow));
+
+    if (m_isInstalled)
+    {
+        NS_LOG_WARN(this << " cannot add flow " << GetFlowName(flow)
+                         << " because this instance have already been installed");
+    }
+    else
+    {
+        m_flows.push_back(flow);
+    }
+}
+
+void
+StatsHelper::SetGroupingCallback(StatsHelper::GroupingCallback callback)
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_isInstalled)
+    {
+        NS_LOG_WARN(this << " cannot modify the current grouping callback"
+                         << " because this instance have already been installed");
+    }
+    else
+    {
+        m_groupingCallback = callback;
+    }
+}
+
+uint32_t
+StatsHelper::GetNumOfIdentifiers() const
+{
+    return m_identifierTable.size();
+}
+
+void
+StatsHelper::SetEnabled(bool enabled)
+{
+    NS_LOG_FUNCTION(this << enabled);
+
+    if (m_isEnabled == enabled)
+    {
+        return;
+    }
+
+    m_isEnabled = enabled;
+
+    for (std::list<TraceSourceConnection_t>::const_iterator it = m_traceSourceConnections.begin();
+         it != m_traceSourceConnections.end();
+         ++it)
+    {
+        if (enabled)
+        {
+            ConnectTraceSink(it->object, it->traceSourceName, it->callback);
+        }
+        else
+        {
+            DisconnectTraceSink(it->object, it->traceSourceName, it->callback);
+        }
+    }
+
+    for (std::list<TagRequest_t>::const_iterator it = m_tagRequests.begin();
+         it != m_tagRequests.end();
+         ++it)
+    {
+        if (enabled && it->isSourceIdTag)
+        {
+            it->probe->RequestSourceIdTag();
+        }
+        else if (enabled)
+        {
+            it->probe->RequestTimeTag();
+        }
+        else if (it->isSourceIdTag)
+        {
+            it->probe->ReleaseSourceIdTag();
+        }
+        else
+        {
+            it->probe->ReleaseTimeTag();
+        }
+    }
+
+    NS_LOG_INFO(this << " " << (enabled ? "connected " : "disconnected ")
+                     << m_traceSourceConnections.size() << " trace sinks and "
+                     << m_tagRequests.size() << " tagging requests");
+}
+
+bool
+StatsHelper::IsEnabled() const
+{
+    return m_isEnabled;
+}
+
+uint64_t
+StatsHelper::GetMemoryUsage() const
+{
+    uint64_t usage = sizeof(StatsHelper);
+    usage += MemoryUsage::GetStringUsage(m_name) + MemoryUsage::GetStringUsage(m_outputPath);
+    usage += m_nodes.GetN() * sizeof(Ptr<Node>);
+    usage += MemoryUsage::GetVectorUsage(m_identifierTable);
+    usage += MemoryUsage::GetVectorUsage(m_nodeOffsets);
+    usage += MemoryUsage::GetVectorUsage(m_nodeNumOfApplications);
+    usage += MemoryUsage::GetVectorUsage(m_applicationIdentifiers);
+    usage += MemoryUsage::GetVectorUsage(m_flows);
+    usage += MemoryUsage::GetListUsage(m_flowIdentifiers.size(),
+                                       sizeof(std::pair<const FlowTuple_t, uint32_t>)) +
+             m_flowIdentifiers.bucket_count() * sizeof(void*);
+    usage += MemoryUsage::GetListUsage(m_traceSourceConnections.size(),
+                                       sizeof(TraceSourceConnection_t));
+    usage += MemoryUsage::GetListUsage(m_tagRequests.size(), sizeof(TagRequest_t));
+
+    for (const IdentifierEntry_t& entry : m_identifierTable)
+    {
+        usage += MemoryUsage::GetStringUsage(entry.name);
+    }
+
+    for (const TraceSourceConnection_t& connection : m_traceSourceConnections)
+    {
+        usage += MemoryUsage::GetStringUsage(connection.traceSourceName);
+    }
+
+    return usage + DoGetMemoryUsage();
+}
+
+uint64_t
+StatsHelper::DoGetMemoryUsage() const
+{
+    return 0;
+}
+
+uint32_t
+StatsHelper::GetSerializedStateSize() const
+{
+    return 4 + DoGetSerializedStateSize();
+}
+
+void
+StatsHelper::SerializeState(Buffer::Iterator start) const
+{
+    NS_LOG_FUNCTION(this << m_name);
+
+    if (!m_isInstalled)
+    {
+        NS_FATAL_ERROR("Helper " << m_name << " has not been installed yet");
+    }
+
+    Buffer::Iterator i = start;
+    i.WriteU32(GetNumOfIdentifiers());
+    DoSerializeState(i);
+}
+
+uint32_t
+StatsHelper::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this << m_name);
+
+    if (!m_isInstalled)
+    {
+        NS_FATAL_ERROR("Helper " << m_name << " has not been installed yet");
+    }
+
+    Buffer::Iterator i = start;
+    const uint32_t numOfIdentifiers = i.ReadU32();
+
+    if (numOfIdentifiers != GetNumOfIdentifiers())
+    {
+        NS_FATAL_ERROR("The saved state has " << numOfIdentifiers << " identifiers, but helper "
+                                              << m_name << " has " << GetNumOfIdentifiers());
+    }
+
+    i.Next(DoDeserializeState(i));
+    return i.GetDistanceFrom(start);
+}
+
+uint32_t
+StatsHelper::DoGetSerializedStateSize() const
+{
+    return 0;
+}
+
+void
+StatsHelper::DoSerializeState(Buffer::Iterator start) const
+{
+}
+
+uint32_t
+StatsHelper::DoDeserializeState(Buffer::Iterator start)
+{
+    return 0;
+}
+
+void
+StatsHelper::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_memoryUsageEvent.Cancel();
+
+    if (m_isEnabled)
+    {
+        SetEnabled(false);
+    }
+
+    m_traceSourceConnections.clear();
+    m_tagRequests.clear();
+
+    if (m_numOfUntaggedPackets > 0)
+    {
+        NS_LOG_INFO(this << " discarded " << m_numOfUntaggedPackets << " packets ("
+                         << m_untaggedBytes << " bytes) without SourceIdTag");
+    }
+
+    Object::DoDispose();
+}
+
+void
+StatsHelper::FireMemoryUsage()
+{
+    NS_LOG_FUNCTION(this);
+    m_memoryUsageTrace(GetMemoryUsage());
+    m_memoryUsageEvent =
+        Simulator::Schedule(m_memoryUsageInterval, &StatsHelper::FireMemoryUsage, this);
+}
+
 Ptr<DataCollectionObject>
 StatsHelper::CreateAggregator(std::string aggregatorTypeId,
                               std::string n1,
@@ -302,41 +688,501 @@ StatsHelper::CreateCollectorPerIdentifier(CollectorMap& collectorMap) const
     NS_LOG_FUNCTION(this);
     uint32_t n = 0;
 
-    switch (GetIdentifierType())
+    for (std::vector<IdentifierEntry_t>::const_iterator it = m_identifierTable.begin();
+         it != m_identifierTable.end();
+         ++it)
     {
-    case StatsHelper::IDENTIFIER_GLOBAL: {
-        collectorMap.SetAttribute("Name", StringValue("0"));
-        collectorMap.Create(0);
+        collectorMap.SetAttribute("Name", StringValue(it->name));
+        collectorMap.Create(it->identifier);
+        n++;
+    }
+
+    NS_LOG_INFO(this << " created " << n << " instance(s)" << " of "
+                     << collectorMap.GetType().GetName() << " for "
+                     << GetIdentifierTypeName(GetIdentifierType()));
+
+    return n;
+
+} // end of `uint32_t CreateCollectorPerIdentifier (CollectorMap &);`
+
+uint32_t
+StatsHelper::CreateIdentifierPerBank(Ptr<CollectorBank> collectorBank,
+                                     std::map<uint32_t, uint32_t>& indices) const
+{
+    NS_LOG_FUNCTION(this << collectorBank);
+    NS_ASSERT(collectorBank != nullptr);
+    uint32_t n = 0;
+
+    for (std::vector<IdentifierEntry_t>::const_iterator it = m_identifierTable.begin();
+         it != m_identifierTable.end();
+         ++it)
+    {
+        indices[it->identifier] = collectorBank->AddIdentifier(it->name);
         n++;
-        break;
     }
 
-    case StatsHelper::IDENTIFIER_NODE: {
-        NodeContainer allNodes = m_nodes;
-        for (NodeContainer::Iterator it = allNodes.Begin(); it != allNodes.End(); ++it)
+    NS_LOG_INFO(this << " added " << n << " identifier(s) to collector bank for "
+                     << GetIdentifierTypeName(GetIdentifierType()));
+
+    return n;
+
+} // end of `uint32_t CreateIdentifierPerBank (Ptr<CollectorBank>, std::map &);`
+
+uint32_t
+StatsHelper::GetApplicationIdentifier(uint32_t nodeId, uint32_t applicationIndex) const
+{
+    if (nodeId >= m_nodeOffsets.size() || m_nodeOffsets[nodeId] == INVALID_IDENTIFIER)
+    {
+        return INVALID_IDENTIFIER;
+    }
+
+    if (applicationIndex >= m_nodeNumOfApplications[nodeId])
+    {
+        // Beyond the last application of the node, i.e., not the first
+        // application of the next node.
+        return INVALID_IDENTIFIER;
+    }
+
+    return m_applicationIdentifiers[m_nodeOffsets[nodeId] + applicationIndex];
+}
+
+uint32_t
+StatsHelper::GetSourceIdentifier(const SourceIdTag& tag) const
+{
+    const uint32_t nodeId = tag.GetNodeId();
+
+    if (tag.GetApplicationIndex() != SourceIdTag::ANY_APPLICATION)
+    {
+        return GetApplicationIdentifier(nodeId, tag.GetApplicationIndex());
+    }
+
+    if (nodeId >= m_nodeOffsets.size() || m_nodeOffsets[nodeId] == INVALID_IDENTIFIER)
+    {
+        return INVALID_IDENTIFIER;
+    }
+
+    switch (m_identifierType)
+    {
+    case StatsHelper::IDENTIFIER_GLOBAL:
+        return 0;
+
+    case StatsHelper::IDENTIFIER_NODE:
+        return nodeId;
+
+    default:
+        // Only applications belong to the other identifier types.
+        return INVALID_IDENTIFIER;
+    }
+}
+
+uint32_t
+StatsHelper::GetFlowIdentifier(const StatsHelper::FlowTuple_t& flow) const
+{
+    // NS_LOG_FUNCTION (this << GetFlowName (flow));
+
+    std::unordered_map<FlowTuple_t, uint32_t, FlowTupleHash_t>::const_iterator it =
+        m_flowIdentifiers.find(flow);
+
+    if (it == m_flowIdentifiers.end() && flow.sourcePort != 0)
+    {
+        // Try again with the wildcard source port.
+        FlowTuple_t anyPort = flow;
+        anyPort.sourcePort = 0;
+        it = m_flowIdentifiers.find(anyPort);
+    }
+
+    return (it == m_flowIdentifiers.end()) ? INVALID_IDENTIFIER : it->second;
+}
+
+bool
+StatsHelper::GetFlowDestination(Ptr<Application> application,
+                                StatsHelper::FlowTuple_t& flow) const
+{
+    NS_LOG_FUNCTION(this << application);
+    NS_ASSERT(application != nullptr);
+
+    AddressValue local;
+    UintegerValue port;
+    if (application->GetAttributeFailSafe("Local", local) &&
+        InetSocketAddress::IsMatchingType(local.Get()))
+    {
+        const InetSocketAddress address = InetSocketAddress::ConvertFrom(local.Get());
+        flow.destinationAddress = address.GetIpv4();
+        flow.destinationPort = address.GetPort();
+    }
+    else if (application->GetAttributeFailSafe("Port", port))
+    {
+        flow.destinationAddress = Ipv4Address::GetAny();
+        flow.destinationPort = static_cast<uint16_t>(port.Get());
+    }
+    else
+    {
+        return false;
+    }
+
+    TypeIdValue protocol;
+    flow.protocol = 0;
+    if (application->GetAttributeFailSafe("Protocol", protocol))
+    {
+        if (protocol.Get() == TcpSocketFactory::GetTypeId())
+        {
+            flow.protocol = TcpL4Protocol::PROT_NUMBER;
+        }
+        else if (protocol.Get() == UdpSocketFactory::GetTypeId())
+        {
+            flow.protocol = UdpL4Protocol::PROT_NUMBER;
+        }
+    }
+    else
+    {
+        // Applications without the attribute, e.g., UdpServer, use UDP.
+        flow.protocol = UdpL4Protocol::PROT_NUMBER;
+    }
+
+    if (flow.destinationAddress == Ipv4Address::GetAny())
+    {
+        /*
+         * The application receives the packets sent to any address of the
+         * node. Look through every address of the node for the destination of
+         * a flow given to AddFlow(), and fall back to the first non-loopback
+         * address if there is none.
+         */
+        Ptr<Ipv4> ipv4 = application->GetNode()->GetObject<Ipv4>();
+        Ipv4Address firstAddress = Ipv4Address::GetAny();
+        uint32_t numOfMatches = 0;
+
+        for (uint32_t i = 0; ipv4 != nullptr && i < ipv4->GetNInterfaces(); i++)
+        {
+            for (uint32_t j = 0; j < ipv4->GetNAddresses(i); j++)
+            {
+                const Ipv4Address local = ipv4->GetAddress(i, j).GetLocal();
+                if (local.IsLocalhost())
+                {
+                    continue;
+                }
+
+                if (firstAddress == Ipv4Address::GetAny())
+                {
+                    firstAddress = local;
+                }
+
+                for (std::vector<FlowTuple_t>::const_iterator it = m_flows.begin();
+                     it != m_flows.end();
+                     ++it)
+                {
+                    if (it->destinationAddress == local &&
+                        it->destinationPort == flow.destinationPort &&
+                        it->protocol == flow.protocol)
+                    {
+                        if (numOfMatches == 0)
+                        {
+                            flow.destinationAddress = local;
+                        }
+                        numOfMatches++;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (numOfMatches == 0)
+        {
+            flow.destinationAddress = firstAddress;
+        }
+        else if (numOfMatches > 1)
+        {
+            NS_LOG_WARN(this << " application " << application << " receives flows towards "
+                             << numOfMatches << " addresses, only the flows towards "
+                             << flow.destinationAddress << " are reported");
+        }
+    }
+
+    return true;
+
+} // end of `bool GetFlowDestination (Ptr<Application>, FlowTuple_t &);`
+
+void
+StatsHelper::BuildIdentifierTable()
+{
+    NS_LOG_FUNCTION(this << GetIdentifierTypeName(m_identifierType));
+
+    m_identifierTable.clear();
+    m_nodeOffsets.clear();
+    m_nodeNumOfApplications.clear();
+    m_applicationIdentifiers.clear();
+    m_flowIdentifiers.clear();
+
+    if (m_identifierType == StatsHelper::IDENTIFIER_GLOBAL)
+    {
+        m_identifierTable.push_back({0, "0"});
+    }
+    else if (m_identifierType == StatsHelper::IDENTIFIER_FLOW)
+    {
+        for (std::vector<FlowTuple_t>::const_iterator it = m_flows.begin(); it != m_flows.end();
+             ++it)
+        {
+            const uint32_t identifier = m_identifierTable.size();
+            if (m_flowIdentifiers.insert(std::make_pair(*it, identifier)).second)
+            {
+                m_identifierTable.push_back({identifier, GetFlowName(*it)});
+            }
+        }
+    }
+
+    NS_ABORT_MSG_IF(m_identifierType == StatsHelper::IDENTIFIER_GROUP &&
+                        m_groupingCallback.IsNull(),
+                    "IDENTIFIER_GROUP requires a grouping callback");
+
+    // Group name and identifier of each group created so far.
+    std::map<std::string, uint32_t> groups;
+
+    for (NodeContainer::Iterator it = m_nodes.Begin(); it != m_nodes.End(); ++it)
+    {
+        const uint32_t nodeId = (*it)->GetId();
+        if (nodeId >= m_nodeOffsets.size())
+        {
+            m_nodeOffsets.resize(nodeId + 1, INVALID_IDENTIFIER);
+            m_nodeNumOfApplications.resize(nodeId + 1, 0);
+        }
+        else if (m_nodeOffsets[nodeId] != INVALID_IDENTIFIER)
+        {
+            continue; // the node has been installed twice
+        }
+
+        m_nodeOffsets[nodeId] = m_applicationIdentifiers.size();
+        m_nodeNumOfApplications[nodeId] = (*it)->GetNApplications();
+
+        if (m_identifierType == StatsHelper::IDENTIFIER_NODE)
         {
-            const uint32_t nodeId = (*it)->GetId();
             std::ostringstream name;
             name << nodeId;
-            collectorMap.SetAttribute("Name", StringValue(name.str()));
-            collectorMap.Create(nodeId);
-            n++;
+            m_identifierTable.push_back({nodeId, name.str()});
         }
-        break;
+
+        for (uint32_t i = 0; i < (*it)->GetNApplications(); i++)
+        {
+            uint32_t identifier = INVALID_IDENTIFIER;
+
+            switch (m_identifierType)
+            {
+            case StatsHelper::IDENTIFIER_GLOBAL:
+                identifier = 0;
+                break;
+
+            case StatsHelper::IDENTIFIER_NODE:
+                identifier = nodeId;
+                break;
+
+            case StatsHelper::IDENTIFIER_APPLICATION: {
+                identifier = m_identifierTable.size();
+                std::ostringstream name;
+                name << nodeId << "-" << i;
+                m_identifierTable.push_back({identifier, name.str()});
+                break;
+            }
+
+            case StatsHelper::IDENTIFIER_GROUP: {
+                const std::string group = m_groupingCallback((*it)->GetApplication(i));
+                if (!group.empty())
+                {
+                    std::map<std::string, uint32_t>::const_iterator it2 = groups.find(group);
+                    if (it2 == groups.end())
+                    {
+                        identifier = m_identifierTable.size();
+                        groups[group] = identifier;
+                        m_identifierTable.push_back({identifier, group});
+                    }
+                    else
+                    {
+                        identifier = it2->second;
+                    }
+                }
+                break;
+            }
+
+            default:
+                // Flows are identified by packet, not by application.
+                break;
+            }
+
+            m_applicationIdentifiers.push_back(identifier);
+        }
+
+    } // end of `for (it = m_nodes.Begin (); it != m_nodes.End (); ++it)`
+
+    NS_LOG_INFO(this << " built an identifier table of " << m_identifierTable.size()
+                     << " identifier(s) and " << m_applicationIdentifiers.size()
+                     << " application(s)");
+
+} // end of `void BuildIdentifierTable ();`
+
+void
+StatsHelper::ConnectCollectorsToSteadyStateController(CollectorMap& collectorMap) const
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_steadyStateController == nullptr)
+    {
+        return;
     }
 
-    default:
-        NS_FATAL_ERROR("StatsHelper - Invalid identifier type");
-        break;
+    uint32_t numOfConnected = 0;
+
+    for (CollectorMap::Iterator it = collectorMap.Begin(); it != collectorMap.End(); ++it)
+    {
+        const std::string context = GetName() + "-" + it->second->GetName();
+        bool ret = false;
+
+        Ptr<ScalarCollector> scalar = it->second->GetObject<ScalarCollector>();
+        if (scalar != nullptr)
+        {
+            // The controller observes the same averaged output as written
+            // by the collector, one value per interval.
+            m_steadyStateController->AddScalarCollector(context, scalar);
+            numOfConnected++;
+            continue;
+        }
+        else if (it->second->GetObject<IntervalRateCollector>() != nullptr)
+        {
+            ret = it->second->TraceConnect(
+                "OutputWithoutTime",
+                context,
+                MakeCallback(&SteadyStateController::TraceSinkDouble, m_steadyStateController));
+        }
+        else if (it->second->GetObject<UnitConversionCollector>() != nullptr)
+        {
+            ret = it->second->TraceConnect(
+                "OutputValue",
+                context,
+                MakeCallback(&SteadyStateController::TraceSinkDouble, m_steadyStateController));
+        }
+        else
+        {
+            NS_LOG_WARN(this << " collector type "
+                             << it->second->GetInstanceTypeId().GetName()
+                             << " is not supported by the steady-state controller");
+            continue;
+        }
+
+        NS_ASSERT_MSG(ret, "Error connecting collector " << context << " to the controller");
+        m_steadyStateController->AddStatistic(context);
+        numOfConnected++;
     }
 
-    NS_LOG_INFO(this << " created " << n << " instance(s)" << " of "
-                     << collectorMap.GetType().GetName() << " for "
-                     << GetIdentifierTypeName(GetIdentifierType()));
+    if (numOfConnected == 0)
+    {
+        NS_LOG_WARN(this << " none of the collectors of " << GetName()
+                         << " is monitored by the steady-state controller");
+    }
 
-    return n;
+} // end of `void ConnectCollectorsToSteadyStateController (CollectorMap &);`
 
-} // end of `uint32_t CreateCollectorPerIdentifier (CollectorMap &);`
+bool
+StatsHelper::ConnectTraceSource(Ptr<Object> object,
+                                std::string traceSourceName,
+                                const CallbackBase& callback)
+{
+    NS_LOG_FUNCTION(this << object << traceSourceName);
+    NS_ASSERT(object != nullptr);
+
+    if (m_isEnabled)
+    {
+        if (!ConnectTraceSink(object, traceSourceName, callback))
+        {
+            return false;
+        }
+    }
+    else if (object->GetInstanceTypeId().LookupTraceSourceByName(traceSourceName) == nullptr)
+    {
+        return false;
+    }
+
+    TraceSourceConnection_t connection;
+    connection.object = object;
+    connection.traceSourceName = traceSourceName;
+    connection.callback = callback;
+    m_traceSourceConnections.push_back(connection);
+    return true;
+}
+
+bool // static
+StatsHelper::ConnectTraceSink(Ptr<Object> object,
+                              std::string traceSourceName,
+                              const CallbackBase& callback)
+{
+    // A shared probe connects itself to its application only while it has sinks.
+    Ptr<SharedAppProbe> probe = DynamicCast<SharedAppProbe>(object);
+    if (probe != nullptr)
+    {
+        return probe->ConnectSink(traceSourceName, callback);
+    }
+
+    return object->TraceConnectWithoutContext(traceSourceName, callback);
+}
+
+bool // static
+StatsHelper::DisconnectTraceSink(Ptr<Object> object,
+                                 std::string traceSourceName,
+                                 const CallbackBase& callback)
+{
+    Ptr<SharedAppProbe> probe = DynamicCast<SharedAppProbe>(object);
+    if (probe != nullptr)
+    {
+        return probe->DisconnectSink(traceSourceName, callback);
+    }
+
+    return object->TraceDisconnectWithoutContext(traceSourceName, callback);
+}
+
+void
+StatsHelper::RequestTimeTag(Ptr<SharedAppProbe> probe)
+{
+    NS_LOG_FUNCTION(this << probe);
+    NS_ASSERT(probe != nullptr);
+
+    if (m_isEnabled)
+    {
+        probe->RequestTimeTag();
+    }
+
+    TagRequest_t request;
+    request.probe = probe;
+    request.isSourceIdTag = false;
+    m_tagRequests.push_back(request);
+}
+
+void
+StatsHelper::RequestSourceIdTag(Ptr<SharedAppProbe> probe)
+{
+    NS_LOG_FUNCTION(this << probe);
+    NS_ASSERT(probe != nullptr);
+
+    if (m_isEnabled)
+    {
+        probe->RequestSourceIdTag();
+    }
+
+    TagRequest_t request;
+    request.probe = probe;
+    request.isSourceIdTag = true;
+    m_tagRequests.push_back(request);
+}
+
+void
+StatsHelper::DiscardUntaggedPacket(Ptr<const Packet> packet)
+{
+    // NS_LOG_FUNCTION (this << packet);
+
+    if (m_numOfUntaggedPackets == 0)
+    {
+        NS_LOG_WARN(this << " discarding packets without SourceIdTag (e.g., received over TCP)"
+                         << " from statistics collection of " << GetName()
+                         << "; further packets are counted silently");
+    }
+
+    m_numOfUntaggedPackets++;
+    m_untaggedBytes += packet->GetSize();
+}
 
 std::string
 StatsHelper::GetOutputPath() const
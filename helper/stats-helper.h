@@ -23,21 +23,36 @@
 #ifndef STATS_HELPER_H
 #define STATS_HELPER_H
 
+#include "shared-app-probe.h"
+
 #include "ns3/attribute.h"
+#include "ns3/buffer.h"
+#include "ns3/callback.h"
+#include "ns3/event-id.h"
+#include "ns3/ipv4-address.h"
 #include "ns3/net-device-container.h"
 #include "ns3/node-container.h"
+#include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
+#include "ns3/traced-callback.h"
 
+#include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
 
+class Application;
 class Node;
+class CollectorBank;
 class CollectorMap;
 class DataCollectionObject;
+class SourceIdTag;
+class SteadyStateController;
 
 /**
  * @ingroup stats
@@ -90,9 +105,50 @@ class StatsHelper : public Object
     typedef enum
     {
         IDENTIFIER_GLOBAL = 0,
-        IDENTIFIER_NODE
+        IDENTIFIER_NODE,
+        IDENTIFIER_APPLICATION, ///< One identifier per installed application.
+        IDENTIFIER_FLOW,        ///< One identifier per flow given to AddFlow().
+        IDENTIFIER_GROUP        ///< Applications grouped by SetGroupingCallback().
     } IdentifierType_t;
 
+    /// Returned when a source does not belong to any identifier.
+    static constexpr uint32_t INVALID_IDENTIFIER = 0xFFFFFFFF;
+
+    /**
+     * @brief The 5-tuple identifying an IPv4 flow, used with
+     *        `IDENTIFIER_FLOW`.
+     */
+    struct FlowTuple_t
+    {
+        Ipv4Address sourceAddress;      ///< Source address.
+        Ipv4Address destinationAddress; ///< Destination address.
+        uint16_t sourcePort;            ///< Source port, or zero to match any.
+        uint16_t destinationPort;       ///< Destination port.
+        uint8_t protocol;               ///< IP protocol number, e.g., 6 for TCP.
+
+        /// Creates an empty tuple.
+        FlowTuple_t();
+
+        /**
+         * @param other another tuple.
+         * @return true if every field of both tuples is equal.
+         */
+        bool operator==(const FlowTuple_t& other) const;
+    };
+
+    /**
+     * @param flow an arbitrary flow.
+     * @return representation of the flow in string, e.g.,
+     *         `10.1.1.1:49153-10.1.1.2:9-6`.
+     */
+    static std::string GetFlowName(const FlowTuple_t& flow);
+
+    /**
+     * @brief Callback returning the name of the group of an application, or
+     *        an empty string to exclude the application from the statistics.
+     */
+    typedef Callback<std::string, Ptr<Application>> GroupingCallback;
+
     /**
      * @param identifierType an arbitrary identifier type.
      * @return representation of the identifier type in string.
@@ -208,6 +264,118 @@ class StatsHelper : public Object
      */
     bool IsInstalled() const;
 
+    /**
+     * @param controller the controller which will receive the output of the
+     *                   collectors created by this helper, or zero to disable.
+     * @warning Does not have any effect if invoked after Install().
+     */
+    void SetSteadyStateController(Ptr<SteadyStateController> controller);
+
+    /**
+     * @return the controller which receives the output of the collectors
+     *         created by this helper, or zero if none.
+     */
+    Ptr<SteadyStateController> GetSteadyStateController() const;
+
+    /**
+     * @param identifyBySender whether the application-level helpers report a
+     *                         received packet under the identifier of its
+     *                         sending application, carried by a SourceIdTag,
+     *                         instead of the identifier of the receiving one.
+     * @warning Does not have any effect if invoked after Install().
+     *
+     * The senders are identified only when they are installed to the helper,
+     * like the receivers. Packets without the tag, e.g., those sent by an
+     * application which is not installed, are looked up by the sender address.
+     * It is ignored with `IDENTIFIER_FLOW`.
+     */
+    void SetIdentifyBySender(bool identifyBySender);
+
+    /**
+     * @return whether received packets are reported under the identifier of
+     *         their sender.
+     */
+    bool GetIdentifyBySender() const;
+
+    /**
+     * @param flow a flow to be reported separately when `IDENTIFIER_FLOW` is
+     *             used. A zero source port matches any source port.
+     * @warning Does not have any effect if invoked after Install().
+     */
+    void AddFlow(const FlowTuple_t& flow);
+
+    /**
+     * @param callback the function assigning each application to a group
+     *                 when `IDENTIFIER_GROUP` is used. Applications with the
+     *                 same group name share one identifier. Install()
+     *                 aborts the simulation if `IDENTIFIER_GROUP` is used
+     *                 without it.
+     * @warning Does not have any effect if invoked after Install().
+     */
+    void SetGroupingCallback(GroupingCallback callback);
+
+    /**
+     * @return the number of identifiers, available after Install().
+     */
+    uint32_t GetNumOfIdentifiers() const;
+
+    /**
+     * @brief Enable or disable the statistics produced by this helper.
+     * @param enabled whether the helper receives samples from its sources.
+     *
+     * Disabling the helper disconnects every trace sink which the helper
+     * has connected to the source objects (e.g., applications) through
+     * ConnectTraceSource(), so that a disabled helper costs nothing while
+     * the simulation runs. Enabling the helper again reconnects them. It may
+     * be invoked before or after Install().
+     */
+    void SetEnabled(bool enabled);
+
+    /**
+     * @return whether the helper receives samples from its sources.
+     */
+    bool IsEnabled() const;
+
+    /**
+     * @brief Estimate the memory used by the statistics of this helper.
+     * @return the memory used by the helper, its identifier tables, and the
+     *         probes, collectors, and aggregators it has created, in bytes.
+     *
+     * See MemoryUsage for what the estimate covers. The same value is fired
+     * periodically through the `MemoryUsage` trace source when the
+     * `MemoryUsageInterval` attribute is set.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * Callback signature for `MemoryUsage` trace source.
+     * @param memoryUsage the memory used by the helper, see GetMemoryUsage().
+     */
+    typedef void (*MemoryUsageCallback)(uint64_t memoryUsage);
+
+    /**
+     * @return the number of bytes written by SerializeState().
+     */
+    uint32_t GetSerializedStateSize() const;
+
+    /**
+     * @brief Save the state of the collectors and aggregators created by the
+     *        helper, see CollectorState.
+     * @param start the iterator to write to.
+     *
+     * The helper must have been installed.
+     */
+    void SerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by SerializeState() into a helper of the
+     *        same type, configured and installed in the same way, e.g., by
+     *        the same simulation script.
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     */
+    uint32_t DeserializeState(Buffer::Iterator start);
+
   protected:
     /**
      * @brief Install the probes, collectors, and aggregators necessary to
@@ -218,6 +386,44 @@ class StatsHelper : public Object
      */
     virtual void DoInstall() = 0;
 
+    /**
+     * @return the memory used by the members of the child class, including
+     *         the probes, collectors, and aggregators it has created, but
+     *         excluding the members of StatsHelper.
+     *
+     * Invoked by GetMemoryUsage(). The default implementation returns zero.
+     */
+    virtual uint64_t DoGetMemoryUsage() const;
+
+    /**
+     * @return the number of bytes written by DoSerializeState().
+     *
+     * Invoked by GetSerializedStateSize(). The default implementation returns
+     * zero.
+     */
+    virtual uint32_t DoGetSerializedStateSize() const;
+
+    /**
+     * @brief Save the state of the collectors and aggregators created by the
+     *        child class.
+     * @param start the iterator to write to.
+     *
+     * Invoked by SerializeState(). The default implementation does nothing.
+     */
+    virtual void DoSerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by DoSerializeState().
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     *
+     * Invoked by DeserializeState(). The default implementation returns zero.
+     */
+    virtual uint32_t DoDeserializeState(Buffer::Iterator start);
+
+    // Inherited from Object base class
+    virtual void DoDispose();
+
     /**
      * @return the path where statistics output file should be created.
      *
@@ -296,13 +502,150 @@ class StatsHelper : public Object
      *
      * The identifier is determined by the currently active identifier type, as
      * previously selected by SetIdentifierType() method or `IdentifierType`
-     * attribute. Then the method creates identifiers for installed nodes based on
-     * current identifier type, creates a collector instance for each identifier,
-     * assigns the collector instance a name, and put the collector instance into
-     * the CollectorMap.
+     * attribute. The method goes through the identifier table which Install()
+     * has built for the installed nodes based on current identifier type,
+     * creates a collector instance for each identifier, assigns the collector
+     * instance a name, and put the collector instance into the CollectorMap.
      */
     uint32_t CreateCollectorPerIdentifier(CollectorMap& collectorMap) const;
 
+    /**
+     * @brief Add one identifier to the collector bank for each identifier in
+     *        the simulation.
+     * @param collectorBank the CollectorBank where the identifiers will be added.
+     * @param indices the map where the index of each identifier within the bank
+     *                will be stored.
+     * @return number of identifiers added.
+     *
+     * The identifiers and their names are the same as those created by
+     * CreateCollectorPerIdentifier().
+     */
+    uint32_t CreateIdentifierPerBank(Ptr<CollectorBank> collectorBank,
+                                     std::map<uint32_t, uint32_t>& indices) const;
+
+    /**
+     * @brief Connect the collectors in the map to the steady-state controller,
+     *        if one has been set.
+     * @param collectorMap the CollectorMap containing the collectors.
+     *
+     * Each collector is registered in the controller as a separate statistic,
+     * using the helper name and the collector name as the context.
+     * ScalarCollector instances are read by the controller at every interval
+     * (see SteadyStateController::AddScalarCollector()), so that the
+     * controller observes the averaged output of the collector instead of its
+     * input samples. IntervalRateCollector and UnitConversionCollector
+     * instances pass their output values as observations. Other collector
+     * types are skipped with a warning.
+     */
+    void ConnectCollectorsToSteadyStateController(CollectorMap& collectorMap) const;
+
+    /**
+     * @brief Connect a trace sink to a trace source of a source object, e.g.,
+     *        an application, and remember the connection.
+     * @param object the object owning the trace source.
+     * @param traceSourceName the name of the trace source.
+     * @param callback the trace sink.
+     * @return true if the object has the given trace source, otherwise false.
+     *
+     * Child classes are expected to use this method instead of
+     * `TraceConnectWithoutContext` for every connection from outside of the
+     * statistics framework, so that SetEnabled() is able to disconnect and
+     * reconnect them. When the helper is disabled, the connection is only
+     * remembered.
+     */
+    bool ConnectTraceSource(Ptr<Object> object,
+                            std::string traceSourceName,
+                            const CallbackBase& callback);
+
+    /**
+     * @brief Ask a SharedAppProbe to attach a TrafficTimeTag to the packets
+     *        transmitted by its application, and remember the request.
+     * @param probe the probe of a sending application.
+     *
+     * Like the connections made by ConnectTraceSource(), the request is
+     * released when the helper is disabled, and made again when the helper
+     * is enabled.
+     */
+    void RequestTimeTag(Ptr<SharedAppProbe> probe);
+
+    /**
+     * @brief Ask a SharedAppProbe to attach a SourceIdTag to the packets
+     *        transmitted by its application, and remember the request.
+     * @param probe the probe of a sending application.
+     *
+     * See RequestTimeTag().
+     */
+    void RequestSourceIdTag(Ptr<SharedAppProbe> probe);
+
+    /**
+     * @brief Count a received packet which is discarded because it has no
+     *        SourceIdTag.
+     * @param packet the received packet.
+     *
+     * A warning is logged for the first packet only. SourceIdTag is a packet
+     * tag, so it is lost when, e.g., TCP segments and reassembles the payload.
+     */
+    void DiscardUntaggedPacket(Ptr<const Packet> packet);
+
+    /**
+     * @brief Find the identifier of an application.
+     * @param nodeId the ID of the node owning the application.
+     * @param applicationIndex the index of the application within the node.
+     * @return the identifier, or #INVALID_IDENTIFIER if the application does
+     *         not belong to any identifier, e.g., the node is not installed,
+     *         the index is beyond the applications of the node at
+     *         installation, the grouping callback excluded it, or
+     *         `IDENTIFIER_FLOW` is used.
+     *
+     * The result is read from the identifier table which is built by
+     * Install() before DoInstall() is invoked.
+     */
+    uint32_t GetApplicationIdentifier(uint32_t nodeId, uint32_t applicationIndex) const;
+
+    /**
+     * @brief Find the identifier of the sender of a packet, in constant time.
+     * @param tag the SourceIdTag attached to the packet by its sender.
+     * @return the identifier, or #INVALID_IDENTIFIER if the sender does not
+     *         belong to any identifier.
+     *
+     * A tag with SourceIdTag::ANY_APPLICATION identifies a node rather than
+     * an application, so it is resolved only with `IDENTIFIER_GLOBAL` and
+     * `IDENTIFIER_NODE`.
+     */
+    uint32_t GetSourceIdentifier(const SourceIdTag& tag) const;
+
+    /**
+     * @brief Find the identifier of a flow, in constant time.
+     * @param flow the 5-tuple of a received packet.
+     * @return the identifier of the flow, or #INVALID_IDENTIFIER if the flow
+     *         has not been given to AddFlow().
+     *
+     * A flow given to AddFlow() with a zero source port matches the tuple
+     * when no flow with the exact source port exists.
+     */
+    uint32_t GetFlowIdentifier(const FlowTuple_t& flow) const;
+
+    /**
+     * @brief Fill the destination half of the 5-tuple of the packets received
+     *        by an application.
+     * @param application a receiving application, e.g., a PacketSink.
+     * @param flow the tuple whose destination address, destination port, and
+     *             protocol are filled.
+     * @return true if the application has an IPv4 local address (its `Local`
+     *         or `Port` attribute), otherwise false.
+     *
+     * The protocol is taken from the `Protocol` attribute, if any. A wildcard
+     * local address is replaced with the address of the node which the flows
+     * given to AddFlow() with the same port and protocol are sent to, or with
+     * the first non-loopback address of the node if there is no such flow.
+     *
+     * @note The packets received by a wildcard local address carry only the
+     *       sender's address. When the flows are sent to more than one
+     *       address of the node, only the first address is matched and a
+     *       warning is logged.
+     */
+    bool GetFlowDestination(Ptr<Application> application, FlowTuple_t& flow) const;
+
     /**
      * @brief Get nodes installed to this helper instance.
      * @return nodes installed
@@ -318,8 +661,116 @@ class StatsHelper : public Object
     IdentifierType_t m_identifierType; ///< Identifier type
     OutputType_t m_outputType;         ///< Output type
     bool m_isInstalled;                ///< Installation status
+    bool m_isEnabled;                  ///< `Enabled` attribute.
+    bool m_identifyBySender;           ///< `IdentifyBySender` attribute.
     NodeContainer m_nodes;             ///< Nodes to which statistics collectors are installed
 
+    /// Controller receiving the output of the collectors, if any.
+    Ptr<SteadyStateController> m_steadyStateController;
+
+    Time m_memoryUsageInterval; ///< `MemoryUsageInterval` attribute.
+    EventId m_memoryUsageEvent; ///< The next firing of `MemoryUsage`.
+
+    /// `MemoryUsage` trace source.
+    TracedCallback<uint64_t> m_memoryUsageTrace;
+
+    /// Fire the `MemoryUsage` trace source and schedule the next firing.
+    void FireMemoryUsage();
+
+    /**
+     * @brief Build the identifier table for the installed nodes according to
+     *        the current identifier type.
+     */
+    void BuildIdentifierTable();
+
+    /// An entry in the identifier table.
+    struct IdentifierEntry_t
+    {
+        uint32_t identifier; ///< The identifier, i.e., the key of the collector.
+        std::string name;    ///< The name of the collector.
+    };
+
+    /// Hash function of a flow's 5-tuple.
+    struct FlowTupleHash_t
+    {
+        /**
+         * @param flow a flow.
+         * @return the hash value of the flow.
+         */
+        std::size_t operator()(const FlowTuple_t& flow) const;
+    };
+
+    /// Every identifier of the current identifier type, in creation order.
+    std::vector<IdentifierEntry_t> m_identifierTable;
+
+    /// Offset of each node (by node ID) within #m_applicationIdentifiers.
+    std::vector<uint32_t> m_nodeOffsets;
+
+    /// Number of applications of each node (by node ID) within #m_applicationIdentifiers.
+    std::vector<uint32_t> m_nodeNumOfApplications;
+
+    /// Identifier of each application of the installed nodes.
+    std::vector<uint32_t> m_applicationIdentifiers;
+
+    /// Flows given to AddFlow().
+    std::vector<FlowTuple_t> m_flows;
+
+    /// Identifier of each flow given to AddFlow().
+    std::unordered_map<FlowTuple_t, uint32_t, FlowTupleHash_t> m_flowIdentifiers;
+
+    /// Assigns applications to groups with `IDENTIFIER_GROUP`.
+    GroupingCallback m_groupingCallback;
+
+    /**
+     * @brief Connect a trace sink to a trace source of an object, through
+     *        SharedAppProbe::ConnectSink() if the object is a SharedAppProbe.
+     * @param object the object owning the trace source.
+     * @param traceSourceName the name of the trace source.
+     * @param callback the trace sink.
+     * @return true if the object has the given trace source, otherwise false.
+     */
+    static bool ConnectTraceSink(Ptr<Object> object,
+                                 std::string traceSourceName,
+                                 const CallbackBase& callback);
+
+    /**
+     * @brief Disconnect a trace sink connected by ConnectTraceSink().
+     * @param object the object owning the trace source.
+     * @param traceSourceName the name of the trace source.
+     * @param callback the trace sink.
+     * @return true if the object has the given trace source, otherwise false.
+     */
+    static bool DisconnectTraceSink(Ptr<Object> object,
+                                    std::string traceSourceName,
+                                    const CallbackBase& callback);
+
+    /// A connection made by ConnectTraceSource().
+    struct TraceSourceConnection_t
+    {
+        Ptr<Object> object;          ///< The object owning the trace source.
+        std::string traceSourceName; ///< The name of the trace source.
+        CallbackBase callback;       ///< The trace sink.
+    };
+
+    /// Connections to the source objects, toggled by SetEnabled().
+    std::list<TraceSourceConnection_t> m_traceSourceConnections;
+
+    /// A request made by RequestTimeTag() or RequestSourceIdTag().
+    struct TagRequest_t
+    {
+        Ptr<SharedAppProbe> probe; ///< The probe of the sending application.
+        bool isSourceIdTag;        ///< Whether SourceIdTag or TrafficTimeTag is requested.
+    };
+
+    /// Tagging requests to the shared probes, toggled by SetEnabled().
+    std::list<TagRequest_t> m_tagRequests;
+
+    /// Number of packets discarded by DiscardUntaggedPacket().
+    uint64_t m_numOfUntaggedPackets;
+
+    /// Number of bytes discarded by DiscardUntaggedPacket().
+    uint64_t m_untaggedBytes;
+
 }; // end of class StatsHelper
 
 } // end of namespace ns3
@@ -26,22 +26,29 @@
 #include "ns3/application.h"
 #include "ns3/boolean.h"
 #include "ns3/callback.h"
+#include "ns3/collector-bank.h"
+#include "ns3/collector-state.h"
 #include "ns3/data-collection-object.h"
 #include "ns3/distribution-collector.h"
+#include "ns3/double.h"
 #include "ns3/enum.h"
 #include "ns3/inet-socket-address.h"
+#include "ns3/interval-rate-collector-group.h"
 #include "ns3/interval-rate-collector.h"
 #include "ns3/ipv4.h"
 #include "ns3/log.h"
 #include "ns3/mac48-address.h"
 #include "ns3/magister-gnuplot-aggregator.h"
+#include "ns3/memory-usage.h"
 #include "ns3/multi-file-aggregator.h"
 #include "ns3/net-device.h"
 #include "ns3/node-container.h"
 #include "ns3/packet.h"
 #include "ns3/probe.h"
 #include "ns3/scalar-collector.h"
+#include "ns3/shared-app-probe.h"
 #include "ns3/singleton.h"
+#include "ns3/source-id-tag.h"
 #include "ns3/string.h"
 #include "ns3/unit-conversion-collector.h"
 
@@ -54,11 +61,30 @@ NS_LOG_COMPONENT_DEFINE("StatsThroughputHelper");
 namespace ns3
 {
 
+/// The conversion applied to the received bytes before they are reported.
+static const UnitConversionCollector::ConversionType_t THROUGHPUT_CONVERSION =
+    UnitConversionCollector::FROM_BYTES_TO_KBIT;
+
+/**
+ * @return the label of the throughput column (e.g., `throughput_kbps`), built
+ *         from the output unit of #THROUGHPUT_CONVERSION per second.
+ */
+static std::string
+GetThroughputLabel()
+{
+    // The bit unit becomes a rate by replacing "bit" with "bps", e.g., "kbit" to "kbps".
+    const std::string unitName =
+        UnitConversionCollector::GetConversionUnitName(THROUGHPUT_CONVERSION);
+    NS_ASSERT(unitName.size() >= 3 && unitName.compare(unitName.size() - 3, 3, "bit") == 0);
+    return "throughput_" + unitName.substr(0, unitName.size() - 3) + "bps";
+}
+
 NS_OBJECT_ENSURE_REGISTERED(StatsThroughputHelper);
 
 StatsThroughputHelper::StatsThroughputHelper()
     : StatsHelper(),
-      m_averagingMode(false)
+      m_averagingMode(false),
+      m_fusedPipeline(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -80,6 +106,17 @@ StatsThroughputHelper::GetTypeId()
                           BooleanValue(false),
                           MakeBooleanAccessor(&StatsThroughputHelper::SetAveragingMode,
                                               &StatsThroughputHelper::GetAveragingMode),
+                          MakeBooleanChecker())
+            .AddAttribute("FusedPipeline",
+                          "If true, a single CollectorBank replaces the per-identifier "
+                          "conversion and scalar collectors, and receives the packet "
+                          "sizes directly from the probes. The conversion from bytes "
+                          "to kilobits is applied once to the output instead of to "
+                          "every sample. Only affects the scalar file output type, "
+                          "and is ignored when a steady-state controller is set.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&StatsThroughputHelper::SetFusedPipeline,
+                                              &StatsThroughputHelper::GetFusedPipeline),
                           MakeBooleanChecker());
     return tid;
 }
@@ -97,11 +134,126 @@ StatsThroughputHelper::GetAveragingMode() const
     return m_averagingMode;
 }
 
+void
+StatsThroughputHelper::SetFusedPipeline(bool fusedPipeline)
+{
+    NS_LOG_FUNCTION(this << fusedPipeline);
+    m_fusedPipeline = fusedPipeline;
+}
+
+bool
+StatsThroughputHelper::GetFusedPipeline() const
+{
+    return m_fusedPipeline;
+}
+
+uint64_t
+StatsThroughputHelper::DoGetMemoryUsage() const
+{
+    uint64_t usage = sizeof(StatsThroughputHelper) - sizeof(StatsHelper);
+    usage += m_conversionCollectors.GetMemoryUsage() + m_terminalCollectors.GetMemoryUsage();
+    usage += MemoryUsage::GetObjectUsage(m_averagingCollector);
+    usage += MemoryUsage::GetObjectUsage(m_aggregator);
+    usage += MemoryUsage::GetObjectUsage(m_collectorBank);
+    usage += m_identifierMap.GetMemoryUsage();
+    usage += MemoryUsage::GetTreeUsage(m_bankIndices.size(),
+                                       sizeof(std::map<uint32_t, uint32_t>::value_type));
+    usage += MemoryUsage::GetVectorUsage(m_collectorTable);
+    usage += MemoryUsage::GetVectorUsage(m_bankTable);
+
+    if (m_intervalGroup != nullptr)
+    {
+        usage += m_intervalGroup->GetMemoryUsage();
+    }
+
+    return usage;
+}
+
+uint32_t
+StatsThroughputHelper::DoGetSerializedStateSize() const
+{
+    uint32_t size = m_conversionCollectors.GetSerializedStateSize() +
+                    m_terminalCollectors.GetSerializedStateSize();
+    size += CollectorState::GetSerializedSize(m_averagingCollector);
+    size += CollectorState::GetSerializedSize(m_aggregator);
+    size += CollectorState::GetSerializedSize(m_collectorBank);
+    size += 1;
+
+    if (m_intervalGroup != nullptr)
+    {
+        size += m_intervalGroup->GetSerializedStateSize();
+    }
+
+    return size;
+}
+
+void
+StatsThroughputHelper::DoSerializeState(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    m_conversionCollectors.SerializeState(i);
+    i.Next(m_conversionCollectors.GetSerializedStateSize());
+    m_terminalCollectors.SerializeState(i);
+    i.Next(m_terminalCollectors.GetSerializedStateSize());
+    CollectorState::Serialize(m_averagingCollector, i);
+    i.Next(CollectorState::GetSerializedSize(m_averagingCollector));
+    CollectorState::Serialize(m_aggregator, i);
+    i.Next(CollectorState::GetSerializedSize(m_aggregator));
+    CollectorState::Serialize(m_collectorBank, i);
+    i.Next(CollectorState::GetSerializedSize(m_collectorBank));
+
+    i.WriteU8(m_intervalGroup != nullptr ? 1 : 0);
+    if (m_intervalGroup != nullptr)
+    {
+        m_intervalGroup->SerializeState(i);
+    }
+}
+
+uint32_t
+StatsThroughputHelper::DoDeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this);
+    Buffer::Iterator i = start;
+    i.Next(m_conversionCollectors.DeserializeState(i));
+    i.Next(m_terminalCollectors.DeserializeState(i));
+    i.Next(CollectorState::Deserialize(m_averagingCollector, i));
+    i.Next(CollectorState::Deserialize(m_aggregator, i));
+    i.Next(CollectorState::Deserialize(m_collectorBank, i));
+
+    const bool hasIntervalGroup = (i.ReadU8() != 0);
+    if (hasIntervalGroup != (m_intervalGroup != nullptr))
+    {
+        NS_FATAL_ERROR("The saved state does not match the interval group of helper "
+                       << GetName());
+    }
+    if (m_intervalGroup != nullptr)
+    {
+        i.Next(m_intervalGroup->DeserializeState(i));
+    }
+
+    return i.GetDistanceFrom(start);
+}
+
 void
 StatsThroughputHelper::DoInstall()
 {
     NS_LOG_FUNCTION(this);
 
+    if (m_fusedPipeline && GetOutputType() != StatsHelper::OUTPUT_SCALAR_FILE)
+    {
+        NS_LOG_WARN(this << " fused pipeline is not supported by "
+                         << GetOutputTypeName(GetOutputType()) << ", ignoring it");
+    }
+
+    // The collector bank has no collector the steady-state controller can read.
+    bool isFused = m_fusedPipeline;
+    if (isFused && GetSteadyStateController() != nullptr)
+    {
+        NS_LOG_WARN(this << " fused pipeline is not supported together with a"
+                         << " steady-state controller, ignoring it");
+        isFused = false;
+    }
+
     switch (GetOutputType())
     {
     case StatsHelper::OUTPUT_NONE:
@@ -119,7 +271,24 @@ StatsThroughputHelper::DoInstall()
                                         "EnableContextPrinting",
                                         BooleanValue(true),
                                         "GeneralHeading",
-                                        StringValue(GetIdentifierHeading("throughput_kbps")));
+                                        StringValue(GetIdentifierHeading(GetThroughputLabel())));
+
+        if (isFused)
+        {
+            // Setup a single collector bank, converting bytes to kilobits at output.
+            m_collectorBank = CreateObject<CollectorBank>();
+            m_collectorBank->SetOutputType(ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND);
+            m_collectorBank->SetScale(
+                UnitConversionCollector::GetConversionScale(THROUGHPUT_CONVERSION));
+            CreateIdentifierPerBank(m_collectorBank, m_bankIndices);
+            Ptr<MultiFileAggregator> fileAggregator =
+                m_aggregator->GetObject<MultiFileAggregator>();
+            NS_ASSERT(fileAggregator != nullptr);
+            m_collectorBank->TraceConnectWithoutContext(
+                "Output",
+                MakeCallback(&MultiFileAggregator::Write1d, fileAggregator));
+            break;
+        }
 
         // Setup second-level collectors.
         m_terminalCollectors.SetType("ns3::ScalarCollector");
@@ -128,6 +297,9 @@ StatsThroughputHelper::DoInstall()
         m_terminalCollectors.SetAttribute(
             "OutputType",
             EnumValue(ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND));
+        m_terminalCollectors.SetAttribute(
+            "Scale",
+            DoubleValue(UnitConversionCollector::GetConversionScale(THROUGHPUT_CONVERSION)));
         CreateCollectorPerIdentifier(m_terminalCollectors);
         m_terminalCollectors.ConnectToAggregator("Output",
                                                  m_aggregator,
@@ -135,8 +307,9 @@ StatsThroughputHelper::DoInstall()
 
         // Setup first-level collectors.
         m_conversionCollectors.SetType("ns3::UnitConversionCollector");
-        m_conversionCollectors.SetAttribute("ConversionType",
-                                            EnumValue(UnitConversionCollector::FROM_BYTES_TO_KBIT));
+        m_conversionCollectors.SetAttribute("ConversionType", EnumValue(THROUGHPUT_CONVERSION));
+        // The conversion is completed by the second-level collectors.
+        m_conversionCollectors.SetAttribute("DeferLinearConversion", BooleanValue(true));
         CreateCollectorPerIdentifier(m_conversionCollectors);
         m_conversionCollectors.ConnectToCollector("Output",
                                                   m_terminalCollectors,
@@ -150,13 +323,17 @@ StatsThroughputHelper::DoInstall()
                                         "OutputFileName",
                                         StringValue(GetOutputFileName()),
                                         "GeneralHeading",
-                                        StringValue(GetTimeHeading("throughput_kbps")));
+                                        StringValue(GetTimeHeading(GetThroughputLabel())));
 
         // Setup second-level collectors.
         m_terminalCollectors.SetType("ns3::IntervalRateCollector");
         m_terminalCollectors.SetAttribute("InputDataType",
                                           EnumValue(IntervalRateCollector::INPUT_DATA_TYPE_DOUBLE));
+        m_terminalCollectors.SetAttribute(
+            "Scale",
+            DoubleValue(UnitConversionCollector::GetConversionScale(THROUGHPUT_CONVERSION)));
         CreateCollectorPerIdentifier(m_terminalCollectors);
+        CreateIntervalGroup();
         m_terminalCollectors.ConnectToAggregator("OutputWithTime",
                                                  m_aggregator,
                                                  &MultiFileAggregator::Write2d);
@@ -166,8 +343,9 @@ StatsThroughputHelper::DoInstall()
 
         // Setup first-level collectors.
         m_conversionCollectors.SetType("ns3::UnitConversionCollector");
-        m_conversionCollectors.SetAttribute("ConversionType",
-                                            EnumValue(UnitConversionCollector::FROM_BYTES_TO_KBIT));
+        m_conversionCollectors.SetAttribute("ConversionType", EnumValue(THROUGHPUT_CONVERSION));
+        // The conversion is completed by the second-level collectors.
+        m_conversionCollectors.SetAttribute("DeferLinearConversion", BooleanValue(true));
         CreateCollectorPerIdentifier(m_conversionCollectors);
         m_conversionCollectors.ConnectToCollector("Output",
                                                   m_terminalCollectors,
@@ -192,7 +370,7 @@ StatsThroughputHelper::DoInstall()
                                         "EnableContextPrinting",
                                         BooleanValue(false),
                                         "GeneralHeading",
-                                        StringValue(GetDistributionHeading("throughput_kbps")));
+                                        StringValue(GetDistributionHeading(GetThroughputLabel())));
         Ptr<MultiFileAggregator> fileAggregator = m_aggregator->GetObject<MultiFileAggregator>();
         NS_ASSERT(fileAggregator != nullptr);
 
@@ -230,6 +408,9 @@ StatsThroughputHelper::DoInstall()
         m_terminalCollectors.SetAttribute(
             "OutputType",
             EnumValue(ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND));
+        m_terminalCollectors.SetAttribute(
+            "Scale",
+            DoubleValue(UnitConversionCollector::GetConversionScale(THROUGHPUT_CONVERSION)));
         CreateCollectorPerIdentifier(m_terminalCollectors);
         Callback<void, double> callback =
             MakeCallback(&DistributionCollector::TraceSinkDouble1, m_averagingCollector);
@@ -242,8 +423,9 @@ StatsThroughputHelper::DoInstall()
 
         // Setup first-level collectors.
         m_conversionCollectors.SetType("ns3::UnitConversionCollector");
-        m_conversionCollectors.SetAttribute("ConversionType",
-                                            EnumValue(UnitConversionCollector::FROM_BYTES_TO_KBIT));
+        m_conversionCollectors.SetAttribute("ConversionType", EnumValue(THROUGHPUT_CONVERSION));
+        // The conversion is completed by the second-level collectors.
+        m_conversionCollectors.SetAttribute("DeferLinearConversion", BooleanValue(true));
         CreateCollectorPerIdentifier(m_conversionCollectors);
         m_conversionCollectors.ConnectToCollector("Output",
                                                   m_terminalCollectors,
@@ -276,7 +458,11 @@ StatsThroughputHelper::DoInstall()
         m_terminalCollectors.SetType("ns3::IntervalRateCollector");
         m_terminalCollectors.SetAttribute("InputDataType",
                                           EnumValue(IntervalRateCollector::INPUT_DATA_TYPE_DOUBLE));
+        m_terminalCollectors.SetAttribute(
+            "Scale",
+            DoubleValue(UnitConversionCollector::GetConversionScale(THROUGHPUT_CONVERSION)));
         CreateCollectorPerIdentifier(m_terminalCollectors);
+        CreateIntervalGroup();
         for (CollectorMap::Iterator it = m_terminalCollectors.Begin();
              it != m_terminalCollectors.End();
              ++it)
@@ -290,8 +476,9 @@ StatsThroughputHelper::DoInstall()
 
         // Setup first-level collectors.
         m_conversionCollectors.SetType("ns3::UnitConversionCollector");
-        m_conversionCollectors.SetAttribute("ConversionType",
-                                            EnumValue(UnitConversionCollector::FROM_BYTES_TO_KBIT));
+        m_conversionCollectors.SetAttribute("ConversionType", EnumValue(THROUGHPUT_CONVERSION));
+        // The conversion is completed by the second-level collectors.
+        m_conversionCollectors.SetAttribute("DeferLinearConversion", BooleanValue(true));
         CreateCollectorPerIdentifier(m_conversionCollectors);
         m_conversionCollectors.ConnectToCollector("Output",
                                                   m_terminalCollectors,
@@ -349,6 +536,9 @@ StatsThroughputHelper::DoInstall()
         m_terminalCollectors.SetAttribute(
             "OutputType",
             EnumValue(ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND));
+        m_terminalCollectors.SetAttribute(
+            "Scale",
+            DoubleValue(UnitConversionCollector::GetConversionScale(THROUGHPUT_CONVERSION)));
         CreateCollectorPerIdentifier(m_terminalCollectors);
         Callback<void, double> callback =
             MakeCallback(&DistributionCollector::TraceSinkDouble1, m_averagingCollector);
@@ -361,8 +551,9 @@ StatsThroughputHelper::DoInstall()
 
         // Setup first-level collectors.
         m_conversionCollectors.SetType("ns3::UnitConversionCollector");
-        m_conversionCollectors.SetAttribute("ConversionType",
-                                            EnumValue(UnitConversionCollector::FROM_BYTES_TO_KBIT));
+        m_conversionCollectors.SetAttribute("ConversionType", EnumValue(THROUGHPUT_CONVERSION));
+        // The conversion is completed by the second-level collectors.
+        m_conversionCollectors.SetAttribute("DeferLinearConversion", BooleanValue(true));
         CreateCollectorPerIdentifier(m_conversionCollectors);
         m_conversionCollectors.ConnectToCollector("Output",
                                                   m_terminalCollectors,
@@ -375,9 +566,15 @@ StatsThroughputHelper::DoInstall()
         break;
     }
 
+    // Index the collectors for the receive path.
+    BuildCollectorTable();
+
     // Setup probes and connect them to conversion collectors.
     InstallProbes();
 
+    // Let the steady-state controller monitor the collectors, if requested.
+    ConnectCollectorsToSteadyStateController(m_terminalCollectors);
+
 } // end of `void DoInstall ();`
 
 void
@@ -389,6 +586,37 @@ StatsThroughputHelper::InstallProbes()
     DoInstallProbes();
 }
 
+void
+StatsThroughputHelper::CreateIntervalGroup()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_terminalCollectors.Begin() == m_terminalCollectors.End())
+    {
+        return;
+    }
+
+    // All the collectors are created with the same attributes.
+    Ptr<IntervalRateCollector> first =
+        m_terminalCollectors.Begin()->second->GetObject<IntervalRateCollector>();
+    NS_ASSERT(first != nullptr);
+
+    m_intervalGroup = CreateObject<IntervalRateCollectorGroup>();
+    m_intervalGroup->SetIntervalLength(first->GetIntervalLength());
+
+    for (CollectorMap::Iterator it = m_terminalCollectors.Begin();
+         it != m_terminalCollectors.End();
+         ++it)
+    {
+        Ptr<IntervalRateCollector> collector = it->second->GetObject<IntervalRateCollector>();
+        NS_ASSERT(collector != nullptr);
+        collector->SetIntervalGroup(m_intervalGroup);
+    }
+
+    NS_LOG_INFO(this << " created an interval group of "
+                     << m_intervalGroup->GetNumOfCollectors() << " collectors");
+}
+
 void
 StatsThroughputHelper::RxCallback(Ptr<const Packet> packet, const Address& from)
 {
@@ -403,9 +631,9 @@ StatsThroughputHelper::RxCallback(Ptr<const Packet> packet, const Address& from)
     else
     {
         // Determine the identifier associated with the sender address.
-        std::map<const Address, uint32_t>::const_iterator it = m_identifierMap.find(from);
+        const uint32_t identifier = m_identifierMap.Find(from);
 
-        if (it == m_identifierMap.end())
+        if (identifier == AddressIdentifierMap::NOT_FOUND)
         {
             NS_LOG_WARN(this << " discarding packet " << packet << " (" << packet->GetSize()
                              << " bytes)" << " from statistics collection because of"
@@ -413,20 +641,130 @@ StatsThroughputHelper::RxCallback(Ptr<const Packet> packet, const Address& from)
         }
         else
         {
-            // Find the first-level collector with the right identifier.
-            Ptr<DataCollectionObject> collector = m_conversionCollectors.Get(it->second);
-            NS_ASSERT_MSG(collector != nullptr,
-                          "Unable to find collector with identifier " << it->second);
-            Ptr<UnitConversionCollector> c = collector->GetObject<UnitConversionCollector>();
-            NS_ASSERT(c != nullptr);
-
-            // Pass the sample to the collector.
-            c->TraceSinkUinteger32(0, packet->GetSize());
+            PassSampleToCollector(identifier, packet->GetSize());
         }
     }
 
 } // end of `void RxCallback (Ptr<const Packet>, const Address);`
 
+void
+StatsThroughputHelper::FlowRxCallback(StatsHelper::FlowTuple_t destination,
+                                      Ptr<const Packet> packet,
+                                      const Address& from)
+{
+    NS_LOG_FUNCTION(this << packet->GetSize() << from);
+
+    if (!InetSocketAddress::IsMatchingType(from))
+    {
+        NS_LOG_WARN(this << " discarding packet " << packet << " (" << packet->GetSize()
+                         << " bytes)" << " from statistics collection because of"
+                         << " non-IPv4 sender address " << from);
+        return;
+    }
+
+    const InetSocketAddress source = InetSocketAddress::ConvertFrom(from);
+    destination.sourceAddress = source.GetIpv4();
+    destination.sourcePort = source.GetPort();
+    const uint32_t identifier = GetFlowIdentifier(destination);
+
+    if (identifier == StatsHelper::INVALID_IDENTIFIER)
+    {
+        NS_LOG_INFO(this << " discarding packet " << packet << " (" << packet->GetSize()
+                         << " bytes)" << " of unknown flow " << GetFlowName(destination));
+    }
+    else
+    {
+        PassSampleToCollector(identifier, packet->GetSize());
+    }
+
+} // end of `void FlowRxCallback (FlowTuple_t, Ptr<const Packet>, const Address);`
+
+void
+StatsThroughputHelper::SourceIdRxCallback(Ptr<const Packet> packet, const Address& from)
+{
+    // NS_LOG_FUNCTION (this << packet->GetSize () << from);
+
+    SourceIdTag tag;
+    if (!packet->PeekPacketTag(tag))
+    {
+        DiscardUntaggedPacket(packet);
+        return;
+    }
+
+    const uint32_t identifier = GetSourceIdentifier(tag);
+
+    if (identifier == StatsHelper::INVALID_IDENTIFIER)
+    {
+        NS_LOG_INFO(this << " discarding packet " << packet << " (" << packet->GetSize()
+                         << " bytes)" << " from statistics collection because of"
+                         << " unknown sender " << tag.GetNodeId() << "-"
+                         << tag.GetApplicationIndex());
+    }
+    else
+    {
+        PassSampleToCollector(identifier, packet->GetSize());
+    }
+
+} // end of `void SourceIdRxCallback (Ptr<const Packet>, const Address);`
+
+void
+StatsThroughputHelper::PassSampleToCollector(uint32_t identifier, uint32_t bytes)
+{
+    // NS_LOG_FUNCTION (this << identifier << bytes);
+
+    if (m_collectorBank != nullptr)
+    {
+        // Pass the sample directly to the fused pipeline.
+        NS_ASSERT_MSG(identifier < m_bankTable.size() &&
+                          m_bankTable[identifier] != StatsHelper::INVALID_IDENTIFIER,
+                      "Unable to find collector with identifier " << identifier);
+        m_collectorBank->TraceSinkUinteger32(m_bankTable[identifier], 0, bytes);
+    }
+    else
+    {
+        // Pass the sample to the first-level collector with the right identifier.
+        NS_ASSERT_MSG(identifier < m_collectorTable.size() &&
+                          m_collectorTable[identifier] != nullptr,
+                      "Unable to find collector with identifier " << identifier);
+        m_collectorTable[identifier]->TraceSinkUinteger32(0, bytes);
+    }
+}
+
+void
+StatsThroughputHelper::BuildCollectorTable()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_collectorTable.clear();
+    m_bankTable.clear();
+
+    for (std::map<uint32_t, uint32_t>::const_iterator it = m_bankIndices.begin();
+         it != m_bankIndices.end();
+         ++it)
+    {
+        if (it->first >= m_bankTable.size())
+        {
+            m_bankTable.resize(it->first + 1, StatsHelper::INVALID_IDENTIFIER);
+        }
+        m_bankTable[it->first] = it->second;
+    }
+
+    for (CollectorMap::Iterator it = m_conversionCollectors.Begin();
+         it != m_conversionCollectors.End();
+         ++it)
+    {
+        if (it->first >= m_collectorTable.size())
+        {
+            m_collectorTable.resize(it->first + 1);
+        }
+        m_collectorTable[it->first] = it->second->GetObject<UnitConversionCollector>();
+        NS_ASSERT(m_collectorTable[it->first] != nullptr);
+    }
+
+    NS_LOG_INFO(this << " indexed " << m_collectorTable.size() << " collector(s) and "
+                     << m_bankTable.size() << " bank index(es)");
+}
+
 // APPLICATION-LEVEL /////////////////////////////////////////////
 
 NS_OBJECT_ENSURE_REGISTERED(StatsAppThroughputHelper);
@@ -449,6 +787,21 @@ StatsAppThroughputHelper::GetTypeId()
     return tid;
 }
 
+uint64_t
+StatsAppThroughputHelper::DoGetMemoryUsage() const
+{
+    uint64_t usage = StatsThroughputHelper::DoGetMemoryUsage();
+    usage += sizeof(StatsAppThroughputHelper) - sizeof(StatsThroughputHelper);
+    usage += MemoryUsage::GetListUsage(m_probes.size(), sizeof(Ptr<Probe>));
+
+    for (const Ptr<Probe>& probe : m_probes)
+    {
+        usage += MemoryUsage::GetObjectUsage(probe);
+    }
+
+    return usage;
+}
+
 void
 StatsAppThroughputHelper::DoInstallProbes()
 {
@@ -458,23 +811,97 @@ StatsAppThroughputHelper::DoInstallProbes()
     for (NodeContainer::Iterator it = nodes.Begin(); it != nodes.End(); ++it)
     {
         const int32_t id = (*it)->GetId();
-        uint32_t identifier = 0;
-        if (GetIdentifierType() == StatsHelper::IDENTIFIER_NODE)
-        {
-            identifier = id;
-        }
 
         for (uint32_t i = 0; i < (*it)->GetNApplications(); i++)
         {
+            // The application's trace sources are shared with the other helpers.
+            Ptr<SharedAppProbe> shared = SharedAppProbe::Get((*it)->GetApplication(i));
+
+            if (GetIdentifierType() == StatsHelper::IDENTIFIER_FLOW)
+            {
+                // The identifier is determined for each packet.
+                StatsHelper::FlowTuple_t destination;
+                if (shared->HasRxTraceSource() &&
+                    GetFlowDestination((*it)->GetApplication(i), destination) &&
+                    ConnectTraceSource(shared,
+                                       "Rx",
+                                       MakeCallback(&StatsThroughputHelper::FlowRxCallback, this)
+                                           .Bind(destination)))
+                {
+                    NS_LOG_INFO(this << " connected to Rx of node ID " << id << " application #"
+                                     << i << " for flows towards "
+                                     << destination.destinationAddress << ":"
+                                     << destination.destinationPort);
+                }
+                else
+                {
+                    NS_LOG_WARN(this << " unable to connect to Rx of node ID " << id
+                                     << " application #" << i);
+                }
+                continue;
+            }
+
+            if (GetIdentifyBySender())
+            {
+                // Request the sent packets to be tagged with their sender.
+                if (shared->HasTxTraceSource())
+                {
+                    RequestSourceIdTag(shared);
+                }
+
+                // The identifier of the sender is determined for each packet.
+                if (shared->HasRxTraceSource() &&
+                    ConnectTraceSource(
+                        shared,
+                        "Rx",
+                        MakeCallback(&StatsThroughputHelper::SourceIdRxCallback, this)))
+                {
+                    NS_LOG_INFO(this << " connected to Rx of node ID " << id << " application #"
+                                     << i << " for identification by sender");
+                }
+                else
+                {
+                    NS_LOG_INFO(this << " unable to connect to Rx of node ID " << id
+                                     << " application #" << i);
+                }
+                continue;
+            }
+
+            const uint32_t identifier = GetApplicationIdentifier(id, i);
+            if (identifier == StatsHelper::INVALID_IDENTIFIER)
+            {
+                NS_LOG_INFO(this << " skipping node ID " << id << " application #" << i);
+                continue;
+            }
+
             // Create the probe.
             std::ostringstream probeName;
             probeName << id << "-" << i;
             Ptr<ApplicationPacketProbe> probe = CreateObject<ApplicationPacketProbe>();
             probe->SetName(probeName.str());
 
-            // Connect the object to the probe.
-            if (probe->ConnectByObject("Rx", (*it)->GetApplication(i)))
+            // Connect the object to the probe, so that it can be disabled.
+            if (shared->HasRxTraceSource() &&
+                ConnectTraceSource(shared,
+                                   "Rx",
+                                   MakeCallback(&ApplicationPacketProbe::SetValue, probe)))
             {
+                if (m_collectorBank != nullptr)
+                {
+                    // Connect the probe directly to the fused pipeline.
+                    std::map<uint32_t, uint32_t>::const_iterator it2 =
+                        m_bankIndices.find(identifier);
+                    NS_ASSERT_MSG(it2 != m_bankIndices.end(),
+                                  "Unable to find collector with identifier " << identifier);
+                    probe->TraceConnectWithoutContext(
+                        "OutputBytes",
+                        m_collectorBank->GetTraceSinkUinteger32(it2->second));
+                    NS_LOG_INFO(this << " created probe " << probeName.str()
+                                     << ", connected to collector bank " << identifier);
+                    m_probes.push_back(probe->GetObject<Probe>());
+                    continue;
+                }
+
                 // Connect the probe to the right collector.
                 if (m_conversionCollectors.ConnectWithProbe(
                         probe->GetObject<Probe>(),
@@ -25,12 +25,14 @@
 
 #include "stats-helper.h"
 
+#include "ns3/address-identifier-map.h"
 #include "ns3/address.h"
 #include "ns3/collector-map.h"
 #include "ns3/ptr.h"
 
 #include <list>
 #include <map>
+#include <vector>
 
 namespace ns3
 {
@@ -39,8 +41,11 @@ namespace ns3
 
 class Node;
 class Packet;
+class CollectorBank;
 class DataCollectionObject;
 class DistributionCollector;
+class IntervalRateCollectorGroup;
+class UnitConversionCollector;
 
 /**
  * @ingroup stats
@@ -72,6 +77,17 @@ class StatsThroughputHelper : public StatsHelper
      */
     bool GetAveragingMode() const;
 
+    /**
+     * @param fusedPipeline whether to replace the conversion and scalar
+     *                      collectors by a single CollectorBank.
+     */
+    void SetFusedPipeline(bool fusedPipeline);
+
+    /**
+     * @return whether the fused pipeline is used.
+     */
+    bool GetFusedPipeline() const;
+
     /**
      * @brief Set up several probes or other means of listeners and connect them
      *        to the first-level collectors.
@@ -89,15 +105,79 @@ class StatsThroughputHelper : public StatsHelper
      */
     void RxCallback(Ptr<const Packet> packet, const Address& from);
 
+    /**
+     * @brief Receive inputs from trace sources of receiving applications and
+     *        determine the right collector from the packet's flow.
+     * @param destination the destination half of the flow's 5-tuple, as
+     *                    determined by StatsHelper::GetFlowDestination().
+     * @param packet received packet data.
+     * @param from the InetSocketAddress of the sender of the packet.
+     *
+     * Used with `IDENTIFIER_FLOW`. Packets of flows which have not been given
+     * to AddFlow() are discarded.
+     */
+    void FlowRxCallback(StatsHelper::FlowTuple_t destination,
+                        Ptr<const Packet> packet,
+                        const Address& from);
+
+    /**
+     * @brief Receive inputs from trace sources and determine the right collector
+     *        from the SourceIdTag of the packet.
+     * @param packet received packet data, expected to have been tagged with
+     *               SourceIdTag by its sender.
+     * @param from the address of the sender of the packet.
+     *
+     * Used when the `IdentifyBySender` attribute is enabled. The identifier is
+     * found by indexing into the identifier table, without any search. Packets
+     * without the tag are discarded, see StatsHelper::DiscardUntaggedPacket().
+     */
+    void SourceIdRxCallback(Ptr<const Packet> packet, const Address& from);
+
   protected:
     // inherited from StatsHelper base class
     void DoInstall();
 
+    // inherited from StatsHelper base class
+    uint64_t DoGetMemoryUsage() const;
+
+    // inherited from StatsHelper base class
+    uint32_t DoGetSerializedStateSize() const;
+
+    // inherited from StatsHelper base class
+    void DoSerializeState(Buffer::Iterator start) const;
+
+    // inherited from StatsHelper base class
+    uint32_t DoDeserializeState(Buffer::Iterator start);
+
     /**
      * @brief Install probes to trace sources. Implemented by child classes.
      */
     virtual void DoInstallProbes() = 0;
 
+    /**
+     * @brief Let the second-level collectors, which must be
+     *        IntervalRateCollector instances, share a single interval clock.
+     *
+     * The interval length of the group is taken from the collectors.
+     */
+    void CreateIntervalGroup();
+
+    /**
+     * @brief Find a first-level collector (or the collector bank) with the
+     *        right identifier and pass a sample data to it.
+     * @param identifier the identifier of the collector.
+     * @param bytes the size of the received packet.
+     */
+    void PassSampleToCollector(uint32_t identifier, uint32_t bytes);
+
+    /**
+     * @brief Index the first-level collectors (or their indices within the
+     *        collector bank) by identifier, for PassSampleToCollector().
+     *
+     * Invoked by DoInstall() after the collectors are created.
+     */
+    void BuildCollectorTable();
+
     /// Maintains a list of first-level collectors created by this helper.
     CollectorMap m_conversionCollectors;
 
@@ -110,11 +190,27 @@ class StatsThroughputHelper : public StatsHelper
     /// The aggregator created by this helper.
     Ptr<DataCollectionObject> m_aggregator;
 
+    /// The shared interval clock of the second-level collectors (scatter output only).
+    Ptr<IntervalRateCollectorGroup> m_intervalGroup;
+
     /// Map of address and the identifier associated with it (for return link).
-    std::map<const Address, uint32_t> m_identifierMap;
+    AddressIdentifierMap m_identifierMap;
+
+    /// Converts and accumulates all identifiers in the fused pipeline (scalar output only).
+    Ptr<CollectorBank> m_collectorBank;
+
+    /// Map of identifier and its index within #m_collectorBank.
+    std::map<uint32_t, uint32_t> m_bankIndices;
+
+    /// First-level collector of each identifier, indexed by identifier.
+    std::vector<Ptr<UnitConversionCollector>> m_collectorTable;
+
+    /// Index within #m_collectorBank of each identifier, indexed by identifier.
+    std::vector<uint32_t> m_bankTable;
 
   private:
     bool m_averagingMode; ///< `AveragingMode` attribute.
+    bool m_fusedPipeline; ///< `FusedPipeline` attribute.
 
 }; // end of class StatsThroughputHelper
 
@@ -156,6 +252,9 @@ class StatsAppThroughputHelper : public StatsThroughputHelper
     // inherited from StatsThroughputHelper base class
     void DoInstallProbes();
 
+    // inherited from StatsHelper base class
+    uint64_t DoGetMemoryUsage() const;
+
   private:
     /// Maintains a list of probes created by this helper.
     std::list<Ptr<Probe>> m_probes;
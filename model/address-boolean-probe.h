@@ -29,9 +29,10 @@
 #ifndef ADDRESS_BOOLEAN_PROBE_H
 #define ADDRESS_BOOLEAN_PROBE_H
 
+#include "typed-probe.h"
+
 #include "ns3/address.h"
 #include "ns3/nstime.h"
-#include "ns3/probe.h"
 #include "ns3/traced-callback.h"
 
 #include <string>
@@ -49,52 +50,17 @@ namespace ns3
  * The trace sources emit values when either the probed trace source emits a
  * new value, or when SetValue () is called.
  */
-class AddressBooleanProbe : public Probe
+class AddressBooleanProbe : public TypedProbe<bool, const Address&>
 {
   public:
+    /// Creates a new probe.
+    AddressBooleanProbe();
+
     /**
      * @brief Get the type ID.
      * @return the object TypeId
      */
     static TypeId GetTypeId();
-    AddressBooleanProbe();
-    virtual ~AddressBooleanProbe();
-
-    /**
-     * @brief Set a probe value
-     *
-     * @param booleanValue set the traced boolean equal to this
-     * @param address set the socket address for the traced packet equal to this
-     */
-    void SetValue(bool booleanValue, const Address& address);
-
-    /**
-     * @brief Set a probe value by its name in the Config system
-     *
-     * @param path config path to access the probe
-     * @param booleanValue set the traced boolean equal to this
-     * @param address set the socket address for the traced packet equal to this
-     */
-    static void SetValueByPath(std::string path, bool booleanValue, const Address& address);
-
-    /**
-     * @brief connect to a trace source attribute provided by a given object
-     *
-     * @param traceSource the name of the attribute TraceSource to connect to
-     * @param obj ns3::Object to connect to
-     * @return true if the trace source was successfully connected
-     */
-    virtual bool ConnectByObject(std::string traceSource, Ptr<Object> obj);
-
-    /**
-     * @brief connect to a trace source provided by a config path
-     *
-     * @param path Config path to bind to
-     *
-     * Note, if an invalid path is provided, the probe will not be connected
-     * to anything.
-     */
-    virtual void ConnectByPath(std::string path);
 
     /**
      * @brief Callback signature for boolean and address.
@@ -113,28 +79,7 @@ class AddressBooleanProbe : public Probe
      */
     typedef void (*BooleanCallback)(bool oldValue, bool newValue);
 
-  private:
-    /**
-     * @brief Method to connect to an underlying ns3::TraceSource with
-     * arguments of type bool value and const Address&
-     *
-     * @param booleanValue the traced boolean
-     * @param address the socket address for the traced packet
-     *
-     */
-    void TraceSink(bool booleanValue, const Address& address);
-
-    /// Output trace, the boolean and source address
-    TracedCallback<bool, const Address&> m_output;
-    /// Output trace, previous value and current value
-    TracedCallback<bool, bool> m_outputBoolean;
-
-    /// The traced boolean.
-    bool m_booleanValue;
-
-    /// The socket address for the traced packet.
-    Address m_address;
-};
+}; // end of class AddressBooleanProbe
 
 } // namespace ns3
 
@@ -29,9 +29,10 @@
 #ifndef ADDRESS_DOUBLE_PROBE_H
 #define ADDRESS_DOUBLE_PROBE_H
 
+#include "typed-probe.h"
+
 #include "ns3/address.h"
 #include "ns3/nstime.h"
-#include "ns3/probe.h"
 #include "ns3/traced-callback.h"
 
 #include <string>
@@ -49,52 +50,17 @@ namespace ns3
  * The trace sources emit values when either the probed trace source emits a
  * new value, or when SetValue () is called.
  */
-class AddressDoubleProbe : public Probe
+class AddressDoubleProbe : public TypedProbe<double, const Address&>
 {
   public:
+    /// Creates a new probe.
+    AddressDoubleProbe();
+
     /**
      * @brief Get the type ID.
      * @return the object TypeId
      */
     static TypeId GetTypeId();
-    AddressDoubleProbe();
-    virtual ~AddressDoubleProbe();
-
-    /**
-     * @brief Set a probe value
-     *
-     * @param doubleValue set the traced double equal to this
-     * @param address set the socket address for the traced packet equal to this
-     */
-    void SetValue(double doubleValue, const Address& address);
-
-    /**
-     * @brief Set a probe value by its name in the Config system
-     *
-     * @param path config path to access the probe
-     * @param doubleValue set the traced double equal to this
-     * @param address set the socket address for the traced packet equal to this
-     */
-    static void SetValueByPath(std::string path, double doubleValue, const Address& address);
-
-    /**
-     * @brief connect to a trace source attribute provided by a given object
-     *
-     * @param traceSource the name of the attribute TraceSource to connect to
-     * @param obj ns3::Object to connect to
-     * @return true if the trace source was successfully connected
-     */
-    virtual bool ConnectByObject(std::string traceSource, Ptr<Object> obj);
-
-    /**
-     * @brief connect to a trace source provided by a config path
-     *
-     * @param path Config path to bind to
-     *
-     * Note, if an invalid path is provided, the probe will not be connected
-     * to anything.
-     */
-    virtual void ConnectByPath(std::string path);
 
     /**
      * @brief Callback signature for double and address.
@@ -113,28 +79,7 @@ class AddressDoubleProbe : public Probe
      */
     typedef void (*DoubleCallback)(double oldValue, double newValue);
 
-  private:
-    /**
-     * @brief Method to connect to an underlying ns3::TraceSource with
-     * arguments of type double value and const Address&
-     *
-     * @param doubleValue the traced double
-     * @param address the socket address for the traced packet
-     *
-     */
-    void TraceSink(double doubleValue, const Address& address);
-
-    /// Output trace, the double and source address
-    TracedCallback<double, const Address&> m_output;
-    /// Output trace, previous value and current value
-    TracedCallback<double, double> m_outputDouble;
-
-    /// The traced double.
-    double m_doubleValue;
-
-    /// The socket address for the traced packet.
-    Address m_address;
-};
+}; // end of class AddressDoubleProbe
 
 } // namespace ns3
 
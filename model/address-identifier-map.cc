@@ -0,0 +1,190 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "address-identifier-map.h"
+
+#include "memory-usage.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+NS_LOG_COMPONENT_DEFINE("AddressIdentifierMap");
+
+namespace ns3
+{
+
+/// Initial capacity of the hash table, a power of two.
+static const uint32_t INITIAL_CAPACITY = 16;
+
+AddressIdentifierMap::AddressIdentifierMap()
+    : m_entries(INITIAL_CAPACITY),
+      m_size(0),
+      m_lastIdentifier(NOT_FOUND)
+{
+    NS_LOG_FUNCTION(this);
+
+    for (uint32_t i = 0; i < m_entries.size(); i++)
+    {
+        m_entries[i].hash = 0;
+        m_entries[i].identifier = NOT_FOUND;
+    }
+}
+
+uint64_t // static
+AddressIdentifierMap::GetHash(const Address& address)
+{
+    uint8_t buffer[Address::MAX_SIZE + 2];
+    const uint32_t length = address.CopyAllTo(buffer, Address::MAX_SIZE + 2);
+
+    uint64_t hash = 0xcbf29ce484222325ULL; // FNV-1a offset basis
+    for (uint32_t i = 0; i < length; i++)
+    {
+        hash ^= buffer[i];
+        hash *= 0x100000001b3ULL; // FNV-1a prime
+    }
+
+    return hash;
+}
+
+uint32_t
+AddressIdentifierMap::FindSlot(const Address& address, uint64_t hash) const
+{
+    const uint32_t mask = m_entries.size() - 1;
+    uint32_t slot = static_cast<uint32_t>(hash) & mask;
+
+    // The table is never full, so an unused entry ends the probing.
+    while (m_entries[slot].identifier != NOT_FOUND &&
+           (m_entries[slot].hash != hash || !(m_entries[slot].address == address)))
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+void
+AddressIdentifierMap::Insert(const Address& address, uint32_t identifier)
+{
+    NS_LOG_FUNCTION(this << address << identifier);
+    NS_ASSERT_MSG(identifier != NOT_FOUND, "Invalid identifier " << identifier);
+    (*this)[address] = identifier;
+}
+
+uint32_t&
+AddressIdentifierMap::operator[](const Address& address)
+{
+    if (2 * (m_size + 1) > m_entries.size())
+    {
+        Grow();
+    }
+
+    const uint64_t hash = GetHash(address);
+    const uint32_t slot = FindSlot(address, hash);
+
+    if (m_entries[slot].identifier == NOT_FOUND)
+    {
+        m_entries[slot].hash = hash;
+        m_entries[slot].address = address;
+        m_entries[slot].identifier = 0;
+        m_size++;
+    }
+
+    // The cached result may be replaced through the returned reference.
+    m_lastAddress = Address();
+    m_lastIdentifier = NOT_FOUND;
+
+    return m_entries[slot].identifier;
+}
+
+uint32_t
+AddressIdentifierMap::Find(const Address& address) const
+{
+    // NS_LOG_FUNCTION (this << address);
+
+    if (m_lastIdentifier != NOT_FOUND && m_lastAddress == address)
+    {
+        return m_lastIdentifier;
+    }
+
+    const uint32_t slot = FindSlot(address, GetHash(address));
+    const uint32_t identifier = m_entries[slot].identifier;
+
+    if (identifier != NOT_FOUND)
+    {
+        m_lastAddress = address;
+        m_lastIdentifier = identifier;
+    }
+
+    return identifier;
+}
+
+uint32_t
+AddressIdentifierMap::GetSize() const
+{
+    return m_size;
+}
+
+void
+AddressIdentifierMap::Clear()
+{
+    NS_LOG_FUNCTION(this);
+
+    for (uint32_t i = 0; i < m_entries.size(); i++)
+    {
+        m_entries[i].hash = 0;
+        m_entries[i].address = Address();
+        m_entries[i].identifier = NOT_FOUND;
+    }
+
+    m_size = 0;
+    m_lastAddress = Address();
+    m_lastIdentifier = NOT_FOUND;
+}
+
+void
+AddressIdentifierMap::Grow()
+{
+    NS_LOG_FUNCTION(this << m_entries.size());
+
+    std::vector<Entry_t> entries(2 * m_entries.size());
+    for (uint32_t i = 0; i < entries.size(); i++)
+    {
+        entries[i].hash = 0;
+        entries[i].identifier = NOT_FOUND;
+    }
+
+    m_entries.swap(entries);
+
+    for (std::vector<Entry_t>::const_iterator it = entries.begin(); it != entries.end(); ++it)
+    {
+        if (it->identifier != NOT_FOUND)
+        {
+            const uint32_t slot = FindSlot(it->address, it->hash);
+            m_entries[slot] = *it;
+        }
+    }
+}
+
+uint64_t
+AddressIdentifierMap::GetMemoryUsage() const
+{
+    return MemoryUsage::GetVectorUsage(m_entries);
+}
+
+} // end of namespace ns3
@@ -0,0 +1,156 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef ADDRESS_IDENTIFIER_MAP_H
+#define ADDRESS_IDENTIFIER_MAP_H
+
+#include "ns3/address.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup aggregator
+ * @brief Map of addresses and the statistics identifiers associated with
+ *        them, optimized for per-packet lookups.
+ *
+ * Statistics helpers which identify the sender of a packet by its address use
+ * this map to find the identifier. Compared to a `std::map<Address, uint32_t>`,
+ * which performs O(log N) full address comparisons per lookup, the map:
+ * - keeps the entries in an open-addressing hash table with linear probing,
+ *   keyed on a 64-bit FNV-1a hash of the serialized address (type, length,
+ *   and buffer), so that a lookup typically compares a single address, and
+ *   only after the hashes have matched;
+ * - remembers the last address found, so that back-to-back packets from the
+ *   same sender skip the hashing altogether.
+ *
+ * The table is kept at most half full and doubled when needed. Entries cannot
+ * be removed individually, but the whole map can be cleared.
+ *
+ * @code
+ *   AddressIdentifierMap m;
+ *   m.Insert (address, 3);
+ *   uint32_t identifier = m.Find (address); // 3
+ * @endcode
+ *
+ * The map replaces the `std::map<const Address, uint32_t>` which the
+ * statistics helpers used to keep as `m_identifierMap`. Child helpers filling
+ * it with `m_identifierMap[address] = identifier` keep working through
+ * operator[](), but lookups with `find()` and `end()` must be replaced by
+ * Find(), and the map cannot be iterated.
+ */
+class AddressIdentifierMap
+{
+  public:
+    /// Returned by Find() when the address is not in the map.
+    static constexpr uint32_t NOT_FOUND = 0xFFFFFFFF;
+
+    /**
+     * @brief Creates an empty map.
+     */
+    AddressIdentifierMap();
+
+    /**
+     * @brief Associate an address with an identifier, replacing any identifier
+     *        previously associated with it.
+     * @param address the address.
+     * @param identifier the identifier, other than #NOT_FOUND.
+     */
+    void Insert(const Address& address, uint32_t identifier);
+
+    /**
+     * @brief Access the identifier associated with an address, inserting the
+     *        address with identifier 0 if it is not in the map yet, like
+     *        `std::map::operator[]`.
+     * @param address the address.
+     * @return a reference to the identifier, which is valid until the next
+     *         insertion. #NOT_FOUND must not be assigned to it.
+     */
+    uint32_t& operator[](const Address& address);
+
+    /**
+     * @brief Find the identifier associated with an address.
+     * @param address the address.
+     * @return the identifier, or #NOT_FOUND.
+     */
+    uint32_t Find(const Address& address) const;
+
+    /**
+     * @return the number of addresses in the map.
+     */
+    uint32_t GetSize() const;
+
+    /**
+     * @brief Remove all the addresses from the map.
+     */
+    void Clear();
+
+    /**
+     * @return the memory allocated by the map, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * @param address an arbitrary address.
+     * @return the 64-bit FNV-1a hash of the serialized form of the address.
+     */
+    static uint64_t GetHash(const Address& address);
+
+  private:
+    /// An entry of the hash table.
+    struct Entry_t
+    {
+        uint64_t hash;       ///< Hash of #address.
+        Address address;     ///< The address, invalid if the entry is unused.
+        uint32_t identifier; ///< The identifier, #NOT_FOUND if the entry is unused.
+    };
+
+    /**
+     * @param address an address.
+     * @param hash the hash of the address.
+     * @return the index of the entry of the address, or of the unused entry
+     *         where the address would be inserted.
+     */
+    uint32_t FindSlot(const Address& address, uint64_t hash) const;
+
+    /**
+     * @brief Double the capacity of the hash table and re-insert the entries.
+     */
+    void Grow();
+
+    /// The hash table, with a capacity of a power of two.
+    std::vector<Entry_t> m_entries;
+
+    /// Number of used entries of #m_entries.
+    uint32_t m_size;
+
+    /// The address which was found by the latest Find() call.
+    mutable Address m_lastAddress;
+
+    /// The identifier which was found by the latest Find() call.
+    mutable uint32_t m_lastIdentifier;
+
+}; // end of class AddressIdentifierMap
+
+} // end of namespace ns3
+
+#endif /* ADDRESS_IDENTIFIER_MAP_H */
@@ -29,9 +29,10 @@
 #ifndef ADDRESS_TIME_PROBE_H
 #define ADDRESS_TIME_PROBE_H
 
+#include "typed-probe.h"
+
 #include "ns3/address.h"
 #include "ns3/nstime.h"
-#include "ns3/probe.h"
 #include "ns3/traced-callback.h"
 
 #include <string>
@@ -50,52 +51,17 @@ namespace ns3
  * when either the probed trace source emits a new value, or when SetValue ()
  * is called.
  */
-class AddressTimeProbe : public Probe
+class AddressTimeProbe : public TypedProbe<Time, const Address&>
 {
   public:
+    /// Creates a new probe.
+    AddressTimeProbe();
+
     /**
      * @brief Get the type ID.
      * @return the object TypeId
      */
     static TypeId GetTypeId();
-    AddressTimeProbe();
-    virtual ~AddressTimeProbe();
-
-    /**
-     * @brief Set a probe value
-     *
-     * @param timeValue set the traced time value equal to this
-     * @param address set the socket address for the traced packet equal to this
-     */
-    void SetValue(Time timeValue, const Address& address);
-
-    /**
-     * @brief Set a probe value by its name in the Config system
-     *
-     * @param path config path to access the probe
-     * @param timeValue set the traced time value equal to this
-     * @param address set the socket address for the traced packet equal to this
-     */
-    static void SetValueByPath(std::string path, Time timeValue, const Address& address);
-
-    /**
-     * @brief connect to a trace source attribute provided by a given object
-     *
-     * @param traceSource the name of the attribute TraceSource to connect to
-     * @param obj ns3::Object to connect to
-     * @return true if the trace source was successfully connected
-     */
-    virtual bool ConnectByObject(std::string traceSource, Ptr<Object> obj);
-
-    /**
-     * @brief connect to a trace source provided by a config path
-     *
-     * @param path Config path to bind to
-     *
-     * Note, if an invalid path is provided, the probe will not be connected
-     * to anything.
-     */
-    virtual void ConnectByPath(std::string path);
 
     /**
      * @brief Callback signature for time value and address.
@@ -115,28 +81,7 @@ class AddressTimeProbe : public Probe
      */
     typedef void (*TimeCallback)(double oldValue, double newValue);
 
-  private:
-    /**
-     * @brief Method to connect to an underlying ns3::TraceSource with
-     * arguments of type Time value and const Address&
-     *
-     * @param timeValue the traced time value
-     * @param address the socket address for the traced packet
-     *
-     */
-    void TraceSink(Time timeValue, const Address& address);
-
-    /// Output trace, thetime value and source address
-    TracedCallback<Time, const Address&> m_output;
-    /// Output trace, previous time value and current time value
-    TracedCallback<double, double> m_outputSeconds;
-
-    /// The traced time value.
-    Time m_timeValue;
-
-    /// The socket address.
-    Address m_address;
-};
+}; // end of class AddressTimeProbe
 
 } // namespace ns3
 
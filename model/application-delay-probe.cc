@@ -66,7 +66,6 @@ ApplicationDelayProbe::ApplicationDelayProbe()
 {
     NS_LOG_FUNCTION(this);
     m_delay = MilliSeconds(0);
-    m_delayOld = 0.0;
 }
 
 ApplicationDelayProbe::~ApplicationDelayProbe()
@@ -77,14 +76,14 @@ ApplicationDelayProbe::~ApplicationDelayProbe()
 void
 ApplicationDelayProbe::SetValue(Time delay, const Address& address)
 {
-    NS_LOG_FUNCTION(this << delay.GetSeconds() << address);
-    m_delay = delay;
-    m_address = address;
+    NS_LOG_FUNCTION(this << delay.GetSeconds());
     m_output(delay, address);
 
-    double delayNew = delay.GetSeconds();
-    m_outputSeconds(m_delayOld, delayNew);
-    m_delayOld = delayNew;
+    if (!m_outputSeconds.IsEmpty())
+    {
+        m_outputSeconds(m_delay.GetSeconds(), delay.GetSeconds());
+    }
+    m_delay = delay;
 }
 
 void
@@ -118,16 +117,16 @@ ApplicationDelayProbe::ConnectByPath(std::string path)
 void
 ApplicationDelayProbe::TraceSink(const Time& delay, const Address& address)
 {
-    NS_LOG_FUNCTION(this << delay.GetSeconds() << address);
+    NS_LOG_FUNCTION(this << delay.GetSeconds());
     if (IsEnabled())
     {
-        m_delay = delay;
-        m_address = address;
         m_output(delay, address);
 
-        double delayNew = delay.GetSeconds();
-        m_outputSeconds(m_delayOld, delayNew);
-        m_delayOld = delayNew;
+        if (!m_outputSeconds.IsEmpty())
+        {
+            m_outputSeconds(m_delay.GetSeconds(), delay.GetSeconds());
+        }
+        m_delay = delay;
     }
 }
 
@@ -131,12 +131,6 @@ class ApplicationDelayProbe : public Probe
 
     /// The traced delay.
     Time m_delay;
-
-    /// The socket address for the traced packet.
-    Address m_address;
-
-    /// The delay of the traced packet.
-    double m_delayOld;
 };
 
 } // namespace ns3
@@ -0,0 +1,403 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "batch-means.h"
+
+#include "collector-state.h"
+#include "memory-usage.h"
+
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <cmath>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("BatchMeans");
+
+namespace ns3
+{
+
+BatchMeans::BatchMeans()
+    : m_numOfCompleteBatches(0),
+      m_batchSize(1),
+      m_currentSum(0.0),
+      m_currentCount(0),
+      m_numOfSamples(0),
+      m_numOfBatches(32),
+      m_confidenceLevel(0.95),
+      m_truncationEnabled(false)
+{
+    m_batchSums.resize(m_numOfBatches, 0.0);
+}
+
+void
+BatchMeans::SetNumOfBatches(uint32_t numOfBatches)
+{
+    NS_LOG_FUNCTION(this << numOfBatches);
+    // Checked in optimized builds too, since MergeBatches() would otherwise
+    // silently drop the last batch.
+    NS_ABORT_MSG_IF(numOfBatches < 4 || (numOfBatches % 2) != 0,
+                    "Number of batches must be an even number not less than 4, got "
+                        << numOfBatches);
+    m_numOfBatches = numOfBatches;
+    Reset();
+}
+
+uint32_t
+BatchMeans::GetNumOfBatches() const
+{
+    return m_numOfBatches;
+}
+
+void
+BatchMeans::SetConfidenceLevel(double confidenceLevel)
+{
+    NS_LOG_FUNCTION(this << confidenceLevel);
+    NS_ABORT_MSG_IF(!(confidenceLevel > 0.0 && confidenceLevel < 1.0),
+                    "Confidence level must be between 0 and 1 (exclusive), got "
+                        << confidenceLevel);
+    m_confidenceLevel = confidenceLevel;
+}
+
+double
+BatchMeans::GetConfidenceLevel() const
+{
+    return m_confidenceLevel;
+}
+
+void
+BatchMeans::SetTruncationEnabled(bool truncationEnabled)
+{
+    NS_LOG_FUNCTION(this << truncationEnabled);
+    m_truncationEnabled = truncationEnabled;
+    Reset();
+}
+
+bool
+BatchMeans::IsTruncationEnabled() const
+{
+    return m_truncationEnabled;
+}
+
+void
+BatchMeans::Reset()
+{
+    NS_LOG_FUNCTION(this);
+    m_batchSums.assign(m_numOfBatches, 0.0);
+    m_numOfCompleteBatches = 0;
+    // MSER-5 operates on batches of at least 5 observations.
+    m_batchSize = m_truncationEnabled ? 5 : 1;
+    m_currentSum = 0.0;
+    m_currentCount = 0;
+    m_numOfSamples = 0;
+}
+
+bool
+BatchMeans::AddSample(double sample)
+{
+    m_currentSum += sample;
+    m_currentCount++;
+    m_numOfSamples++;
+
+    if (m_currentCount < m_batchSize)
+    {
+        return false;
+    }
+
+    if (m_numOfCompleteBatches == m_numOfBatches)
+    {
+        MergeBatches();
+        if (m_currentCount < m_batchSize)
+        {
+            // The current batch now needs twice as many samples.
+            return false;
+        }
+    }
+
+    m_batchSums[m_numOfCompleteBatches] = m_currentSum;
+    m_numOfCompleteBatches++;
+    m_currentSum = 0.0;
+    m_currentCount = 0;
+    return true;
+}
+
+void
+BatchMeans::MergeBatches()
+{
+    NS_LOG_FUNCTION(this << m_batchSize);
+    NS_ASSERT(m_numOfCompleteBatches == m_numOfBatches);
+
+    const uint32_t half = m_numOfBatches / 2;
+    for (uint32_t i = 0; i < half; i++)
+    {
+        m_batchSums[i] = m_batchSums[2 * i] + m_batchSums[2 * i + 1];
+    }
+    m_numOfCompleteBatches = half;
+    m_batchSize *= 2;
+}
+
+uint64_t
+BatchMeans::GetNumOfSamples() const
+{
+    return m_numOfSamples;
+}
+
+uint32_t
+BatchMeans::GetNumOfCompleteBatches() const
+{
+    return m_numOfCompleteBatches;
+}
+
+uint64_t
+BatchMeans::GetBatchSize() const
+{
+    return m_batchSize;
+}
+
+uint32_t
+BatchMeans::GetNumOfTruncatedBatches() const
+{
+    return ComputeTruncation();
+}
+
+uint32_t
+BatchMeans::ComputeTruncation() const
+{
+    if (!m_truncationEnabled || m_numOfCompleteBatches < 4)
+    {
+        return 0;
+    }
+
+    const uint32_t m = m_numOfCompleteBatches;
+    const double batchSize = static_cast<double>(m_batchSize);
+
+    // Suffix sums of the batch means and their squares, built backwards.
+    double sum = 0.0;
+    double sqrSum = 0.0;
+    uint32_t bestTruncation = 0;
+    double bestStatistic = std::numeric_limits<double>::max();
+
+    for (uint32_t d = m; d-- > 0;)
+    {
+        const double y = m_batchSums[d] / batchSize;
+        sum += y;
+        sqrSum += y * y;
+
+        // Only the first half of the batches may be truncated.
+        if (d <= m / 2)
+        {
+            const double n = static_cast<double>(m - d);
+            const double statistic = (sqrSum - sum * sum / n) / (n * n);
+            if (statistic <= bestStatistic)
+            {
+                bestStatistic = statistic;
+                bestTruncation = d;
+            }
+        }
+    }
+
+    return bestTruncation;
+}
+
+double
+BatchMeans::GetMean() const
+{
+    const uint32_t d = ComputeTruncation();
+    const uint32_t n = m_numOfCompleteBatches - d;
+
+    if (n < 2)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double sum = 0.0;
+    for (uint32_t i = d; i < m_numOfCompleteBatches; i++)
+    {
+        sum += m_batchSums[i];
+    }
+    return sum / (static_cast<double>(n) * static_cast<double>(m_batchSize));
+}
+
+double
+BatchMeans::GetHalfWidth() const
+{
+    const uint32_t d = ComputeTruncation();
+    const uint32_t n = m_numOfCompleteBatches - d;
+
+    if (n < 2)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    const double batchSize = static_cast<double>(m_batchSize);
+    double sum = 0.0;
+    for (uint32_t i = d; i < m_numOfCompleteBatches; i++)
+    {
+        sum += m_batchSums[i] / batchSize;
+    }
+    const double mean = sum / n;
+
+    double sqrDev = 0.0;
+    for (uint32_t i = d; i < m_numOfCompleteBatches; i++)
+    {
+        const double dev = m_batchSums[i] / batchSize - mean;
+        sqrDev += dev * dev;
+    }
+    const double stddev = std::sqrt(sqrDev / (n - 1));
+    const double t = GetStudentTQuantile(0.5 + m_confidenceLevel / 2.0, n - 1);
+    return t * stddev / std::sqrt(static_cast<double>(n));
+}
+
+double // static
+BatchMeans::GetStudentTQuantile(double p, uint32_t degreesOfFreedom)
+{
+    NS_ASSERT(p > 0.0 && p < 1.0);
+    NS_ASSERT(degreesOfFreedom > 0);
+
+    if (degreesOfFreedom == 1)
+    {
+        // Cauchy distribution.
+        return std::tan(M_PI * (p - 0.5));
+    }
+
+    if (degreesOfFreedom == 2)
+    {
+        return (2.0 * p - 1.0) / std::sqrt(2.0 * p * (1.0 - p));
+    }
+
+    // Cornish-Fisher expansion (Abramowitz and Stegun 26.7.5).
+    const double z = GetNormalQuantile(p);
+    const double z2 = z * z;
+    const double v = static_cast<double>(degreesOfFreedom);
+    const double g1 = (z2 + 1.0) * z / 4.0;
+    const double g2 = ((5.0 * z2 + 16.0) * z2 + 3.0) * z / 96.0;
+    const double g3 = (((3.0 * z2 + 19.0) * z2 + 17.0) * z2 - 15.0) * z / 384.0;
+    const double g4 =
+        ((((79.0 * z2 + 776.0) * z2 + 1482.0) * z2 - 1920.0) * z2 - 945.0) * z / 92160.0;
+    return z + (g1 + (g2 + (g3 + g4 / v) / v) / v) / v;
+}
+
+double // static
+BatchMeans::GetNormalQuantile(double p)
+{
+    NS_ASSERT(p > 0.0 && p < 1.0);
+
+    // Rational approximation by P. J. Acklam.
+    static const double a[] = {-3.969683028665376e+01,
+                               2.209460984245205e+02,
+                               -2.759285104469687e+02,
+                               1.383577518672690e+02,
+                               -3.066479806614716e+01,
+                               2.506628277459239e+00};
+    static const double b[] = {-5.447609879822406e+01,
+                               1.615858368580409e+02,
+                               -1.556989798598866e+02,
+                               6.680131188771972e+01,
+                               -1.328068155288572e+01};
+    static const double c[] = {-7.784894002430293e-03,
+                               -3.223964580411365e-01,
+                               -2.400758277161838e+00,
+                               -2.549732539343734e+00,
+                               4.374664141464968e+00,
+                               2.938163982698783e+00};
+    static const double d[] = {7.784695709041462e-03,
+                               3.224671290700398e-01,
+                               2.445134137142996e+00,
+                               3.754408661907416e+00};
+    const double pLow = 0.02425;
+
+    if (p < pLow)
+    {
+        const double q = std::sqrt(-2.0 * std::log(p));
+        return (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+               ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    }
+
+    if (p > 1.0 - pLow)
+    {
+        const double q = std::sqrt(-2.0 * std::log(1.0 - p));
+        return -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+               ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    }
+
+    const double q = p - 0.5;
+    const double r = q * q;
+    return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+           (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+}
+
+uint64_t
+BatchMeans::GetMemoryUsage() const
+{
+    return MemoryUsage::GetVectorUsage(m_batchSums);
+}
+
+uint32_t
+BatchMeans::GetSerializedStateSize() const
+{
+    return 4 + 8 + 8 + 8 + 8 + 8 * m_numOfCompleteBatches;
+}
+
+void
+BatchMeans::SerializeState(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    i.WriteU32(m_numOfCompleteBatches);
+    i.WriteU64(m_batchSize);
+    CollectorState::WriteDouble(i, m_currentSum);
+    i.WriteU64(m_currentCount);
+    i.WriteU64(m_numOfSamples);
+
+    for (uint32_t j = 0; j < m_numOfCompleteBatches; j++)
+    {
+        CollectorState::WriteDouble(i, m_batchSums[j]);
+    }
+}
+
+uint32_t
+BatchMeans::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this);
+    Buffer::Iterator i = start;
+    const uint32_t numOfCompleteBatches = i.ReadU32();
+
+    if (numOfCompleteBatches > m_numOfBatches)
+    {
+        NS_FATAL_ERROR("The saved state has " << numOfCompleteBatches
+                                              << " complete batches, but the estimator only has "
+                                              << m_numOfBatches << " batches");
+    }
+
+    Reset();
+    m_numOfCompleteBatches = numOfCompleteBatches;
+    m_batchSize = i.ReadU64();
+    m_currentSum = CollectorState::ReadDouble(i);
+    m_currentCount = i.ReadU64();
+    m_numOfSamples = i.ReadU64();
+
+    for (uint32_t j = 0; j < m_numOfCompleteBatches; j++)
+    {
+        m_batchSums[j] = CollectorState::ReadDouble(i);
+    }
+
+    return i.GetDistanceFrom(start);
+}
+
+} // end of namespace ns3
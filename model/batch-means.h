@@ -0,0 +1,230 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef BATCH_MEANS_H
+#define BATCH_MEANS_H
+
+#include "ns3/buffer.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup aggregator
+ * @brief Online confidence interval estimator based on the method of batch
+ *        means, using a fixed number of batches.
+ *
+ * ### Input ###
+ * Samples are pushed one at a time using the AddSample() method.
+ *
+ * ### Processing ###
+ * The sample stream is partitioned into consecutive batches of equal size.
+ * At most `K` complete batches (see SetNumOfBatches()) are kept in memory.
+ * Once all `K` batches are complete, adjacent pairs of batches are merged,
+ * leaving `K/2` batches of twice the original size, and the next samples
+ * continue to fill the remaining batches. Memory usage is therefore O(K),
+ * regardless of the number of samples received.
+ *
+ * When warm-up truncation is enabled (see SetTruncationEnabled()), the initial
+ * batch size is 5 samples and the MSER-5 rule (Marginal Standard Error Rule)
+ * is applied to the sequence of complete batch means. The truncation point
+ * `d` minimizing the marginal standard error of the remaining batches is
+ * searched within the first half of the batches, and the first `d` batches
+ * are excluded from the estimate.
+ *
+ * ### Output ###
+ * The GetMean() and GetHalfWidth() methods return the grand mean and the
+ * half-width of the confidence interval computed from the retained complete
+ * batches. The half-width uses the Student's t quantile with `n - 1` degrees
+ * of freedom, where `n` is the number of retained batches. Samples in the
+ * current incomplete batch are not taken into account. Both methods return
+ * a quiet NaN when less than 2 complete batches are available.
+ */
+class BatchMeans
+{
+  public:
+    /// Creates a new estimator with 32 batches and 95% confidence level.
+    BatchMeans();
+
+    /**
+     * @param numOfBatches the maximum number of complete batches kept in
+     *                     memory; must be an even number not less than 4,
+     *                     otherwise the simulation is aborted.
+     *
+     * Any samples received so far are discarded.
+     */
+    void SetNumOfBatches(uint32_t numOfBatches);
+
+    /**
+     * @return the maximum number of complete batches kept in memory.
+     */
+    uint32_t GetNumOfBatches() const;
+
+    /**
+     * @param confidenceLevel the confidence level of the interval, between 0
+     *                        and 1 (exclusive), otherwise the simulation is
+     *                        aborted.
+     */
+    void SetConfidenceLevel(double confidenceLevel);
+
+    /**
+     * @return the confidence level of the interval.
+     */
+    double GetConfidenceLevel() const;
+
+    /**
+     * @param truncationEnabled whether to apply MSER-5 warm-up truncation.
+     *
+     * Any samples received so far are discarded.
+     */
+    void SetTruncationEnabled(bool truncationEnabled);
+
+    /**
+     * @return whether MSER-5 warm-up truncation is applied.
+     */
+    bool IsTruncationEnabled() const;
+
+    /// Discard all the samples received so far.
+    void Reset();
+
+    /**
+     * @brief Push a new sample into the current batch.
+     * @param sample the sample value.
+     * @return true if the sample completes a batch.
+     */
+    bool AddSample(double sample);
+
+    /**
+     * @return the total number of samples received, including those in the
+     *         current incomplete batch.
+     */
+    uint64_t GetNumOfSamples() const;
+
+    /**
+     * @return the number of complete batches currently kept in memory.
+     */
+    uint32_t GetNumOfCompleteBatches() const;
+
+    /**
+     * @return the current number of samples per batch.
+     */
+    uint64_t GetBatchSize() const;
+
+    /**
+     * @return the number of complete batches dropped by the MSER-5 warm-up
+     *         truncation (always zero if the truncation is disabled).
+     */
+    uint32_t GetNumOfTruncatedBatches() const;
+
+    /**
+     * @return the grand mean of the retained complete batches.
+     */
+    double GetMean() const;
+
+    /**
+     * @return the half-width of the confidence interval around GetMean().
+     */
+    double GetHalfWidth() const;
+
+    /**
+     * @return the memory allocated by the instance, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * @return the number of bytes written by SerializeState().
+     */
+    uint32_t GetSerializedStateSize() const;
+
+    /**
+     * @brief Save the batches and the current batch, see CollectorState.
+     * @param start the iterator to write to.
+     */
+    void SerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by SerializeState() into an estimator
+     *        with the same number of batches.
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     */
+    uint32_t DeserializeState(Buffer::Iterator start);
+
+    /**
+     * @brief Approximate the quantile function of the Student's t
+     *        distribution.
+     * @param p the probability, between 0 and 1 (exclusive).
+     * @param degreesOfFreedom the number of degrees of freedom (at least 1).
+     * @return the value `t` such that `P(T <= t) = p`.
+     *
+     * Exact closed forms are used for 1 and 2 degrees of freedom. Otherwise,
+     * the Cornish-Fisher expansion around the normal quantile is used, which
+     * has an absolute error below 0.01 for 3 degrees of freedom and decreases
+     * rapidly for higher values.
+     */
+    static double GetStudentTQuantile(double p, uint32_t degreesOfFreedom);
+
+    /**
+     * @brief Approximate the quantile function of the standard normal
+     *        distribution, with a relative error below 1.2e-9.
+     * @param p the probability, between 0 and 1 (exclusive).
+     * @return the value `z` such that `P(Z <= z) = p`.
+     */
+    static double GetNormalQuantile(double p);
+
+  private:
+    /// Merge adjacent pairs of complete batches and double the batch size.
+    void MergeBatches();
+
+    /**
+     * @return the number of leading complete batches to drop according to
+     *         MSER-5, or zero if truncation is disabled.
+     */
+    uint32_t ComputeTruncation() const;
+
+    /// Sum of the samples of each complete batch.
+    std::vector<double> m_batchSums;
+
+    /// Number of complete batches kept in #m_batchSums.
+    uint32_t m_numOfCompleteBatches;
+
+    /// Number of samples in a complete batch.
+    uint64_t m_batchSize;
+
+    /// Sum of the samples in the current incomplete batch.
+    double m_currentSum;
+
+    /// Number of samples in the current incomplete batch.
+    uint64_t m_currentCount;
+
+    /// Total number of samples received.
+    uint64_t m_numOfSamples;
+
+    uint32_t m_numOfBatches;  ///< Maximum number of complete batches.
+    double m_confidenceLevel; ///< Confidence level of the interval.
+    bool m_truncationEnabled; ///< Whether MSER-5 warm-up truncation is applied.
+
+}; // end of class BatchMeans
+
+} // end of namespace ns3
+
+#endif /* BATCH_MEANS_H */
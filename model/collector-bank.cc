@@ -0,0 +1,314 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "collector-bank.h"
+
+#include "collector-state.h"
+#include "magister-stats.h"
+#include "memory-usage.h"
+
+#include "ns3/assert.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/log.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+
+#include <string>
+
+NS_LOG_COMPONENT_DEFINE("CollectorBank");
+
+namespace ns3
+{
+
+NS_OBJECT_ENSURE_REGISTERED(CollectorBank);
+
+CollectorBank::CollectorBank()
+    : m_outputType(ScalarCollector::OUTPUT_TYPE_SUM),
+      m_scale(1.0)
+{
+    NS_LOG_FUNCTION(this << GetName());
+}
+
+TypeId // static
+CollectorBank::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::CollectorBank")
+            .SetParent<DataCollectionObject>()
+            .AddConstructor<CollectorBank>()
+            .AddAttribute(
+                "OutputType",
+                "Determines the mechanism of processing the incoming samples "
+                "of each identifier.",
+                EnumValue(ScalarCollector::OUTPUT_TYPE_SUM),
+                MakeEnumAccessor<ScalarCollector::OutputType_t>(&CollectorBank::SetOutputType,
+                                                                &CollectorBank::GetOutputType),
+                MakeEnumChecker(ScalarCollector::OUTPUT_TYPE_SUM,
+                                "SUM",
+                                ScalarCollector::OUTPUT_TYPE_NUMBER_OF_SAMPLE,
+                                "NUMBER_OF_SAMPLE",
+                                ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SAMPLE,
+                                "AVERAGE_PER_SAMPLE",
+                                ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND,
+                                "AVERAGE_PER_SECOND"))
+            .AddAttribute("Scale",
+                          "Factor applied to the output of every identifier, e.g., "
+                          "to convert bytes into kilobits. Not applied when the "
+                          "output type is `NUMBER_OF_SAMPLE`.",
+                          DoubleValue(1.0),
+                          MakeDoubleAccessor(&CollectorBank::SetScale, &CollectorBank::GetScale),
+                          MakeDoubleChecker<double>())
+            .AddTraceSource("Output",
+                            "The name of an identifier and its single scalar output, "
+                            "fired for every identifier once the instance is destroyed.",
+                            MakeTraceSourceAccessor(&CollectorBank::m_output),
+                            "ns3::CollectorContextOutputCallback");
+    return tid;
+}
+
+void
+CollectorBank::DoDispose()
+{
+    NS_LOG_FUNCTION(this << GetName());
+
+    if (IsEnabled())
+    {
+        const uint32_t n = m_names.size();
+
+        for (uint32_t i = 0; i < n; i++)
+        {
+            double output = 0.0;
+
+            switch (m_outputType)
+            {
+            case ScalarCollector::OUTPUT_TYPE_SUM:
+                output = m_scale * m_sums[i];
+                break;
+
+            case ScalarCollector::OUTPUT_TYPE_NUMBER_OF_SAMPLE:
+                output = m_numOfSamples[i];
+                break;
+
+            case ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SAMPLE:
+                // This may produce -nan if number of sample is zero.
+                output = m_scale * m_sums[i] / static_cast<double>(m_numOfSamples[i]);
+                break;
+
+            case ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND:
+                if (m_numOfSamples[i] > 0)
+                {
+                    const Time duration = TimeStep(m_lastSamples[i] - m_firstSamples[i]);
+
+                    if (!duration.IsZero())
+                    {
+                        NS_ASSERT(duration.IsStrictlyPositive());
+                        output = m_scale * m_sums[i] / duration.GetSeconds();
+                    }
+                }
+                break;
+
+            default:
+                break;
+            }
+
+            m_output(m_names[i], output);
+        }
+    }
+
+    m_sums.clear();
+    m_numOfSamples.clear();
+    m_firstSamples.clear();
+    m_lastSamples.clear();
+    m_names.clear();
+    DataCollectionObject::DoDispose();
+
+} // end of `void DoDispose ();`
+
+uint32_t
+CollectorBank::AddIdentifier(std::string name)
+{
+    NS_LOG_FUNCTION(this << GetName() << name);
+
+    m_sums.push_back(0.0);
+    m_numOfSamples.push_back(0);
+    m_firstSamples.push_back(0);
+    m_lastSamples.push_back(0);
+    m_names.push_back(name);
+    return m_names.size() - 1;
+}
+
+uint32_t
+CollectorBank::GetN() const
+{
+    return m_names.size();
+}
+
+std::string
+CollectorBank::GetIdentifierName(uint32_t index) const
+{
+    NS_ASSERT_MSG(index < m_names.size(), "Invalid identifier index " << index);
+    return m_names[index];
+}
+
+uint64_t
+CollectorBank::GetNumOfSamples(uint32_t index) const
+{
+    NS_ASSERT_MSG(index < m_numOfSamples.size(), "Invalid identifier index " << index);
+    return m_numOfSamples[index];
+}
+
+void
+CollectorBank::SetOutputType(ScalarCollector::OutputType_t outputType)
+{
+    NS_LOG_FUNCTION(this << GetName() << ScalarCollector::GetOutputTypeName(outputType));
+    m_outputType = outputType;
+}
+
+ScalarCollector::OutputType_t
+CollectorBank::GetOutputType() const
+{
+    return m_outputType;
+}
+
+void
+CollectorBank::SetScale(double scale)
+{
+    NS_LOG_FUNCTION(this << GetName() << scale);
+    m_scale = scale;
+}
+
+double
+CollectorBank::GetScale() const
+{
+    return m_scale;
+}
+
+void
+CollectorBank::TraceSinkDouble(uint32_t index, double oldData, double newData)
+{
+    // NS_LOG_FUNCTION (this << GetName () << index << newData);
+    StatsProfiler::Scope profileScope(m_profile.Get("CollectorBank", this));
+    NS_ASSERT_MSG(index < m_names.size(), "Invalid identifier index " << index);
+
+    if (IsEnabled())
+    {
+        m_sums[index] += newData;
+
+        if (m_outputType == ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND)
+        {
+            const int64_t now = Simulator::Now().GetTimeStep();
+            if (m_numOfSamples[index] == 0)
+            {
+                m_firstSamples[index] = now;
+            }
+            m_lastSamples[index] = now;
+        }
+
+        m_numOfSamples[index]++;
+    }
+}
+
+Callback<void, double, double>
+CollectorBank::GetTraceSinkDouble(uint32_t index)
+{
+    NS_LOG_FUNCTION(this << GetName() << index);
+    NS_ASSERT_MSG(index < m_names.size(), "Invalid identifier index " << index);
+    return MakeCallback(&CollectorBank::TraceSinkDouble, this).Bind(index);
+}
+
+void
+CollectorBank::TraceSinkUinteger32(uint32_t index, uint32_t oldData, uint32_t newData)
+{
+    TraceSinkDouble(index, 0.0, static_cast<double>(newData));
+    // Note: old data is discarded.
+}
+
+Callback<void, uint32_t, uint32_t>
+CollectorBank::GetTraceSinkUinteger32(uint32_t index)
+{
+    NS_LOG_FUNCTION(this << GetName() << index);
+    NS_ASSERT_MSG(index < m_names.size(), "Invalid identifier index " << index);
+    return MakeCallback(&CollectorBank::TraceSinkUinteger32, this).Bind(index);
+}
+
+uint64_t
+CollectorBank::GetMemoryUsage() const
+{
+    uint64_t usage = sizeof(CollectorBank) + MemoryUsage::GetVectorUsage(m_sums) +
+                     MemoryUsage::GetVectorUsage(m_numOfSamples) +
+                     MemoryUsage::GetVectorUsage(m_firstSamples) +
+                     MemoryUsage::GetVectorUsage(m_lastSamples) +
+                     MemoryUsage::GetVectorUsage(m_names);
+
+    for (const std::string& name : m_names)
+    {
+        usage += MemoryUsage::GetStringUsage(name);
+    }
+
+    return usage;
+}
+
+uint32_t
+CollectorBank::GetSerializedStateSize() const
+{
+    return 4 + (8 + 8 + 8 + 8) * m_sums.size();
+}
+
+void
+CollectorBank::SerializeState(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    const uint32_t n = m_sums.size();
+    i.WriteU32(n);
+
+    for (uint32_t j = 0; j < n; j++)
+    {
+        CollectorState::WriteDouble(i, m_sums[j]);
+        i.WriteU64(m_numOfSamples[j]);
+        i.WriteU64(static_cast<uint64_t>(m_firstSamples[j]));
+        i.WriteU64(static_cast<uint64_t>(m_lastSamples[j]));
+    }
+}
+
+uint32_t
+CollectorBank::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this << GetName());
+    Buffer::Iterator i = start;
+    const uint32_t n = i.ReadU32();
+
+    if (n != m_sums.size())
+    {
+        NS_FATAL_ERROR("The saved state has " << n << " identifiers, but collector bank "
+                                              << GetName() << " has " << m_sums.size());
+    }
+
+    for (uint32_t j = 0; j < n; j++)
+    {
+        m_sums[j] = CollectorState::ReadDouble(i);
+        m_numOfSamples[j] = i.ReadU64();
+        m_firstSamples[j] = static_cast<int64_t>(i.ReadU64());
+        m_lastSamples[j] = static_cast<int64_t>(i.ReadU64());
+    }
+
+    return i.GetDistanceFrom(start);
+}
+
+} // end of namespace ns3
@@ -0,0 +1,222 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef COLLECTOR_BANK_H
+#define COLLECTOR_BANK_H
+
+#include "scalar-collector.h"
+#include "stats-profiler.h"
+
+#include "ns3/buffer.h"
+#include "ns3/callback.h"
+#include "ns3/data-collection-object.h"
+#include "ns3/traced-callback.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup aggregator
+ * @brief Collector which holds the state of many identifiers in one instance,
+ *        each of them behaving like a separate ScalarCollector.
+ *
+ * Creating one ScalarCollector per identifier (e.g., per node) costs a
+ * separate heap-allocated object for each identifier, along with its
+ * attributes, trace sources, and reference count. This class instead keeps
+ * the accumulated state of all identifiers in contiguous arrays (sums, sample
+ * counts, and the time of the first and the last samples), i.e., 32 bytes per
+ * identifier, besides the identifier's name.
+ *
+ * ### Input ###
+ * Identifiers are added using AddIdentifier(), which returns the index of the
+ * identifier within the bank. Input samples are then received by
+ * TraceSinkDouble() or TraceSinkUinteger32(), which take the index as their
+ * first argument. Callbacks which can be connected directly to a trace source
+ * (e.g., of a probe or a UnitConversionCollector) are obtained from
+ * GetTraceSinkDouble() and GetTraceSinkUinteger32().
+ *
+ * ### Processing ###
+ * The samples of each identifier are processed independently, according to
+ * the `OutputType` attribute, which accepts the same values as the attribute
+ * of the same name in ScalarCollector. Unlike ScalarCollector, every input is
+ * accumulated as `double`.
+ *
+ * Linear unit conversions can be folded into the output using the `Scale`
+ * attribute. The factor is applied once to each identifier's output (except
+ * with `OUTPUT_TYPE_NUMBER_OF_SAMPLE`), instead of to every input sample.
+ *
+ * ### Output ###
+ * At the end of the instance's life (e.g., when the simulation ends), the
+ * `Output` trace source is fired once for each identifier, in the order the
+ * identifiers were added. The first argument is the identifier's name, so the
+ * trace source can be connected directly to an aggregator's input method,
+ * e.g., MultiFileAggregator::Write1d(), and the resulting context names are
+ * the same as when a CollectorMap of ScalarCollector instances is used.
+ */
+class CollectorBank : public DataCollectionObject
+{
+  public:
+    /// Creates a new collector bank instance without any identifier.
+    CollectorBank();
+
+    // inherited from ObjectBase base class
+    static TypeId GetTypeId();
+
+    /**
+     * @brief Add a new identifier to the bank.
+     * @param name the name of the identifier, used as the context of its output.
+     * @return the index of the new identifier.
+     */
+    uint32_t AddIdentifier(std::string name);
+
+    /**
+     * @return the number of identifiers in the bank.
+     */
+    uint32_t GetN() const;
+
+    /**
+     * @param index the index of an identifier.
+     * @return the name of the identifier.
+     */
+    std::string GetIdentifierName(uint32_t index) const;
+
+    /**
+     * @param index the index of an identifier.
+     * @return the number of samples received so far by the identifier.
+     */
+    uint64_t GetNumOfSamples(uint32_t index) const;
+
+    // ATTRIBUTE SETTERS AND GETTERS ////////////////////////////////////////////
+
+    /**
+     * @param outputType the processing mechanism used by this instance.
+     */
+    void SetOutputType(ScalarCollector::OutputType_t outputType);
+
+    /**
+     * @return the processing mechanism used by this instance.
+     */
+    ScalarCollector::OutputType_t GetOutputType() const;
+
+    /**
+     * @param scale the factor applied to the output of every identifier.
+     */
+    void SetScale(double scale);
+
+    /**
+     * @return the factor applied to the output of every identifier.
+     */
+    double GetScale() const;
+
+    // TRACE SINKS //////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Trace sink for receiving data of an identifier from `double`
+     *        valued trace sources.
+     * @param index the index of the identifier.
+     * @param oldData the original value (discarded).
+     * @param newData the new value.
+     */
+    void TraceSinkDouble(uint32_t index, double oldData, double newData);
+
+    /**
+     * @param index the index of an identifier.
+     * @return a callback to TraceSinkDouble() with the index already bound,
+     *         which can be connected to `double` valued trace sources.
+     */
+    Callback<void, double, double> GetTraceSinkDouble(uint32_t index);
+
+    /**
+     * @brief Trace sink for receiving data of an identifier from `uint32_t`
+     *        valued trace sources.
+     * @param index the index of the identifier.
+     * @param oldData the original value (discarded).
+     * @param newData the new value.
+     */
+    void TraceSinkUinteger32(uint32_t index, uint32_t oldData, uint32_t newData);
+
+    /**
+     * @param index the index of an identifier.
+     * @return a callback to TraceSinkUinteger32() with the index already bound,
+     *         which can be connected to `uint32_t` valued trace sources.
+     */
+    Callback<void, uint32_t, uint32_t> GetTraceSinkUinteger32(uint32_t index);
+
+    /**
+     * @return the memory used by the instance, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * @return the number of bytes written by SerializeState().
+     */
+    uint32_t GetSerializedStateSize() const;
+
+    /**
+     * @brief Save the sum, the number of samples, and the time of the first
+     *        and the last samples of every identifier, see CollectorState.
+     * @param start the iterator to write to.
+     */
+    void SerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by SerializeState() into a bank with
+     *        the same number of identifiers.
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     */
+    uint32_t DeserializeState(Buffer::Iterator start);
+
+  protected:
+    // Inherited from Object base class
+    virtual void DoDispose();
+
+  private:
+    /// Sum of input samples received by each identifier.
+    std::vector<double> m_sums;
+
+    /// Number of input samples received by each identifier.
+    std::vector<uint64_t> m_numOfSamples;
+
+    /// Time step of the first input sample received by each identifier.
+    std::vector<int64_t> m_firstSamples;
+
+    /// Time step of the last input sample received by each identifier.
+    std::vector<int64_t> m_lastSamples;
+
+    /// Name of each identifier, only used when emitting the output.
+    std::vector<std::string> m_names;
+
+    ScalarCollector::OutputType_t m_outputType; ///< `OutputType` attribute.
+    double m_scale;                             ///< `Scale` attribute.
+
+    /// `Output` trace source.
+    TracedCallback<std::string, double> m_output;
+
+    StatsProfiler::Handle m_profile; ///< Profiling counters, see StatsProfiler.
+
+}; // end of class CollectorBank
+
+} // end of namespace ns3
+
+#endif /* COLLECTOR_BANK_H */
@@ -21,6 +21,9 @@
 
 #include "collector-map.h"
 
+#include "collector-state.h"
+#include "memory-usage.h"
+
 #include "ns3/fatal-error.h"
 #include "ns3/log.h"
 
@@ -138,4 +141,76 @@ CollectorMap::Get(uint32_t identifier) const
     }
 }
 
+uint64_t
+CollectorMap::GetMemoryUsage() const
+{
+    uint64_t usage = MemoryUsage::GetTreeUsage(
+        m_map.size(),
+        sizeof(std::map<uint32_t, Ptr<DataCollectionObject>>::value_type));
+
+    for (Iterator it = m_map.begin(); it != m_map.end(); ++it)
+    {
+        usage += MemoryUsage::GetObjectUsage(it->second);
+    }
+
+    return usage;
+}
+
+uint32_t
+CollectorMap::GetSerializedStateSize() const
+{
+    uint32_t size = 4;
+
+    for (Iterator it = m_map.begin(); it != m_map.end(); ++it)
+    {
+        size += 4 + CollectorState::GetSerializedSize(it->second);
+    }
+
+    return size;
+}
+
+void
+CollectorMap::SerializeState(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    i.WriteU32(m_map.size());
+
+    for (Iterator it = m_map.begin(); it != m_map.end(); ++it)
+    {
+        i.WriteU32(it->first);
+        CollectorState::Serialize(it->second, i);
+        i.Next(CollectorState::GetSerializedSize(it->second));
+    }
+}
+
+uint32_t
+CollectorMap::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this);
+    Buffer::Iterator i = start;
+    const uint32_t n = i.ReadU32();
+
+    if (n != m_map.size())
+    {
+        NS_FATAL_ERROR("The saved state has " << n << " collectors, but the map has "
+                                              << m_map.size());
+    }
+
+    for (uint32_t j = 0; j < n; j++)
+    {
+        const uint32_t identifier = i.ReadU32();
+        std::map<uint32_t, Ptr<DataCollectionObject>>::iterator it = m_map.find(identifier);
+
+        if (it == m_map.end())
+        {
+            NS_FATAL_ERROR("The saved state has identifier " << identifier
+                                                             << " which is not in the map");
+        }
+
+        i.Next(CollectorState::Deserialize(it->second, i));
+    }
+
+    return i.GetDistanceFrom(start);
+}
+
 } // end of namespace ns3
@@ -24,6 +24,7 @@
 
 #include "ns3/assert.h"
 #include "ns3/attribute.h"
+#include "ns3/buffer.h"
 #include "ns3/data-collection-object.h"
 #include "ns3/object-factory.h"
 #include "ns3/probe.h"
@@ -339,6 +340,32 @@ class CollectorMap
                              Ptr<DataCollectionObject> aggregator,
                              R (C::*aggregatorTraceSink)(P1, V1, V2)) const;
 
+    /**
+     * @return the memory allocated by the map, including the collectors in
+     *         it, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * @return the number of bytes written by SerializeState().
+     */
+    uint32_t GetSerializedStateSize() const;
+
+    /**
+     * @brief Save the state of every collector in the map, see
+     *        CollectorState.
+     * @param start the iterator to write to.
+     */
+    void SerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by SerializeState() into a map with the
+     *        same identifiers and types of collectors.
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     */
+    uint32_t DeserializeState(Buffer::Iterator start);
+
   private:
     /// Utilized to automate creating instances of collectors.
     ObjectFactory m_factory;
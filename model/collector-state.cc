@@ -0,0 +1,246 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#include "collector-state.h"
+
+#include "collector-bank.h"
+#include "distribution-collector.h"
+#include "interval-rate-collector.h"
+#include "multi-file-aggregator.h"
+#include "scalar-collector.h"
+#include "unit-conversion-collector.h"
+
+#include "ns3/data-collection-object.h"
+#include "ns3/log.h"
+
+#include <cstring>
+
+NS_LOG_COMPONENT_DEFINE("CollectorState");
+
+namespace ns3
+{
+
+void // static
+CollectorState::WriteDouble(Buffer::Iterator& i, double value)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    i.WriteU64(bits);
+}
+
+double // static
+CollectorState::ReadDouble(Buffer::Iterator& i)
+{
+    const uint64_t bits = i.ReadU64();
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void // static
+CollectorState::WriteTime(Buffer::Iterator& i, const Time& value)
+{
+    i.WriteU64(static_cast<uint64_t>(value.GetTimeStep()));
+}
+
+Time // static
+CollectorState::ReadTime(Buffer::Iterator& i)
+{
+    return TimeStep(i.ReadU64());
+}
+
+uint32_t // static
+CollectorState::GetStringSize(const std::string& s)
+{
+    return 4 + s.size();
+}
+
+void // static
+CollectorState::WriteString(Buffer::Iterator& i, const std::string& s)
+{
+    i.WriteU32(s.size());
+    i.Write(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+}
+
+std::string // static
+CollectorState::ReadString(Buffer::Iterator& i)
+{
+    const uint32_t size = i.ReadU32();
+    std::string s(size, '\0');
+    if (size > 0)
+    {
+        i.Read(reinterpret_cast<uint8_t*>(&s[0]), size);
+    }
+    return s;
+}
+
+CollectorState::Kind_t // static
+CollectorState::GetKind(Ptr<const DataCollectionObject> object)
+{
+    if (object == nullptr)
+    {
+        return KIND_NONE;
+    }
+
+    // The most common types come first.
+    if (DynamicCast<const UnitConversionCollector>(object))
+    {
+        return KIND_UNIT_CONVERSION_COLLECTOR;
+    }
+    if (DynamicCast<const ScalarCollector>(object))
+    {
+        return KIND_SCALAR_COLLECTOR;
+    }
+    if (DynamicCast<const IntervalRateCollector>(object))
+    {
+        return KIND_INTERVAL_RATE_COLLECTOR;
+    }
+    if (DynamicCast<const DistributionCollector>(object))
+    {
+        return KIND_DISTRIBUTION_COLLECTOR;
+    }
+    if (DynamicCast<const CollectorBank>(object))
+    {
+        return KIND_COLLECTOR_BANK;
+    }
+    if (DynamicCast<const MultiFileAggregator>(object))
+    {
+        return KIND_MULTI_FILE_AGGREGATOR;
+    }
+    // Other types, e.g., probes and the typed scalar collectors, do not have
+    // any state to save.
+    return KIND_NONE;
+}
+
+uint32_t // static
+CollectorState::GetSerializedSize(Ptr<const DataCollectionObject> object)
+{
+    uint32_t size = 1 + 4; // kind and payload size
+
+    switch (GetKind(object))
+    {
+    case KIND_UNIT_CONVERSION_COLLECTOR:
+        size += DynamicCast<const UnitConversionCollector>(object)->GetSerializedStateSize();
+        break;
+    case KIND_SCALAR_COLLECTOR:
+        size += DynamicCast<const ScalarCollector>(object)->GetSerializedStateSize();
+        break;
+    case KIND_INTERVAL_RATE_COLLECTOR:
+        size += DynamicCast<const IntervalRateCollector>(object)->GetSerializedStateSize();
+        break;
+    case KIND_DISTRIBUTION_COLLECTOR:
+        size += DynamicCast<const DistributionCollector>(object)->GetSerializedStateSize();
+        break;
+    case KIND_COLLECTOR_BANK:
+        size += DynamicCast<const CollectorBank>(object)->GetSerializedStateSize();
+        break;
+    case KIND_MULTI_FILE_AGGREGATOR:
+        size += DynamicCast<const MultiFileAggregator>(object)->GetSerializedStateSize();
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+void // static
+CollectorState::Serialize(Ptr<const DataCollectionObject> object, Buffer::Iterator start)
+{
+    const Kind_t kind = GetKind(object);
+    Buffer::Iterator i = start;
+    i.WriteU8(kind);
+    i.WriteU32(GetSerializedSize(object) - 1 - 4);
+
+    switch (kind)
+    {
+    case KIND_UNIT_CONVERSION_COLLECTOR:
+        DynamicCast<const UnitConversionCollector>(object)->SerializeState(i);
+        break;
+    case KIND_SCALAR_COLLECTOR:
+        DynamicCast<const ScalarCollector>(object)->SerializeState(i);
+        break;
+    case KIND_INTERVAL_RATE_COLLECTOR:
+        DynamicCast<const IntervalRateCollector>(object)->SerializeState(i);
+        break;
+    case KIND_DISTRIBUTION_COLLECTOR:
+        DynamicCast<const DistributionCollector>(object)->SerializeState(i);
+        break;
+    case KIND_COLLECTOR_BANK:
+        DynamicCast<const CollectorBank>(object)->SerializeState(i);
+        break;
+    case KIND_MULTI_FILE_AGGREGATOR:
+        DynamicCast<const MultiFileAggregator>(object)->SerializeState(i);
+        break;
+    default:
+        break;
+    }
+}
+
+uint32_t // static
+CollectorState::Deserialize(Ptr<DataCollectionObject> object, Buffer::Iterator start)
+{
+    Buffer::Iterator i = start;
+    const uint8_t kind = i.ReadU8();
+    const uint32_t size = i.ReadU32();
+
+    if (kind != GetKind(object))
+    {
+        NS_FATAL_ERROR("The saved state of type " << static_cast<uint32_t>(kind)
+                                                  << " does not match object "
+                                                  << (object == nullptr ? "(null)"
+                                                                        : object->GetName())
+                                                  << " of type " << GetKind(object));
+    }
+
+    uint32_t read = 0;
+    switch (kind)
+    {
+    case KIND_UNIT_CONVERSION_COLLECTOR:
+        read = DynamicCast<UnitConversionCollector>(object)->DeserializeState(i);
+        break;
+    case KIND_SCALAR_COLLECTOR:
+        read = DynamicCast<ScalarCollector>(object)->DeserializeState(i);
+        break;
+    case KIND_INTERVAL_RATE_COLLECTOR:
+        read = DynamicCast<IntervalRateCollector>(object)->DeserializeState(i);
+        break;
+    case KIND_DISTRIBUTION_COLLECTOR:
+        read = DynamicCast<DistributionCollector>(object)->DeserializeState(i);
+        break;
+    case KIND_COLLECTOR_BANK:
+        read = DynamicCast<CollectorBank>(object)->DeserializeState(i);
+        break;
+    case KIND_MULTI_FILE_AGGREGATOR:
+        read = DynamicCast<MultiFileAggregator>(object)->DeserializeState(i);
+        break;
+    default:
+        break;
+    }
+
+    NS_ASSERT_MSG(read == size,
+                  "Read " << read << " bytes of the saved state of " << object->GetName()
+                          << " instead of " << size);
+    NS_LOG_LOGIC("restored " << read << " bytes of state of type "
+                             << static_cast<uint32_t>(kind));
+    return 1 + 4 + size;
+}
+
+} // end of namespace ns3
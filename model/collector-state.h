@@ -0,0 +1,152 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#ifndef COLLECTOR_STATE_H
+#define COLLECTOR_STATE_H
+
+#include "ns3/buffer.h"
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+
+#include <stdint.h>
+#include <string>
+
+namespace ns3
+{
+
+class DataCollectionObject;
+
+/**
+ * @ingroup aggregator
+ * @brief Saving and restoring the accumulated state of collectors and
+ *        aggregators, e.g., to resume a long simulation from a checkpoint.
+ *
+ * Collectors and aggregators whose state grows during the simulation (e.g.,
+ * sums, sample counts, the time of the first and last samples, bins, settling
+ * samples, and pending interval accumulators) provide three methods, in the
+ * same fashion as an ns-3 Header:
+ * - `uint32_t GetSerializedStateSize () const`;
+ * - `void SerializeState (Buffer::Iterator start) const`;
+ * - `uint32_t DeserializeState (Buffer::Iterator start)`, which returns the
+ *   number of bytes read.
+ *
+ * Only the state is saved, not the configuration, so the state must be
+ * restored into an object configured and installed in the same way as the
+ * object it was saved from. Times are saved as absolute simulation times.
+ *
+ * This class hosts the encoding of the values which Buffer::Iterator does not
+ * support directly, and the saving and restoring of any DataCollectionObject,
+ * which are stored as records tagged with the type of the object so that a
+ * mismatch is detected when restoring.
+ */
+class CollectorState
+{
+  public:
+    /**
+     * @param i the iterator to write to, advanced past the value.
+     * @param value the value to write.
+     */
+    static void WriteDouble(Buffer::Iterator& i, double value);
+
+    /**
+     * @param i the iterator to read from, advanced past the value.
+     * @return the value read.
+     */
+    static double ReadDouble(Buffer::Iterator& i);
+
+    /**
+     * @param i the iterator to write to, advanced past the value.
+     * @param value the value to write.
+     */
+    static void WriteTime(Buffer::Iterator& i, const Time& value);
+
+    /**
+     * @param i the iterator to read from, advanced past the value.
+     * @return the value read.
+     */
+    static Time ReadTime(Buffer::Iterator& i);
+
+    /**
+     * @param s a string.
+     * @return the number of bytes written by WriteString().
+     */
+    static uint32_t GetStringSize(const std::string& s);
+
+    /**
+     * @param i the iterator to write to, advanced past the string.
+     * @param s the string to write, preceded by its length.
+     */
+    static void WriteString(Buffer::Iterator& i, const std::string& s);
+
+    /**
+     * @param i the iterator to read from, advanced past the string.
+     * @return the string read.
+     */
+    static std::string ReadString(Buffer::Iterator& i);
+
+    /**
+     * @param object a collector or aggregator, or a null pointer.
+     * @return the number of bytes written by Serialize() for the object.
+     */
+    static uint32_t GetSerializedSize(Ptr<const DataCollectionObject> object);
+
+    /**
+     * @brief Save the state of a collector or aggregator as a record tagged
+     *        with the type of the object. Objects without any state, e.g.,
+     *        probes, are saved as empty records.
+     * @param object a collector or aggregator, or a null pointer.
+     * @param start the iterator to write to.
+     */
+    static void Serialize(Ptr<const DataCollectionObject> object, Buffer::Iterator start);
+
+    /**
+     * @brief Restore the state saved by Serialize() into an object of the
+     *        same type.
+     * @param object a collector or aggregator, or a null pointer.
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     */
+    static uint32_t Deserialize(Ptr<DataCollectionObject> object, Buffer::Iterator start);
+
+  private:
+    /// The type of the object saved in a record.
+    typedef enum
+    {
+        KIND_NONE = 0,
+        KIND_SCALAR_COLLECTOR,
+        KIND_DISTRIBUTION_COLLECTOR,
+        KIND_INTERVAL_RATE_COLLECTOR,
+        KIND_UNIT_CONVERSION_COLLECTOR,
+        KIND_COLLECTOR_BANK,
+        KIND_MULTI_FILE_AGGREGATOR
+    } Kind_t;
+
+    /**
+     * @param object a collector or aggregator, or a null pointer.
+     * @return the type of the object, or `KIND_NONE` if it does not have
+     *         any state to save.
+     */
+    static Kind_t GetKind(Ptr<const DataCollectionObject> object);
+
+}; // end of class CollectorState
+
+} // end of namespace ns3
+
+#endif /* COLLECTOR_STATE_H */
@@ -22,7 +22,9 @@
 
 #include "distribution-collector.h"
 
+#include "collector-state.h"
 #include "magister-stats.h"
+#include "memory-usage.h"
 
 #include "ns3/boolean.h"
 #include "ns3/double.h"
@@ -32,6 +34,7 @@
 #include "ns3/simulator.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <limits>
@@ -81,6 +84,7 @@ DistributionCollector::DistributionCollector()
       m_numOfBins(500),
       m_outOfBoundLimit(0.10),
       m_isInitialized(false),
+      m_moments(),
       m_bins(0),
       m_binType(DistributionCollector::BIN_TYPE_ADAPTIVE),
       m_smallestSettlingSamples(std::numeric_limits<double>::max()),
@@ -332,7 +336,7 @@ DistributionCollector::DoDispose()
         }
 
         case DistributionCollector::OUTPUT_TYPE_PROBABILITY: {
-            const uint32_t n = m_calculator.getCount();
+            const uint32_t n = m_moments.count;
 
             if (n == 0)
             {
@@ -353,7 +357,7 @@ DistributionCollector::DoDispose()
         }
 
         case DistributionCollector::OUTPUT_TYPE_CUMULATIVE: {
-            const uint32_t n = m_calculator.getCount();
+            const uint32_t n = m_moments.count;
 
             if (n == 0)
             {
@@ -424,14 +428,14 @@ DistributionCollector::DoDispose()
 
         // Other trace sources are taken from the online calculator.
 
-        m_outputCount(m_calculator.getCount());
-        m_outputSum(m_calculator.getSum());
-        m_outputMin(m_calculator.getMin());
-        m_outputMax(m_calculator.getMax());
-        m_outputMean(m_calculator.getMean());
-        m_outputStddev(m_calculator.getStddev());
-        m_outputVariance(m_calculator.getVariance());
-        m_outputSqrSum(m_calculator.getSqrSum());
+        m_outputCount(m_moments.count);
+        m_outputSum(m_moments.sum);
+        m_outputMin(m_moments.min);
+        m_outputMax(m_moments.max);
+        m_outputMean(GetMean());
+        m_outputStddev(std::sqrt(GetVariance()));
+        m_outputVariance(GetVariance());
+        m_outputSqrSum(m_moments.sqrSum);
 
         // Compute output for `OutputString` trace source.
 
@@ -441,14 +445,14 @@ DistributionCollector::DoDispose()
         oss << "% bin_length: " << m_bins->GetBinLength() << std::endl;
         oss << "% num_of_bins: " << m_bins->GetNumOfBins() << std::endl;
         oss << "% output_type: '" << GetOutputTypeName(m_outputType) << "'" << std::endl;
-        oss << "% count: " << m_calculator.getCount() << std::endl;
-        oss << "% sum: " << m_calculator.getSum() << std::endl;
-        oss << "% min: " << m_calculator.getMin() << std::endl;
-        oss << "% max: " << m_calculator.getMax() << std::endl;
-        oss << "% mean: " << m_calculator.getMean() << std::endl;
-        oss << "% stddev: " << m_calculator.getStddev() << std::endl;
-        oss << "% variance: " << m_calculator.getVariance() << std::endl;
-        oss << "% sqr_sum: " << m_calculator.getSqrSum() << std::endl;
+        oss << "% count: " << m_moments.count << std::endl;
+        oss << "% sum: " << m_moments.sum << std::endl;
+        oss << "% min: " << m_moments.min << std::endl;
+        oss << "% max: " << m_moments.max << std::endl;
+        oss << "% mean: " << GetMean() << std::endl;
+        oss << "% stddev: " << std::sqrt(GetVariance()) << std::endl;
+        oss << "% variance: " << GetVariance() << std::endl;
+        oss << "% sqr_sum: " << m_moments.sqrSum << std::endl;
 
         if (m_outputType == DistributionCollector::OUTPUT_TYPE_CUMULATIVE)
         {
@@ -562,12 +566,116 @@ DistributionCollector::GetAllowOnlyPositiveValues() const
     return m_allowOnlyPositiveValues;
 }
 
+uint64_t
+DistributionCollector::GetMemoryUsage() const
+{
+    uint64_t usage = sizeof(DistributionCollector);
+
+    if (m_bins != nullptr)
+    {
+        usage += m_bins->GetMemoryUsage();
+    }
+
+    return usage;
+}
+
+uint32_t
+DistributionCollector::GetSerializedStateSize() const
+{
+    NS_ASSERT_MSG(m_isInitialized, "The bins of " << GetName() << " have not been initialized");
+    return 4 + 8 * 6 + m_bins->GetSerializedStateSize();
+}
+
+void
+DistributionCollector::SerializeState(Buffer::Iterator start) const
+{
+    NS_ASSERT_MSG(m_isInitialized, "The bins of " << GetName() << " have not been initialized");
+    Buffer::Iterator i = start;
+    i.WriteU32(m_moments.count);
+    CollectorState::WriteDouble(i, m_moments.sum);
+    CollectorState::WriteDouble(i, m_moments.sqrSum);
+    CollectorState::WriteDouble(i, m_moments.min);
+    CollectorState::WriteDouble(i, m_moments.max);
+    CollectorState::WriteDouble(i, m_moments.mean);
+    CollectorState::WriteDouble(i, m_moments.s);
+    m_bins->SerializeState(i);
+}
+
+uint32_t
+DistributionCollector::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this << GetName());
+
+    if (!m_isInitialized)
+    {
+        NS_FATAL_ERROR("This collector instance has not been initialized yet.");
+    }
+
+    Buffer::Iterator i = start;
+    m_moments.count = i.ReadU32();
+    m_moments.sum = CollectorState::ReadDouble(i);
+    m_moments.sqrSum = CollectorState::ReadDouble(i);
+    m_moments.min = CollectorState::ReadDouble(i);
+    m_moments.max = CollectorState::ReadDouble(i);
+    m_moments.mean = CollectorState::ReadDouble(i);
+    m_moments.s = CollectorState::ReadDouble(i);
+    i.Next(m_bins->DeserializeState(i));
+    return i.GetDistanceFrom(start);
+}
+
+void
+DistributionCollector::UpdateMoments(double sample)
+{
+    m_moments.count++;
+    m_moments.sum += sample;
+    m_moments.sqrSum += sample * sample;
+
+    if (m_moments.count == 1)
+    {
+        m_moments.min = sample;
+        m_moments.max = sample;
+        m_moments.mean = sample;
+        m_moments.s = 0.0;
+    }
+    else
+    {
+        m_moments.min = std::min(m_moments.min, sample);
+        m_moments.max = std::max(m_moments.max, sample);
+        const double prevMean = m_moments.mean;
+        m_moments.mean = prevMean + (sample - prevMean) / m_moments.count;
+        m_moments.s += (sample - prevMean) * (sample - m_moments.mean);
+    }
+}
+
+double
+DistributionCollector::GetMean() const
+{
+    if (m_moments.count == 0)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    return m_moments.mean;
+}
+
+double
+DistributionCollector::GetVariance() const
+{
+    if (m_moments.count == 0)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    return m_moments.count > 1 ? m_moments.s / (m_moments.count - 1) : 0.0;
+}
+
 // TRACE SINKS ////////////////////////////////////////////////////////////////
 
 void
 DistributionCollector::TraceSinkDouble1(double newData)
 {
     // NS_LOG_FUNCTION (this << GetName () << newData);
+    StatsProfiler::Scope profileScope(m_profile.Get("DistributionCollector", this));
 
     if (!m_isInitialized)
     {
@@ -577,7 +685,7 @@ DistributionCollector::TraceSinkDouble1(double newData)
     if (IsEnabled())
     {
         m_bins->NewSample(newData);
-        m_calculator.Update(newData);
+        UpdateMoments(newData);
     }
 }
 
@@ -1133,4 +1241,74 @@ StaticBins::NewSample(double newSample)
     }
 }
 
+uint64_t
+DistributionBins::GetMemoryUsage() const
+{
+    // AdaptiveBins and StaticBins do not have any members of their own.
+    return sizeof(DistributionBins) +
+           MemoryUsage::GetListUsage(m_settlingSamples.size(), sizeof(double)) +
+           MemoryUsage::GetVectorUsage(m_bins);
+}
+
+uint32_t
+DistributionBins::GetSerializedStateSize() const
+{
+    return 4 + 8 * m_settlingSamples.size() + 8 + 8 + 4 + 4 + 4 + 4 * m_bins.size() + 8 + 8 + 8 +
+           4 + 1;
+}
+
+void
+DistributionBins::SerializeState(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    i.WriteU32(m_settlingSamples.size());
+    for (const double sample : m_settlingSamples)
+    {
+        CollectorState::WriteDouble(i, sample);
+    }
+    CollectorState::WriteDouble(i, m_smallestSettlingSamples);
+    CollectorState::WriteDouble(i, m_largestSettlingSamples);
+    i.WriteU32(m_numOfSamples);
+    i.WriteU32(m_numOfOutOfBounds);
+
+    i.WriteU32(m_bins.size());
+    for (const uint32_t count : m_bins)
+    {
+        i.WriteU32(count);
+    }
+    CollectorState::WriteDouble(i, m_binsMinValue);
+    CollectorState::WriteDouble(i, m_binsMaxValue);
+    CollectorState::WriteDouble(i, m_binLength);
+    i.WriteU32(m_numOfBins);
+    i.WriteU8(m_isSettled ? 1 : 0);
+}
+
+uint32_t
+DistributionBins::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this);
+    Buffer::Iterator i = start;
+    m_settlingSamples.clear();
+    for (uint32_t n = i.ReadU32(); n > 0; n--)
+    {
+        m_settlingSamples.push_back(CollectorState::ReadDouble(i));
+    }
+    m_smallestSettlingSamples = CollectorState::ReadDouble(i);
+    m_largestSettlingSamples = CollectorState::ReadDouble(i);
+    m_numOfSamples = i.ReadU32();
+    m_numOfOutOfBounds = i.ReadU32();
+
+    m_bins.resize(i.ReadU32());
+    for (uint32_t& count : m_bins)
+    {
+        count = i.ReadU32();
+    }
+    m_binsMinValue = CollectorState::ReadDouble(i);
+    m_binsMaxValue = CollectorState::ReadDouble(i);
+    m_binLength = CollectorState::ReadDouble(i);
+    m_numOfBins = i.ReadU32();
+    m_isSettled = (i.ReadU8() != 0);
+    return i.GetDistanceFrom(start);
+}
+
 } // end of namespace ns3
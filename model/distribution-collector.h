@@ -22,7 +22,9 @@
 #ifndef DISTRIBUTION_COLLECTOR_H
 #define DISTRIBUTION_COLLECTOR_H
 
-#include "ns3/basic-data-calculators.h"
+#include "stats-profiler.h"
+
+#include "ns3/buffer.h"
 #include "ns3/callback.h"
 #include "ns3/data-collection-object.h"
 #include "ns3/traced-callback.h"
@@ -176,6 +178,31 @@ class DistributionBins : public Object
      */
     uint32_t GetNumOfOutOfBounds() const;
 
+    /**
+     * @return the memory used by the instance, including the bins and the
+     *         settling samples, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * @return the number of bytes written by SerializeState().
+     */
+    uint32_t GetSerializedStateSize() const;
+
+    /**
+     * @brief Save the settling samples, the bins and whether they are
+     *        settled, see CollectorState.
+     * @param start the iterator to write to.
+     */
+    void SerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by SerializeState().
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     */
+    uint32_t DeserializeState(Buffer::Iterator start);
+
     // Inherited from Object base class
     virtual void DoDispose();
 
@@ -718,6 +745,34 @@ class DistributionCollector : public DataCollectionObject
      */
     typedef void (*WarningCallback)();
 
+    /**
+     * @return the memory used by the instance, including the bins and the
+     *         settling samples, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * @return the number of bytes written by SerializeState().
+     */
+    uint32_t GetSerializedStateSize() const;
+
+    /**
+     * @brief Save the online statistics and the state of the bins, see
+     *        CollectorState.
+     * @param start the iterator to write to.
+     *
+     * The bins must have been initialized, see InitializeBins().
+     */
+    void SerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by SerializeState() into a collector
+     *        with initialized bins of the same type.
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     */
+    uint32_t DeserializeState(Buffer::Iterator start);
+
   protected:
     // Inherited from Object base class
     virtual void DoDispose();
@@ -779,8 +834,43 @@ class DistributionCollector : public DataCollectionObject
 
     TracedCallback<> m_warning; ///< `Warning` trace source.
 
+    /**
+     * @brief Online computing of most of the statistical information, with
+     *        the same results as MinMaxAvgTotalCalculator, but whose state
+     *        can be saved and restored.
+     */
+    typedef struct
+    {
+        uint32_t count; ///< Number of samples.
+        double sum;     ///< Sum of the samples.
+        double sqrSum;  ///< Sum of the squares of the samples.
+        double min;     ///< Smallest sample.
+        double max;     ///< Largest sample.
+        double mean;    ///< Running mean, using Welford's method.
+        double s;       ///< Running sum of squared deviations from the mean.
+    } Moments_t;
+
+    /**
+     * @brief Add a sample to #m_moments.
+     * @param sample the input sample.
+     */
+    void UpdateMoments(double sample);
+
+    /**
+     * @return the mean of the samples in #m_moments, or NaN if there is no
+     *         sample, like MinMaxAvgTotalCalculator.
+     */
+    double GetMean() const;
+
+    /**
+     * @return the sample variance of the samples in #m_moments, zero if there
+     *         is a single sample, or NaN if there is no sample, like
+     *         MinMaxAvgTotalCalculator.
+     */
+    double GetVariance() const;
+
     /// Tools for online computing of most of the statistical information.
-    MinMaxAvgTotalCalculator<double> m_calculator;
+    Moments_t m_moments;
 
     /// The bin categories.
     Ptr<DistributionBins> m_bins;
@@ -790,6 +880,8 @@ class DistributionCollector : public DataCollectionObject
     double m_largestSettlingSamples;  ///< Largest value in the storage.
     bool m_allowOnlyPositiveValues;   ///< Allow only positive values.
 
+    StatsProfiler::Handle m_profile; ///< Profiling counters, see StatsProfiler.
+
 }; // end of class DistributionCollector
 
 } // end of namespace ns3
@@ -0,0 +1,67 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#include "event-time-cache.h"
+
+#include "ns3/assert.h"
+#include "ns3/simulator.h"
+
+namespace ns3
+{
+
+EventTimeCache::Entry_t& // static
+EventTimeCache::GetEntry()
+{
+    // Time steps are never negative, hence the first lookup always misses.
+    static Entry_t entry = {-1, 0, {}};
+    return entry;
+}
+
+double // static
+EventTimeCache::GetNow(Time::Unit unit)
+{
+    NS_ASSERT_MSG(unit < Time::LAST, "Invalid time unit " << unit);
+
+    Entry_t& entry = GetEntry();
+    const int64_t timeStep = Simulator::Now().GetTimeStep();
+
+    if (timeStep != entry.timeStep)
+    {
+        entry.timeStep = timeStep;
+        entry.convertedMask = 0;
+    }
+
+    const uint32_t bit = 1U << unit;
+    if ((entry.convertedMask & bit) == 0)
+    {
+        entry.values[unit] = TimeStep(timeStep).ToDouble(unit);
+        entry.convertedMask |= bit;
+    }
+
+    return entry.values[unit];
+}
+
+double // static
+EventTimeCache::GetNowSeconds()
+{
+    return GetNow(Time::S);
+}
+
+} // end of namespace ns3
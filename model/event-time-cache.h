@@ -0,0 +1,84 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#ifndef EVENT_TIME_CACHE_H
+#define EVENT_TIME_CACHE_H
+
+#include "ns3/nstime.h"
+
+#include <stdint.h>
+
+namespace ns3
+{
+
+/**
+ * @ingroup aggregator
+ * @brief Cache of the current simulation time, converted to each time unit
+ *        at most once per simulation event.
+ *
+ * A single packet often fans out to several collectors, each of them
+ * converting the current simulation time into `double` in its own time unit.
+ * The conversion (a 128-bit fixed point multiplication) is repeated for every
+ * collector, although the result is the same within the same event.
+ *
+ * GetNow() returns the current simulation time in the requested unit. The
+ * converted value is kept until the simulation time advances, so subsequent
+ * calls within the same event (and within other events scheduled at the same
+ * time step) only compare the current time step against the cached one. The
+ * cache is keyed on the time step rather than on the event's identity,
+ * because the converted value only depends on the former; this also keeps
+ * the cache valid across consecutive simulation runs in the same process.
+ *
+ * The cache is shared by every user within the process and is not
+ * thread-safe, which is consistent with the sequential simulator.
+ */
+class EventTimeCache
+{
+  public:
+    /**
+     * @param unit the requested time unit.
+     * @return the current simulation time, expressed in the given unit.
+     */
+    static double GetNow(Time::Unit unit);
+
+    /**
+     * @return the current simulation time, expressed in seconds.
+     */
+    static double GetNowSeconds();
+
+  private:
+    /// The cached conversions of a single time step.
+    struct Entry_t
+    {
+        int64_t timeStep;          ///< The time step of the cached values.
+        uint32_t convertedMask;    ///< Bit `i` is set when `values[i]` is valid.
+        double values[Time::LAST]; ///< Converted value per time unit.
+    };
+
+    /**
+     * @return the process-wide cache entry.
+     */
+    static Entry_t& GetEntry();
+
+}; // end of class EventTimeCache
+
+} // end of namespace ns3
+
+#endif /* EVENT_TIME_CACHE_H */
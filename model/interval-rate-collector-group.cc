@@ -0,0 +1,253 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "interval-rate-collector-group.h"
+
+#include "collector-state.h"
+#include "interval-rate-collector.h"
+#include "memory-usage.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+
+NS_LOG_COMPONENT_DEFINE("IntervalRateCollectorGroup");
+
+namespace ns3
+{
+
+NS_OBJECT_ENSURE_REGISTERED(IntervalRateCollectorGroup);
+
+IntervalRateCollectorGroup::IntervalRateCollectorGroup()
+    : m_numOfCollectors(0),
+      m_nextReset(),
+      m_intervalLength(Seconds(1.0))
+{
+    NS_LOG_FUNCTION(this);
+
+    // Delayed start to ensure attributes are completely initialized.
+    Simulator::ScheduleNow(&IntervalRateCollectorGroup::FirstInterval, this);
+}
+
+TypeId // static
+IntervalRateCollectorGroup::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::IntervalRateCollectorGroup")
+            .SetParent<Object>()
+            .AddConstructor<IntervalRateCollectorGroup>()
+            .AddAttribute("IntervalLength",
+                          "The length of each interval, shared by every registered "
+                          "collector. Overrides the `IntervalLength` attribute of "
+                          "the collectors. Note that an interval length of zero "
+                          "prevents the collectors from emitting any interval output.",
+                          TimeValue(Seconds(1.0)),
+                          MakeTimeAccessor(&IntervalRateCollectorGroup::SetIntervalLength,
+                                           &IntervalRateCollectorGroup::GetIntervalLength),
+                          MakeTimeChecker());
+    return tid;
+}
+
+void
+IntervalRateCollectorGroup::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    Simulator::Cancel(m_nextReset);
+    m_collectors.clear();
+    m_sumsDouble.clear();
+    m_sumsUinteger.clear();
+    m_numOfSamples.clear();
+    m_numOfCollectors = 0;
+    Object::DoDispose();
+}
+
+void
+IntervalRateCollectorGroup::SetIntervalLength(Time intervalLength)
+{
+    NS_LOG_FUNCTION(this << intervalLength.GetSeconds());
+    m_intervalLength = intervalLength;
+}
+
+Time
+IntervalRateCollectorGroup::GetIntervalLength() const
+{
+    return m_intervalLength;
+}
+
+uint32_t
+IntervalRateCollectorGroup::Register(IntervalRateCollector* collector)
+{
+    NS_LOG_FUNCTION(this << collector);
+    NS_ASSERT(collector != nullptr);
+
+    m_collectors.push_back(collector);
+    m_sumsDouble.push_back(0.0);
+    m_sumsUinteger.push_back(0);
+    m_numOfSamples.push_back(0);
+    m_numOfCollectors++;
+    return m_collectors.size() - 1;
+}
+
+void
+IntervalRateCollectorGroup::Unregister(uint32_t index)
+{
+    NS_LOG_FUNCTION(this << index);
+
+    if (index < m_collectors.size() && m_collectors[index] != nullptr)
+    {
+        // The slot is kept, so that the other indices remain valid.
+        m_collectors[index] = nullptr;
+        m_numOfCollectors--;
+    }
+}
+
+uint32_t
+IntervalRateCollectorGroup::GetNumOfCollectors() const
+{
+    return m_numOfCollectors;
+}
+
+void
+IntervalRateCollectorGroup::FirstInterval()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_intervalLength > MilliSeconds(0))
+    {
+        // Schedule the next interval
+        m_nextReset =
+            Simulator::Schedule(m_intervalLength, &IntervalRateCollectorGroup::NewInterval, this);
+    }
+}
+
+void
+IntervalRateCollectorGroup::NewInterval()
+{
+    NS_LOG_FUNCTION(this << m_numOfCollectors);
+    StatsProfiler::Scope profileScope(m_profile.Get("IntervalRateCollectorGroup", ""));
+
+    const Time now = Simulator::Now();
+    const uint32_t n = m_collectors.size();
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        IntervalRateCollector* collector = m_collectors[i];
+        if (collector != nullptr)
+        {
+            collector->EmitInterval(now, m_sumsDouble[i], m_sumsUinteger[i], m_numOfSamples[i]);
+        }
+    }
+
+    // Reset the accumulated values.
+    std::fill(m_sumsDouble.begin(), m_sumsDouble.end(), 0.0);
+    std::fill(m_sumsUinteger.begin(), m_sumsUinteger.end(), 0);
+    std::fill(m_numOfSamples.begin(), m_numOfSamples.end(), 0);
+
+    if (m_intervalLength > MilliSeconds(0))
+    {
+        // Schedule the next interval
+        m_nextReset =
+            Simulator::Schedule(m_intervalLength, &IntervalRateCollectorGroup::NewInterval, this);
+    }
+}
+
+uint64_t
+IntervalRateCollectorGroup::GetMemoryUsage() const
+{
+    return sizeof(IntervalRateCollectorGroup) + MemoryUsage::GetVectorUsage(m_collectors) +
+           MemoryUsage::GetVectorUsage(m_sumsDouble) +
+           MemoryUsage::GetVectorUsage(m_sumsUinteger) +
+           MemoryUsage::GetVectorUsage(m_numOfSamples);
+}
+
+uint32_t
+IntervalRateCollectorGroup::GetSerializedStateSize() const
+{
+    return 4 + (8 + 8 + 4) * m_collectors.size() + 1 + 8;
+}
+
+void
+IntervalRateCollectorGroup::SerializeState(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    const uint32_t n = m_collectors.size();
+    i.WriteU32(n);
+
+    for (uint32_t j = 0; j < n; j++)
+    {
+        CollectorState::WriteDouble(i, m_sumsDouble[j]);
+        i.WriteU64(m_sumsUinteger[j]);
+        i.WriteU32(m_numOfSamples[j]);
+    }
+
+    // The next reset, as an absolute time.
+    const bool isResetPending = !m_nextReset.IsExpired();
+    i.WriteU8(isResetPending ? 1 : 0);
+    CollectorState::WriteTime(i,
+                              isResetPending
+                                  ? Simulator::Now() + Simulator::GetDelayLeft(m_nextReset)
+                                  : Seconds(0));
+}
+
+uint32_t
+IntervalRateCollectorGroup::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this);
+    Buffer::Iterator i = start;
+    const uint32_t n = i.ReadU32();
+
+    if (n != m_collectors.size())
+    {
+        NS_FATAL_ERROR("The saved state has " << n << " collectors, but the group has "
+                                              << m_collectors.size());
+    }
+
+    for (uint32_t j = 0; j < n; j++)
+    {
+        m_sumsDouble[j] = CollectorState::ReadDouble(i);
+        m_sumsUinteger[j] = i.ReadU64();
+        m_numOfSamples[j] = i.ReadU32();
+    }
+
+    const bool isResetPending = (i.ReadU8() != 0);
+    const Time nextReset = CollectorState::ReadTime(i);
+
+    if (isResetPending)
+    {
+        if (nextReset > Simulator::Now())
+        {
+            m_nextReset.Cancel();
+            m_nextReset = Simulator::Schedule(nextReset - Simulator::Now(),
+                                              &IntervalRateCollectorGroup::NewInterval,
+                                              this);
+        }
+        else
+        {
+            NS_LOG_WARN(this << " restores an interval ending at " << nextReset.GetSeconds()
+                             << " which has already passed");
+        }
+    }
+
+    return i.GetDistanceFrom(start);
+}
+
+} // end of namespace ns3
@@ -0,0 +1,202 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef INTERVAL_RATE_COLLECTOR_GROUP_H
+#define INTERVAL_RATE_COLLECTOR_GROUP_H
+
+#include "stats-profiler.h"
+
+#include "ns3/buffer.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3
+{
+
+class IntervalRateCollector;
+
+/**
+ * @ingroup aggregator
+ * @brief Shared interval clock for a group of IntervalRateCollector
+ *        instances.
+ *
+ * Normally, every IntervalRateCollector schedules its own event at the end of
+ * each interval. Collectors which are registered to a group (see
+ * IntervalRateCollector::SetIntervalGroup()) schedule no event at all.
+ * Instead, the group schedules a single event for each interval boundary.
+ *
+ * The per-interval accumulators of the registered collectors are kept by the
+ * group in contiguous arrays, i.e., one array of sums and one array of sample
+ * counts, each indexed by the registration index of the collector. At every
+ * interval boundary, the group sweeps these arrays once, lets each collector
+ * emit its interval output through its own trace sources, and then resets the
+ * arrays.
+ *
+ * The input samples are accumulated within the trace sinks of the registered
+ * collectors, so StatsProfiler counts them there. The profiler counts each
+ * interval boundary of the group as one call, which includes the output of
+ * every registered collector.
+ *
+ * The output of the registered collectors is identical to the output they
+ * would emit on their own, provided that they are created at the same time as
+ * the group and use the same interval length. The `IntervalLength` attribute
+ * of the group overrides that of the registered collectors.
+ */
+class IntervalRateCollectorGroup : public Object
+{
+  public:
+    /// Creates a new group instance.
+    IntervalRateCollectorGroup();
+
+    // inherited from ObjectBase base class
+    static TypeId GetTypeId();
+
+    /**
+     * @param intervalLength the length of each interval, shared by every
+     *                       registered collector.
+     * @warning Updating this after the simulation has started may produce
+     *          unpredictable behaviour.
+     */
+    void SetIntervalLength(Time intervalLength);
+
+    /**
+     * @return the length of each interval.
+     */
+    Time GetIntervalLength() const;
+
+    /**
+     * @brief Add a collector to the group.
+     * @param collector pointer to the collector.
+     * @return the index of the collector's accumulators in the group.
+     *
+     * Normally called by IntervalRateCollector::SetIntervalGroup().
+     */
+    uint32_t Register(IntervalRateCollector* collector);
+
+    /**
+     * @brief Remove a collector from the group.
+     * @param index the index returned by Register().
+     *
+     * Normally called when the collector is disposed.
+     */
+    void Unregister(uint32_t index);
+
+    /**
+     * @return the number of collectors currently registered to the group.
+     */
+    uint32_t GetNumOfCollectors() const;
+
+    /**
+     * @brief Accumulate a `DOUBLE` input sample of a registered collector.
+     * @param index the index returned by Register().
+     * @param value the input value.
+     */
+    inline void AddDouble(uint32_t index, double value)
+    {
+        m_sumsDouble[index] += value;
+        m_numOfSamples[index]++;
+    }
+
+    /**
+     * @brief Accumulate a `UINTEGER` or `BOOLEAN` input sample of a registered
+     *        collector.
+     * @param index the index returned by Register().
+     * @param value the input value.
+     */
+    inline void AddUinteger(uint32_t index, uint64_t value)
+    {
+        m_sumsUinteger[index] += value;
+        m_numOfSamples[index]++;
+    }
+
+    /**
+     * @return the memory used by the instance, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * @return the number of bytes written by SerializeState().
+     */
+    uint32_t GetSerializedStateSize() const;
+
+    /**
+     * @brief Save the accumulators of the current interval of every
+     *        registered collector, and the end of the current interval, see
+     *        CollectorState.
+     * @param start the iterator to write to.
+     */
+    void SerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by SerializeState() into a group with
+     *        the same number of registered collectors.
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     */
+    uint32_t DeserializeState(Buffer::Iterator start);
+
+  protected:
+    // Inherited from Object base class
+    virtual void DoDispose();
+
+  private:
+    /**
+     * @internal
+     * Start the first interval.
+     */
+    void FirstInterval();
+
+    /**
+     * @internal
+     * End the current interval of every registered collector, reset the
+     * accumulators, and finally start the next interval.
+     */
+    void NewInterval();
+
+    /// The registered collectors; unregistered slots contain null pointers.
+    std::vector<IntervalRateCollector*> m_collectors;
+
+    /// Sum of `DOUBLE` inputs of each collector during the current interval.
+    std::vector<double> m_sumsDouble;
+
+    /// Sum of `UINTEGER` and `BOOLEAN` inputs of each collector during the current interval.
+    std::vector<uint64_t> m_sumsUinteger;
+
+    /// Number of inputs of each collector during the current interval.
+    std::vector<uint32_t> m_numOfSamples;
+
+    /// Number of non-null entries in #m_collectors.
+    uint32_t m_numOfCollectors;
+
+    /// The end time of the current interval and the start time of the next interval.
+    EventId m_nextReset;
+
+    Time m_intervalLength; ///< `IntervalLength` attribute.
+
+    StatsProfiler::Handle m_profile; ///< Profiling counters, see StatsProfiler.
+
+}; // end of class IntervalRateCollectorGroup
+
+} // end of namespace ns3
+
+#endif /* INTERVAL_RATE_COLLECTOR_GROUP_H */
@@ -21,8 +21,13 @@
 
 #include "interval-rate-collector.h"
 
+#include "collector-state.h"
+#include "event-time-cache.h"
 #include "magister-stats.h"
+#include "memory-usage.h"
 
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -78,9 +83,15 @@ IntervalRateCollector::IntervalRateCollector()
       m_intervalNumOfSamples(0),
       m_overallNumOfSamples(0),
       m_nextReset(),
+      m_intervalEnd(Time::Max()),
+      m_intervalGroup(nullptr),
+      m_intervalGroupIndex(0),
+      m_lazyIndex(NOT_LAZY_REGISTERED),
+      m_isLazyRollover(false),
       m_intervalLength(Seconds(1.0)),
       m_inputDataType(IntervalRateCollector::INPUT_DATA_TYPE_DOUBLE),
       m_outputType(IntervalRateCollector::OUTPUT_TYPE_SUM),
+      m_scale(1.0),
       m_timeUnit(Time::S)
 {
     NS_LOG_FUNCTION(this << GetName());
@@ -110,6 +121,17 @@ IntervalRateCollector::GetTypeId()
                           MakeTimeAccessor(&IntervalRateCollector::SetIntervalLength,
                                            &IntervalRateCollector::GetIntervalLength),
                           MakeTimeChecker())
+            .AddAttribute("LazyRollover",
+                          "If true, no event is scheduled for every interval. "
+                          "Instead, the intervals which have passed are ended "
+                          "when the next input sample is received, or when the "
+                          "simulation ends. The emitted output is the same as "
+                          "when this attribute is false, but idle collector "
+                          "instances do not add any event to the simulator.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&IntervalRateCollector::SetLazyRollover,
+                                              &IntervalRateCollector::IsLazyRollover),
+                          MakeBooleanChecker())
             .AddAttribute("InputDataType",
                           "The data type accepted as inputs. "
                           "The value `INPUT_DATA_TYPE_DOUBLE` (the default) will "
@@ -146,6 +168,15 @@ IntervalRateCollector::GetTypeId()
                                           "NUMBER_OF_SAMPLE",
                                           IntervalRateCollector::OUTPUT_TYPE_AVERAGE_PER_SAMPLE,
                                           "AVERAGE_PER_SAMPLE"))
+            .AddAttribute("Scale",
+                          "Factor applied once to every output value, e.g., to "
+                          "complete a linear unit conversion deferred by an "
+                          "upstream UnitConversionCollector. Not applied when the "
+                          "output type is `NUMBER_OF_SAMPLE`.",
+                          DoubleValue(1.0),
+                          MakeDoubleAccessor(&IntervalRateCollector::SetScale,
+                                             &IntervalRateCollector::GetScale),
+                          MakeDoubleChecker<double>())
             .AddAttribute("TimeUnit",
                           "Determines the unit used for the time output (i.e., the "
                           "`OutputWithTime` trace source",
@@ -201,6 +232,20 @@ IntervalRateCollector::DoDispose()
 {
     NS_LOG_FUNCTION(this << GetName());
 
+    if (m_intervalGroup != nullptr)
+    {
+        m_intervalGroup->Unregister(m_intervalGroupIndex);
+        m_intervalGroup = nullptr;
+    }
+
+    if (m_lazyIndex != NOT_LAZY_REGISTERED)
+    {
+        // The shared flush has not been run yet, so close the intervals now.
+        GetLazyCollectors()[m_lazyIndex] = nullptr;
+        m_lazyIndex = NOT_LAZY_REGISTERED;
+        RollOver(Simulator::Now(), false);
+    }
+
     if (IsEnabled())
     {
         double sum = 0.0;
@@ -220,6 +265,8 @@ IntervalRateCollector::DoDispose()
             break;
         }
 
+        sum *= m_scale;
+
         switch (m_outputType)
         {
         case IntervalRateCollector::OUTPUT_TYPE_SUM:
@@ -296,17 +343,113 @@ IntervalRateCollector::SetTimeUnit(Time::Unit unit)
     m_timeUnit = unit;
 }
 
+void
+IntervalRateCollector::SetScale(double scale)
+{
+    NS_LOG_FUNCTION(this << GetName() << scale);
+    m_scale = scale;
+}
+
+double
+IntervalRateCollector::GetScale() const
+{
+    return m_scale;
+}
+
 Time::Unit
 IntervalRateCollector::GetTimeUnit() const
 {
     return m_timeUnit;
 }
 
+void
+IntervalRateCollector::SetLazyRollover(bool lazyRollover)
+{
+    NS_LOG_FUNCTION(this << GetName() << lazyRollover);
+    m_isLazyRollover = lazyRollover;
+}
+
+bool
+IntervalRateCollector::IsLazyRollover() const
+{
+    return m_isLazyRollover;
+}
+
+void
+IntervalRateCollector::SetIntervalGroup(Ptr<IntervalRateCollectorGroup> intervalGroup)
+{
+    NS_LOG_FUNCTION(this << GetName() << intervalGroup);
+
+    if (m_intervalGroup != nullptr)
+    {
+        m_intervalGroup->Unregister(m_intervalGroupIndex);
+    }
+
+    m_intervalGroup = intervalGroup;
+
+    if (m_intervalGroup != nullptr)
+    {
+        if (m_isLazyRollover)
+        {
+            NS_LOG_WARN(this << " lazy rollover is ignored because of the interval group");
+        }
+
+        m_intervalGroupIndex = m_intervalGroup->Register(this);
+    }
+}
+
+Ptr<IntervalRateCollectorGroup>
+IntervalRateCollector::GetIntervalGroup() const
+{
+    return m_intervalGroup;
+}
+
 void
 IntervalRateCollector::FirstInterval()
 {
     NS_LOG_FUNCTION(this << GetName());
 
+    if (m_intervalGroup != nullptr)
+    {
+        // The intervals are driven by the group.
+        return;
+    }
+
+    if (m_intervalLength > MilliSeconds(0))
+    {
+        if (m_isLazyRollover)
+        {
+            // Intervals are ended by incoming samples and by the shared flush.
+            m_intervalEnd = Simulator::Now() + m_intervalLength;
+            std::vector<IntervalRateCollector*>& lazyCollectors = GetLazyCollectors();
+
+            if (lazyCollectors.empty())
+            {
+                Simulator::ScheduleDestroy(&IntervalRateCollector::FlushLazyCollectors);
+            }
+
+            if (m_lazyIndex == NOT_LAZY_REGISTERED)
+            {
+                m_lazyIndex = lazyCollectors.size();
+                lazyCollectors.push_back(this);
+            }
+        }
+        else
+        {
+            // Schedule the next interval
+            m_nextReset =
+                Simulator::Schedule(m_intervalLength, &IntervalRateCollector::NewInterval, this);
+        }
+    }
+}
+
+void
+IntervalRateCollector::NewInterval()
+{
+    NS_LOG_FUNCTION(this << GetName());
+
+    EndInterval(Simulator::Now());
+
     if (m_intervalLength > MilliSeconds(0))
     {
         // Schedule the next interval
@@ -316,31 +459,49 @@ IntervalRateCollector::FirstInterval()
 }
 
 void
-IntervalRateCollector::NewInterval()
+IntervalRateCollector::EndInterval(Time endTime)
 {
-    NS_LOG_FUNCTION(this << GetName());
+    EmitInterval(endTime, m_intervalSumDouble, m_intervalSumUinteger, m_intervalNumOfSamples);
+
+    // Reset the accumulated values.
+    m_intervalSumDouble = 0.0;
+    m_intervalSumUinteger = 0;
+    m_intervalNumOfSamples = 0;
+}
+
+void
+IntervalRateCollector::EmitInterval(Time endTime,
+                                    double sumDouble,
+                                    uint64_t sumUinteger,
+                                    uint32_t numOfSamples)
+{
+    NS_LOG_FUNCTION(this << GetName() << endTime.GetSeconds());
 
     if (IsEnabled())
     {
-        const double time = Simulator::Now().ToDouble(m_timeUnit);
+        // Collectors of the same group share the conversion of the current time.
+        const double time = (endTime == Simulator::Now()) ? EventTimeCache::GetNow(m_timeUnit)
+                                                          : endTime.ToDouble(m_timeUnit);
 
         double sum = 0.0;
 
         switch (m_inputDataType)
         {
         case IntervalRateCollector::INPUT_DATA_TYPE_DOUBLE:
-            sum = m_intervalSumDouble;
+            sum = sumDouble;
             break;
 
         case IntervalRateCollector::INPUT_DATA_TYPE_UINTEGER:
         case IntervalRateCollector::INPUT_DATA_TYPE_BOOLEAN:
-            sum = static_cast<double>(m_intervalSumUinteger);
+            sum = static_cast<double>(sumUinteger);
             break;
 
         default:
             break;
         }
 
+        sum *= m_scale;
+
         switch (m_outputType)
         {
         case IntervalRateCollector::OUTPUT_TYPE_SUM:
@@ -349,13 +510,13 @@ IntervalRateCollector::NewInterval()
             break;
 
         case IntervalRateCollector::OUTPUT_TYPE_NUMBER_OF_SAMPLE:
-            m_outputWithTime(time, m_intervalNumOfSamples);
-            m_outputWithoutTime(m_intervalNumOfSamples);
+            m_outputWithTime(time, numOfSamples);
+            m_outputWithoutTime(numOfSamples);
             break;
 
         case IntervalRateCollector::OUTPUT_TYPE_AVERAGE_PER_SAMPLE: {
             // This may produce -nan if number of sample is zero.
-            const double ratio = sum / static_cast<double>(m_intervalNumOfSamples);
+            const double ratio = sum / static_cast<double>(numOfSamples);
             m_outputWithTime(time, ratio);
             m_outputWithoutTime(ratio);
             break;
@@ -365,32 +526,154 @@ IntervalRateCollector::NewInterval()
             break;
         }
     }
+}
 
-    // Reset the accumulated values.
-    m_intervalSumDouble = 0.0;
-    m_intervalSumUinteger = 0;
-    m_intervalNumOfSamples = 0;
+void
+IntervalRateCollector::RollOver(Time now, bool isBoundaryIncluded)
+{
+    // NS_LOG_FUNCTION (this << GetName () << now.GetSeconds () << isBoundaryIncluded);
 
-    if (m_intervalLength > MilliSeconds(0))
+    // m_intervalEnd stays at Time::Max() until the first interval has started.
+    while (m_intervalEnd < now || (isBoundaryIncluded && m_intervalEnd == now))
     {
-        // Schedule the next interval
-        m_nextReset =
-            Simulator::Schedule(m_intervalLength, &IntervalRateCollector::NewInterval, this);
+        // Intervals after the first one are empty, i.e., zero-filled gaps.
+        EndInterval(m_intervalEnd);
+        m_intervalEnd += m_intervalLength;
+    }
+}
+
+void // static
+IntervalRateCollector::FlushLazyCollectors()
+{
+    NS_LOG_FUNCTION_NOARGS();
+
+    /*
+     * Like the scheduled events in the default mode, an interval ending exactly
+     * at the time the simulation stops is not regarded as passed. The instances
+     * are flushed in the order they were registered, so that the output of
+     * collectors sharing a file is reproducible from run to run.
+     */
+    const Time now = Simulator::Now();
+    std::vector<IntervalRateCollector*>& lazyCollectors = GetLazyCollectors();
+
+    for (std::vector<IntervalRateCollector*>::iterator it = lazyCollectors.begin();
+         it != lazyCollectors.end();
+         ++it)
+    {
+        if (*it != nullptr)
+        {
+            // The slot of a disposed instance is left empty.
+            (*it)->m_lazyIndex = NOT_LAZY_REGISTERED;
+            (*it)->RollOver(now, false);
+        }
+    }
+
+    lazyCollectors.clear();
+}
+
+std::vector<IntervalRateCollector*>& // static
+IntervalRateCollector::GetLazyCollectors()
+{
+    static std::vector<IntervalRateCollector*> lazyCollectors;
+    return lazyCollectors;
+}
+
+uint64_t
+IntervalRateCollector::GetMemoryUsage() const
+{
+    // The accumulators of a shared interval group are reported by the group.
+    return sizeof(IntervalRateCollector);
+}
+
+uint32_t
+IntervalRateCollector::GetSerializedStateSize() const
+{
+    return 8 + 8 + 8 + 8 + 4 + 4 + 8 + 1 + 8;
+}
+
+void
+IntervalRateCollector::SerializeState(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    CollectorState::WriteDouble(i, m_intervalSumDouble);
+    CollectorState::WriteDouble(i, m_overallSumDouble);
+    i.WriteU64(m_intervalSumUinteger);
+    i.WriteU64(m_overallSumUinteger);
+    i.WriteU32(m_intervalNumOfSamples);
+    i.WriteU32(m_overallNumOfSamples);
+    CollectorState::WriteTime(i, m_intervalEnd);
+
+    // The next reset of the default mode, as an absolute time.
+    const bool isResetPending = !m_nextReset.IsExpired();
+    i.WriteU8(isResetPending ? 1 : 0);
+    CollectorState::WriteTime(i,
+                              isResetPending
+                                  ? Simulator::Now() + Simulator::GetDelayLeft(m_nextReset)
+                                  : Seconds(0));
+}
+
+uint32_t
+IntervalRateCollector::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this << GetName());
+    Buffer::Iterator i = start;
+    m_intervalSumDouble = CollectorState::ReadDouble(i);
+    m_overallSumDouble = CollectorState::ReadDouble(i);
+    m_intervalSumUinteger = i.ReadU64();
+    m_overallSumUinteger = i.ReadU64();
+    m_intervalNumOfSamples = i.ReadU32();
+    m_overallNumOfSamples = i.ReadU32();
+    m_intervalEnd = CollectorState::ReadTime(i);
+
+    const bool isResetPending = (i.ReadU8() != 0);
+    const Time nextReset = CollectorState::ReadTime(i);
+
+    if (isResetPending)
+    {
+        if (nextReset > Simulator::Now())
+        {
+            m_nextReset.Cancel();
+            m_nextReset = Simulator::Schedule(nextReset - Simulator::Now(),
+                                              &IntervalRateCollector::NewInterval,
+                                              this);
+        }
+        else
+        {
+            NS_LOG_WARN(this << " Collector " << GetName() << " restores an interval ending at "
+                             << nextReset.GetSeconds() << " which has already passed");
+        }
     }
+
+    return i.GetDistanceFrom(start);
 }
 
 void
 IntervalRateCollector::TraceSinkDouble(double oldData, double newData)
 {
     NS_LOG_FUNCTION(this << GetName() << oldData << newData);
+    StatsProfiler::Scope profileScope(m_profile.Get("IntervalRateCollector", this));
+
+    if (m_isLazyRollover && m_intervalGroup == nullptr)
+    {
+        // A sample at the interval boundary belongs to the next interval.
+        RollOver(Simulator::Now(), true);
+    }
 
     if (IsEnabled())
     {
         if (m_inputDataType == IntervalRateCollector::INPUT_DATA_TYPE_DOUBLE)
         {
-            m_intervalSumDouble += newData;
+            if (m_intervalGroup != nullptr)
+            {
+                m_intervalGroup->AddDouble(m_intervalGroupIndex, newData);
+            }
+            else
+            {
+                m_intervalSumDouble += newData;
+                m_intervalNumOfSamples++;
+            }
+
             m_overallSumDouble += newData;
-            m_intervalNumOfSamples++;
             m_overallNumOfSamples++;
         }
         else
@@ -426,14 +709,29 @@ void
 IntervalRateCollector::TraceSinkUinteger64(uint64_t oldData, uint64_t newData)
 {
     NS_LOG_FUNCTION(this << GetName() << oldData << newData);
+    StatsProfiler::Scope profileScope(m_profile.Get("IntervalRateCollector", this));
+
+    if (m_isLazyRollover && m_intervalGroup == nullptr)
+    {
+        // A sample at the interval boundary belongs to the next interval.
+        RollOver(Simulator::Now(), true);
+    }
 
     if (IsEnabled())
     {
         if (m_inputDataType == IntervalRateCollector::INPUT_DATA_TYPE_UINTEGER)
         {
-            m_intervalSumUinteger += newData;
+            if (m_intervalGroup != nullptr)
+            {
+                m_intervalGroup->AddUinteger(m_intervalGroupIndex, newData);
+            }
+            else
+            {
+                m_intervalSumUinteger += newData;
+                m_intervalNumOfSamples++;
+            }
+
             m_overallSumUinteger += newData;
-            m_intervalNumOfSamples++;
             m_overallNumOfSamples++;
         }
         else
@@ -448,18 +746,37 @@ void
 IntervalRateCollector::TraceSinkBoolean(bool oldData, bool newData)
 {
     NS_LOG_FUNCTION(this << GetName() << oldData << newData);
+    StatsProfiler::Scope profileScope(m_profile.Get("IntervalRateCollector", this));
+
+    if (m_isLazyRollover && m_intervalGroup == nullptr)
+    {
+        // A sample at the interval boundary belongs to the next interval.
+        RollOver(Simulator::Now(), true);
+    }
 
     if (IsEnabled())
     {
         if (m_inputDataType == IntervalRateCollector::INPUT_DATA_TYPE_BOOLEAN)
         {
+            if (m_intervalGroup != nullptr)
+            {
+                m_intervalGroup->AddUinteger(m_intervalGroupIndex, newData ? 1 : 0);
+            }
+            else
+            {
+                if (newData)
+                {
+                    m_intervalSumUinteger++;
+                }
+
+                m_intervalNumOfSamples++;
+            }
+
             if (newData)
             {
-                m_intervalSumUinteger++;
                 m_overallSumUinteger++;
             }
 
-            m_intervalNumOfSamples++;
             m_overallNumOfSamples++;
         }
         else
@@ -22,12 +22,18 @@
 #ifndef INTERVAL_RATE_COLLECTOR_H
 #define INTERVAL_RATE_COLLECTOR_H
 
+#include "interval-rate-collector-group.h"
+#include "stats-profiler.h"
+
+#include "ns3/buffer.h"
 #include "ns3/data-collection-object.h"
 #include "ns3/event-id.h"
 #include "ns3/nstime.h"
+#include "ns3/ptr.h"
 #include "ns3/traced-callback.h"
 
 #include <string>
+#include <vector>
 
 namespace ns3
 {
@@ -59,6 +65,37 @@ namespace ns3
  * output and reset back to zero. For boolean data type, a `true` value is
  * regarded as 1, while a `false` value is regarded as 0.
  *
+ * The `Scale` attribute specifies a factor which is applied to every output
+ * value (except the number of samples), allowing an upstream linear unit
+ * conversion to be deferred (see
+ * UnitConversionCollector::SetDeferLinearConversion()).
+ *
+ * By default, the end of every interval is a separate event in the simulator.
+ * When the `LazyRollover` attribute is enabled, no event is scheduled at all.
+ * Instead, each incoming input sample first checks whether one or more
+ * interval boundaries have passed since the previous sample, and then emits
+ * the output of those intervals (including empty intervals in between) right
+ * away. The remaining intervals are closed by a single event shared by all
+ * lazy instances, which runs when the simulator is destroyed, or otherwise when
+ * the instance is disposed. The output values and their time information are
+ * identical in both modes, only the moment of emission differs.
+ *
+ * The modes differ only for a sample received exactly at an interval
+ * boundary. In lazy mode, such a sample always belongs to the interval which
+ * begins at the boundary. With scheduled events (including those of an
+ * IntervalRateCollectorGroup), it depends on the order of the simultaneous
+ * events: the sample belongs to the ending interval if its event was
+ * scheduled before the event ending the interval, i.e., earlier than one
+ * interval length before the boundary, and to the next interval otherwise.
+ * In both modes, the unfinished last interval is not emitted, and neither is
+ * an interval ending exactly when the simulation stops, provided that
+ * Simulator::Stop() is called before the simulation runs.
+ *
+ * Alternatively, several instances can share a single event per interval
+ * boundary by registering to the same IntervalRateCollectorGroup (see
+ * SetIntervalGroup()). In this case, the interval accumulators are kept by
+ * the group, and the interval length is determined by the group.
+ *
  * ### Output ###
  * Samples received are *consolidated* using one of 3 available ways (e.g., sum,
  * count, average). It can be selected by calling the SetOutputType() method or
@@ -174,6 +211,16 @@ class IntervalRateCollector : public DataCollectionObject
      */
     OutputType_t GetOutputType() const;
 
+    /**
+     * @param scale the factor applied to every output value.
+     */
+    void SetScale(double scale);
+
+    /**
+     * @return the factor applied to every output value.
+     */
+    double GetScale() const;
+
     /**
      * @param unit the unit used for the time output.
      */
@@ -184,6 +231,34 @@ class IntervalRateCollector : public DataCollectionObject
      */
     Time::Unit GetTimeUnit() const;
 
+    /**
+     * @param lazyRollover whether to end intervals upon receiving input
+     *                     samples, instead of using scheduled events.
+     * @warning Updating this after the simulation has started may produce
+     *          unpredictable behaviour.
+     */
+    void SetLazyRollover(bool lazyRollover);
+
+    /**
+     * @return whether intervals are ended upon receiving input samples.
+     */
+    bool IsLazyRollover() const;
+
+    /**
+     * @param intervalGroup the group which drives the intervals of this
+     *                      instance, or a null pointer to let the instance
+     *                      drive its own intervals.
+     * @warning Updating this after the simulation has started may produce
+     *          unpredictable behaviour.
+     */
+    void SetIntervalGroup(Ptr<IntervalRateCollectorGroup> intervalGroup);
+
+    /**
+     * @return the group which drives the intervals of this instance, or a
+     *         null pointer if none.
+     */
+    Ptr<IntervalRateCollectorGroup> GetIntervalGroup() const;
+
     // TRACE SINKS //////////////////////////////////////////////////////////////
 
     /**
@@ -270,11 +345,45 @@ class IntervalRateCollector : public DataCollectionObject
      */
     void TraceSinkBoolean(bool oldData, bool newData);
 
+    /**
+     * @return the memory used by the instance, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * @return the number of bytes written by SerializeState().
+     */
+    uint32_t GetSerializedStateSize() const;
+
+    /**
+     * @brief Save the accumulators of the current interval and of the whole
+     *        simulation, and the end of the current interval, see
+     *        CollectorState.
+     * @param start the iterator to write to.
+     *
+     * The accumulators of the current interval of a collector in a shared
+     * interval group are saved by the group.
+     */
+    void SerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by SerializeState().
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     *
+     * The current interval is rescheduled to end at the saved time. If that
+     * time has already passed, the current schedule is kept.
+     */
+    uint32_t DeserializeState(Buffer::Iterator start);
+
   protected:
     // Inherited from Object base class
     virtual void DoDispose();
 
   private:
+    // Emits the interval output of registered collectors.
+    friend class IntervalRateCollectorGroup;
+
     /**
      * @internal
      * Start the first interval.
@@ -289,6 +398,51 @@ class IntervalRateCollector : public DataCollectionObject
      */
     void NewInterval();
 
+    /**
+     * @internal
+     * Emit outputs related to the current interval through trace sources and
+     * reset the accumulated values.
+     * @param endTime the time when the interval ends.
+     */
+    void EndInterval(Time endTime);
+
+    /**
+     * @internal
+     * Emit outputs related to an interval through trace sources.
+     * @param endTime the time when the interval ends.
+     * @param sumDouble sum of `DOUBLE` inputs received during the interval.
+     * @param sumUinteger sum of `UINTEGER` and `BOOLEAN` inputs received
+     *                    during the interval.
+     * @param numOfSamples number of inputs received during the interval.
+     */
+    void EmitInterval(Time endTime, double sumDouble, uint64_t sumUinteger, uint32_t numOfSamples);
+
+    /**
+     * @internal
+     * In lazy rollover mode, end all the intervals which have passed.
+     * @param now the current simulation time.
+     * @param isBoundaryIncluded whether an interval ending exactly at `now`
+     *                           is regarded as passed.
+     */
+    void RollOver(Time now, bool isBoundaryIncluded);
+
+    /**
+     * @internal
+     * End the passed intervals of every instance in lazy rollover mode.
+     * Scheduled once to run when the simulator is destroyed.
+     */
+    static void FlushLazyCollectors();
+
+    /**
+     * @internal
+     * @return the instances in lazy rollover mode which have not been flushed,
+     *         in registration order. A disposed instance leaves a null slot.
+     */
+    static std::vector<IntervalRateCollector*>& GetLazyCollectors();
+
+    /// Value of #m_lazyIndex when the instance is not waiting for the shared flush.
+    static const std::size_t NOT_LAZY_REGISTERED = static_cast<std::size_t>(-1);
+
     /// Sum of all `DOUBLE` inputs received during the current interval.
     double m_intervalSumDouble;
 
@@ -310,9 +464,23 @@ class IntervalRateCollector : public DataCollectionObject
     /// The end time of the current interval and the start time of the next interval.
     EventId m_nextReset;
 
+    /// The end time of the current interval, used in lazy rollover mode.
+    Time m_intervalEnd;
+
+    /// The group which drives the intervals, if any.
+    Ptr<IntervalRateCollectorGroup> m_intervalGroup;
+
+    /// The index of this instance's accumulators in #m_intervalGroup.
+    uint32_t m_intervalGroupIndex;
+
+    /// The index of this instance in GetLazyCollectors(), if registered.
+    std::size_t m_lazyIndex;
+
+    bool m_isLazyRollover;           ///< `LazyRollover` attribute.
     Time m_intervalLength;           ///< `IntervalLength` attribute.
     InputDataType_t m_inputDataType; ///< `InputDataType` attribute.
     OutputType_t m_outputType;       ///< `OutputType` attribute.
+    double m_scale;                  ///< `Scale` attribute.
     Time::Unit m_timeUnit;           ///< `TimeUnit` attribute.
 
     TracedCallback<double> m_outputOverall;          ///< `OutputOverall` trace source.
@@ -320,6 +488,8 @@ class IntervalRateCollector : public DataCollectionObject
     TracedCallback<double> m_outputWithoutTime;      ///< `OutputWithoutTime` trace source.
     TracedCallback<std::string> m_outputString;      ///< `OutputString` trace source.
 
+    StatsProfiler::Handle m_profile; ///< Profiling counters, see StatsProfiler.
+
 }; // end of class IntervalRateCollector
 
 } // end of namespace ns3
@@ -26,6 +26,8 @@
 
 #include "magister-gnuplot-aggregator.h"
 
+#include "memory-usage.h"
+
 #include "ns3/abort.h"
 #include "ns3/log.h"
 #include "ns3/string.h"
@@ -182,6 +184,7 @@ MagisterGnuplotAggregator::Write2d(std::string context, double x, double y)
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MagisterGnuplotAggregator", this));
         std::ofstream ofs;
         GetDataStream(m_outputPath + "/" + m_outputFileNameWithoutExtension + ".dat." + context,
                       &ofs);
@@ -205,6 +208,7 @@ MagisterGnuplotAggregator::Write2dWithXErrorDelta(std::string context,
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MagisterGnuplotAggregator", this));
         std::ofstream ofs;
         GetDataStream(m_outputPath + "/" + m_outputFileNameWithoutExtension + ".dat." + context,
                       &ofs);
@@ -228,6 +232,7 @@ MagisterGnuplotAggregator::Write2dWithYErrorDelta(std::string context,
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MagisterGnuplotAggregator", this));
         std::ofstream ofs;
         GetDataStream(m_outputPath + "/" + m_outputFileNameWithoutExtension + ".dat." + context,
                       &ofs);
@@ -252,6 +257,7 @@ MagisterGnuplotAggregator::Write2dWithXYErrorDelta(std::string context,
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MagisterGnuplotAggregator", this));
         std::ofstream ofs;
         GetDataStream(m_outputPath + "/" + m_outputFileNameWithoutExtension + ".dat." + context,
                       &ofs);
@@ -433,6 +439,35 @@ MagisterGnuplotAggregator::GetDataStream(std::string dataFileName, std::ofstream
     {
         NS_FATAL_ERROR("Error creating file " << dataFileName << " for output");
     }
+
+    if (StatsProfiler::IsEnabled())
+    {
+        StatsProfiler::AddOutputFile(dataFileName);
+    }
+}
+
+uint64_t
+MagisterGnuplotAggregator::GetMemoryUsage() const
+{
+    // The data points are written to the data files rather than kept in the
+    // datasets, so that each dataset only holds its own settings.
+    uint64_t usage =
+        sizeof(MagisterGnuplotAggregator) +
+        MemoryUsage::GetTreeUsage(m_2dDatasetMap.size(),
+                                  sizeof(std::map<std::string, Gnuplot2dDataset>::value_type)) +
+        MemoryUsage::GetVectorUsage(m_contexts);
+
+    for (const auto& dataset : m_2dDatasetMap)
+    {
+        usage += MemoryUsage::GetStringUsage(dataset.first);
+    }
+
+    for (const std::string& context : m_contexts)
+    {
+        usage += MemoryUsage::GetStringUsage(context);
+    }
+
+    return usage;
 }
 
 } // namespace ns3
@@ -29,6 +29,8 @@
 #ifndef MAGISTER_GNUPLOT_AGGREGATOR_H
 #define MAGISTER_GNUPLOT_AGGREGATOR_H
 
+#include "stats-profiler.h"
+
 #include "ns3/data-collection-object.h"
 #include "ns3/gnuplot.h"
 
@@ -260,6 +262,12 @@ class MagisterGnuplotAggregator : public DataCollectionObject
      */
     void SetKeyLocation(enum KeyLocation keyLocation);
 
+    /**
+     * @return the memory used by the instance, including the datasets, see
+     *         MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
     /**
      * TODO
      * @param dataFileName The name of file to open.
@@ -310,6 +318,9 @@ class MagisterGnuplotAggregator : public DataCollectionObject
     /// List of contexts used.
     std::vector<std::string> m_contexts;
 
+    /// Profiling counters, see StatsProfiler.
+    StatsProfiler::Handle m_profile;
+
 }; // class MagisterGnuplotAggregator
 
 } // namespace ns3
@@ -49,6 +49,21 @@ typedef void (*CollectorTimedOutputCallback)(double time, double value);
  */
 typedef void (*Collector2dOutputCallback)(double time, double value);
 
+/**
+ * @brief Common signature used by callback to collector's trace source.
+ * @param mean the estimated mean of the input samples.
+ * @param halfWidth the half-width of the confidence interval around the mean.
+ */
+typedef void (*CollectorConfidenceIntervalCallback)(double mean, double halfWidth);
+
+/**
+ * @brief Common signature used by callback to trace sources of collectors
+ *        which serve several identifiers at once.
+ * @param context the name of the identifier which produced the value.
+ * @param value the value generated by the collector.
+ */
+typedef void (*CollectorContextOutputCallback)(std::string context, double value);
+
 /**
  * @brief Common signature used by callback to collector's trace source.
  * @param info various setup and statistical information used by the collector
@@ -0,0 +1,129 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#include "memory-usage.h"
+
+#include "collector-bank.h"
+#include "distribution-collector.h"
+#include "interval-rate-collector.h"
+#include "magister-gnuplot-aggregator.h"
+#include "multi-file-aggregator.h"
+#include "scalar-collector-t.h"
+#include "scalar-collector.h"
+#include "unit-conversion-collector.h"
+
+#include "ns3/data-collection-object.h"
+
+namespace ns3
+{
+
+/**
+ * @param object a collector or aggregator of this module.
+ * @return the memory used by the object if it is a ScalarCollectorT with the
+ *         input data type `T`, otherwise zero.
+ */
+template <typename T>
+static uint64_t
+GetScalarCollectorTUsage(Ptr<DataCollectionObject> object)
+{
+    if (Ptr<ScalarCollectorT<T, ScalarOutputSum>> c =
+            DynamicCast<ScalarCollectorT<T, ScalarOutputSum>>(object))
+    {
+        return c->GetMemoryUsage();
+    }
+    if (Ptr<ScalarCollectorT<T, ScalarOutputNumberOfSample>> c =
+            DynamicCast<ScalarCollectorT<T, ScalarOutputNumberOfSample>>(object))
+    {
+        return c->GetMemoryUsage();
+    }
+    if (Ptr<ScalarCollectorT<T, ScalarOutputAveragePerSample>> c =
+            DynamicCast<ScalarCollectorT<T, ScalarOutputAveragePerSample>>(object))
+    {
+        return c->GetMemoryUsage();
+    }
+    if (Ptr<ScalarCollectorT<T, ScalarOutputAveragePerSecond>> c =
+            DynamicCast<ScalarCollectorT<T, ScalarOutputAveragePerSecond>>(object))
+    {
+        return c->GetMemoryUsage();
+    }
+    return 0;
+}
+
+uint64_t // static
+MemoryUsage::GetObjectUsage(Ptr<DataCollectionObject> object)
+{
+    if (object == nullptr)
+    {
+        return 0;
+    }
+
+    // The most common types come first.
+    if (Ptr<UnitConversionCollector> c = DynamicCast<UnitConversionCollector>(object))
+    {
+        return c->GetMemoryUsage();
+    }
+    if (Ptr<ScalarCollector> c = DynamicCast<ScalarCollector>(object))
+    {
+        return c->GetMemoryUsage();
+    }
+    if (Ptr<IntervalRateCollector> c = DynamicCast<IntervalRateCollector>(object))
+    {
+        return c->GetMemoryUsage();
+    }
+    if (Ptr<DistributionCollector> c = DynamicCast<DistributionCollector>(object))
+    {
+        return c->GetMemoryUsage();
+    }
+    if (Ptr<CollectorBank> c = DynamicCast<CollectorBank>(object))
+    {
+        return c->GetMemoryUsage();
+    }
+    if (Ptr<MultiFileAggregator> a = DynamicCast<MultiFileAggregator>(object))
+    {
+        return a->GetMemoryUsage();
+    }
+    if (Ptr<MagisterGnuplotAggregator> a = DynamicCast<MagisterGnuplotAggregator>(object))
+    {
+        return a->GetMemoryUsage();
+    }
+
+    uint64_t usage = GetScalarCollectorTUsage<double>(object);
+    if (usage == 0)
+    {
+        usage = GetScalarCollectorTUsage<uint32_t>(object);
+    }
+    if (usage == 0)
+    {
+        usage = GetScalarCollectorTUsage<uint64_t>(object);
+    }
+    if (usage == 0)
+    {
+        usage = GetScalarCollectorTUsage<bool>(object);
+    }
+    if (usage > 0)
+    {
+        return usage;
+    }
+
+    // Other types, e.g., probes, do not allocate any memory of their own.
+    return sizeof(DataCollectionObject);
+}
+
+} // end of namespace ns3
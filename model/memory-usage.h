@@ -0,0 +1,110 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+#include "ns3/ptr.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+class DataCollectionObject;
+
+/**
+ * @ingroup aggregator
+ * @brief Estimates of the memory used by the statistics framework.
+ *
+ * Collectors, aggregators, the containers used by the statistics helpers, and
+ * the helpers themselves provide a `GetMemoryUsage()` method built on top of
+ * these estimates. Objects, which are always allocated on the heap, report
+ * their own size plus the memory they allocate, while value types (e.g.,
+ * CollectorMap) report only the memory they allocate.
+ *
+ * The estimates account for the capacity of vectors and strings, and for the
+ * nodes of lists and trees, but not for the bookkeeping of the memory
+ * allocator. They are meant to find which statistic grows with the scenario,
+ * not to match the resident memory of the process exactly.
+ */
+class MemoryUsage
+{
+  public:
+    /**
+     * @param s a string.
+     * @return the memory allocated by the string, zero if the string fits in
+     *         its own storage.
+     *
+     * The capacity of an empty string is the capacity of the inline storage
+     * of the standard library in use (e.g., 15 characters in libstdc++ and 22
+     * in libc++), which is smaller than `sizeof (std::string)`.
+     */
+    static inline uint64_t GetStringUsage(const std::string& s)
+    {
+        return s.capacity() <= std::string().capacity() ? 0 : s.capacity() + 1;
+    }
+
+    /**
+     * @param v a vector.
+     * @return the memory allocated by the vector, excluding any memory
+     *         allocated by its elements.
+     */
+    template <typename T>
+    static inline uint64_t GetVectorUsage(const std::vector<T>& v)
+    {
+        return v.capacity() * sizeof(T);
+    }
+
+    /**
+     * @param numOfNodes the number of elements of a `std::list`.
+     * @param valueSize the size of each element.
+     * @return the memory allocated for the nodes of the list.
+     */
+    static inline uint64_t GetListUsage(uint64_t numOfNodes, uint64_t valueSize)
+    {
+        return numOfNodes * (valueSize + 2 * sizeof(void*));
+    }
+
+    /**
+     * @param numOfNodes the number of elements of a `std::map` or `std::set`.
+     * @param valueSize the size of each element, i.e., key and value.
+     * @return the memory allocated for the nodes of the tree.
+     */
+    static inline uint64_t GetTreeUsage(uint64_t numOfNodes, uint64_t valueSize)
+    {
+        return numOfNodes * (valueSize + 4 * sizeof(void*));
+    }
+
+    /**
+     * @param object a collector or aggregator of this module.
+     * @return the memory used by the object, as reported by its
+     *         `GetMemoryUsage()` method, or the size of a DataCollectionObject
+     *         for other types, e.g., probes.
+     */
+    static uint64_t GetObjectUsage(Ptr<DataCollectionObject> object);
+
+}; // end of class MemoryUsage
+
+} // end of namespace ns3
+
+#endif /* MEMORY_USAGE_H */
@@ -29,19 +29,33 @@
 
 #include "multi-file-aggregator.h"
 
+#include "collector-state.h"
+#include "memory-usage.h"
+
 #include "ns3/boolean.h"
 #include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <ios>
 #include <iostream>
 #include <map>
 #include <sstream>
 #include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// posix_fallocate() is not available on macOS, where the files are always
+// written through file streams.
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
 
 namespace ns3
 {
@@ -94,7 +108,22 @@ MultiFileAggregator::GetTypeId()
                           "line of each file.",
                           StringValue(""),
                           MakeStringAccessor(&MultiFileAggregator::AddGeneralHeading),
-                          MakeStringChecker());
+                          MakeStringChecker())
+            .AddAttribute("MemoryMapped",
+                          "If true, map the files into memory and copy the output "
+                          "lines into the mappings, instead of writing them through "
+                          "file streams. Ignored, with a warning, on platforms "
+                          "without memory-mapped files.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&MultiFileAggregator::SetMemoryMapped,
+                                              &MultiFileAggregator::IsMemoryMapped),
+                          MakeBooleanChecker())
+            .AddAttribute("MemoryMappedChunkSize",
+                          "The number of bytes by which a memory-mapped file is "
+                          "extended when it is full.",
+                          UintegerValue(4 * 1024 * 1024),
+                          MakeUintegerAccessor(&MultiFileAggregator::m_chunkSize),
+                          MakeUintegerChecker<uint64_t>(4096));
     return tid;
 }
 
@@ -112,7 +141,9 @@ MultiFileAggregator::MultiFileAggregator()
       m_7dFormat("%e %e %e %e %e %e %e"),
       m_8dFormat("%e %e %e %e %e %e %e %e"),
       m_9dFormat("%e %e %e %e %e %e %e %e %e"),
-      m_10dFormat("%e %e %e %e %e %e %e %e %e %e")
+      m_10dFormat("%e %e %e %e %e %e %e %e %e %e"),
+      m_isMemoryMapped(false),
+      m_chunkSize(4 * 1024 * 1024)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -121,6 +152,10 @@ MultiFileAggregator::~MultiFileAggregator()
 {
     NS_LOG_FUNCTION(this);
 
+    // The headings below are written through file streams. The mappings are
+    // normally released by DoDispose() already.
+    CloseMappedFiles();
+
     for (std::string context : m_contexts)
     {
         // Remove any space and slash characters from the context.
@@ -193,27 +228,198 @@ MultiFileAggregator::~MultiFileAggregator()
 }
 
 void
+MultiFileAggregator::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    // Truncate the memory-mapped files as soon as the simulation is over,
+    // rather than when the last reference to the aggregator is released. The
+    // headings are still written by the destructor.
+    CloseMappedFiles();
+
+    DataCollectionObject::DoDispose();
+}
+
+std::ostream&
 MultiFileAggregator::OpenStream(std::string context, std::ofstream* ofs)
 {
     NS_LOG_FUNCTION(this << context << ofs);
 
     SetContext(context);
 
-    // Remove any space and slash characters from the context.
-    for (size_t pos = context.find(" /"); pos != std::string::npos;
-         pos = context.find(" /", pos + 1, 1))
+    // Creating a file for output.
+    std::string fileName = GetOutputFileName(context);
+
+    if (m_isMemoryMapped)
     {
-        context[pos] = '_';
+        // The line is copied into the mapping by CloseStream().
+        m_recordFileName = fileName;
+        m_record.str("");
+        return m_record;
     }
 
-    // Creating a file for output.
-    std::string fileName = GetFullName(context);
     NS_LOG_INFO("Creating or appending a file " << fileName);
     ofs->open(fileName, std::ios::out | std::ios::app);
     if (!(*ofs) || !(ofs->is_open()))
     {
         NS_FATAL_ERROR("Error creating file " << fileName << " for output");
     }
+
+    if (StatsProfiler::IsEnabled())
+    {
+        StatsProfiler::AddOutputFile(fileName);
+    }
+
+    return *ofs;
+}
+
+void
+MultiFileAggregator::CloseStream(std::ofstream* ofs)
+{
+    if (m_isMemoryMapped)
+    {
+        WriteMapped(m_recordFileName, m_record.str());
+    }
+    else
+    {
+        ofs->close();
+    }
+}
+
+void
+MultiFileAggregator::WriteMapped(const std::string& fileName, const std::string& data)
+{
+    std::map<std::string, MappedFile_t>::iterator it = m_mappedFiles.find(fileName);
+
+    if (it == m_mappedFiles.end())
+    {
+        // The file already contains the general heading written by SetContext().
+        struct stat st;
+        if (stat(fileName.c_str(), &st) != 0)
+        {
+            NS_FATAL_ERROR("Error reading the size of file " << fileName);
+        }
+
+        MappedFile_t file = {nullptr, static_cast<uint64_t>(st.st_size), 0};
+        it = m_mappedFiles.insert(std::make_pair(fileName, file)).first;
+    }
+
+    MappedFile_t& file = it->second;
+
+    if (file.length + data.size() > file.capacity)
+    {
+        // Extend the file by as many chunks as necessary, and map it again.
+        const uint64_t capacity = ((file.length + data.size()) / m_chunkSize + 1) * m_chunkSize;
+        NS_LOG_INFO(this << " extending file " << fileName << " to " << capacity << " bytes");
+
+#if defined(__linux__) || defined(__FreeBSD__)
+        const int fd = open(fileName.c_str(), O_RDWR);
+        if (fd < 0)
+        {
+            NS_FATAL_ERROR("Error opening file " << fileName);
+        }
+
+        if (posix_fallocate(fd, 0, capacity) != 0)
+        {
+            close(fd);
+            NS_FATAL_ERROR("Error extending file " << fileName << " to " << capacity << " bytes");
+        }
+
+        if (file.data != nullptr)
+        {
+            munmap(file.data, file.capacity);
+        }
+
+        void* mapping = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if (mapping == MAP_FAILED)
+        {
+            NS_FATAL_ERROR("Error mapping file " << fileName << " into memory");
+        }
+
+        file.data = static_cast<uint8_t*>(mapping);
+        file.capacity = capacity;
+#else
+        NS_FATAL_ERROR("Memory-mapped files are not supported on this platform");
+#endif
+    }
+
+    std::memcpy(file.data + file.length, data.data(), data.size());
+    file.length += data.size();
+}
+
+void
+MultiFileAggregator::CloseMappedFiles()
+{
+    NS_LOG_FUNCTION(this);
+
+    for (const auto& mappedFile : m_mappedFiles)
+    {
+#if defined(__linux__) || defined(__FreeBSD__)
+        if (mappedFile.second.data != nullptr)
+        {
+            munmap(mappedFile.second.data, mappedFile.second.capacity);
+        }
+#endif
+
+        // Drop the unused part of the last chunk.
+        if (truncate(mappedFile.first.c_str(), mappedFile.second.length) != 0)
+        {
+            NS_FATAL_ERROR("Error truncating file " << mappedFile.first);
+        }
+    }
+
+    m_mappedFiles.clear();
+}
+
+void
+MultiFileAggregator::SetMemoryMapped(bool isMemoryMapped)
+{
+    NS_LOG_FUNCTION(this << isMemoryMapped);
+
+#if defined(__linux__) || defined(__FreeBSD__)
+    m_isMemoryMapped = isMemoryMapped;
+#else
+    if (isMemoryMapped)
+    {
+        NS_LOG_WARN(this << " memory-mapped files are not supported on this platform,"
+                         << " the files are written through file streams instead");
+    }
+
+    m_isMemoryMapped = false;
+#endif
+
+    if (!m_isMemoryMapped)
+    {
+        // The lines written from now on are appended through file streams.
+        CloseMappedFiles();
+    }
+}
+
+bool
+MultiFileAggregator::IsMemoryMapped() const
+{
+    return m_isMemoryMapped;
+}
+
+uint64_t
+MultiFileAggregator::GetFileLength(const std::string& fileName) const
+{
+    std::map<std::string, MappedFile_t>::const_iterator it = m_mappedFiles.find(fileName);
+
+    if (it != m_mappedFiles.end())
+    {
+        return it->second.length;
+    }
+
+    struct stat st;
+    if (stat(fileName.c_str(), &st) != 0)
+    {
+        NS_FATAL_ERROR("Error reading the size of file " << fileName);
+    }
+
+    return st.st_size;
 }
 
 void
@@ -351,20 +557,21 @@ MultiFileAggregator::WriteString(std::string context, std::string v1)
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         if (m_isContextPrinted)
         {
             // Write the context and the value with the proper separator.
-            ofs << context << m_separator << v1 << std::endl;
+            out << context << m_separator << v1 << std::endl;
         }
         else
         {
             // Write the value.
-            ofs << v1 << std::endl;
+            out << v1 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -375,8 +582,9 @@ MultiFileAggregator::Write1d(std::string context, double v1)
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         // Write the 1D data point to the file.
         if (m_fileType == FORMATTED)
@@ -395,19 +603,19 @@ MultiFileAggregator::Write1d(std::string context, double v1)
             }
 
             // Write the formatted value.
-            ofs << buffer << std::endl;
+            out << buffer << std::endl;
         }
         else if (m_isContextPrinted)
         {
             // Write the context and the value with the proper separator.
-            ofs << context << m_separator << v1 << std::endl;
+            out << context << m_separator << v1 << std::endl;
         }
         else
         {
             // Write the value.
-            ofs << v1 << std::endl;
+            out << v1 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -418,8 +626,9 @@ MultiFileAggregator::Write2d(std::string context, double v1, double v2)
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         // Write the 2D data point to the file.
         if (m_fileType == FORMATTED)
@@ -438,19 +647,19 @@ MultiFileAggregator::Write2d(std::string context, double v1, double v2)
             }
 
             // Write the formatted values.
-            ofs << buffer << std::endl;
+            out << buffer << std::endl;
         }
         else if (m_isContextPrinted)
         {
             // Write the context and the values with the proper separator.
-            ofs << context << m_separator << v1 << m_separator << v2 << std::endl;
+            out << context << m_separator << v1 << m_separator << v2 << std::endl;
         }
         else
         {
             // Write the values with the proper separator.
-            ofs << v1 << m_separator << v2 << std::endl;
+            out << v1 << m_separator << v2 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -461,8 +670,9 @@ MultiFileAggregator::Write3d(std::string context, double v1, double v2, double v
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         // Write the 3D data point to the file.
         if (m_fileType == FORMATTED)
@@ -481,20 +691,20 @@ MultiFileAggregator::Write3d(std::string context, double v1, double v2, double v
             }
 
             // Write the formatted values.
-            ofs << buffer << std::endl;
+            out << buffer << std::endl;
         }
         else if (m_isContextPrinted)
         {
             // Write the context and the values with the proper separator.
-            ofs << context << m_separator << v1 << m_separator << v2 << m_separator << v3
+            out << context << m_separator << v1 << m_separator << v2 << m_separator << v3
                 << std::endl;
         }
         else
         {
             // Write the values with the proper separator.
-            ofs << v1 << m_separator << v2 << m_separator << v3 << std::endl;
+            out << v1 << m_separator << v2 << m_separator << v3 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -505,8 +715,9 @@ MultiFileAggregator::Write4d(std::string context, double v1, double v2, double v
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         // Write the 4D data point to the file.
         if (m_fileType == FORMATTED)
@@ -525,20 +736,20 @@ MultiFileAggregator::Write4d(std::string context, double v1, double v2, double v
             }
 
             // Write the formatted values.
-            ofs << buffer << std::endl;
+            out << buffer << std::endl;
         }
         else if (m_isContextPrinted)
         {
             // Write the context and the values with the proper separator.
-            ofs << context << m_separator << v1 << m_separator << v2 << m_separator << v3
+            out << context << m_separator << v1 << m_separator << v2 << m_separator << v3
                 << m_separator << v4 << std::endl;
         }
         else
         {
             // Write the values with the proper separator.
-            ofs << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << std::endl;
+            out << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -554,8 +765,9 @@ MultiFileAggregator::Write5d(std::string context,
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         // Write the 5D data point to the file.
         if (m_fileType == FORMATTED)
@@ -575,21 +787,21 @@ MultiFileAggregator::Write5d(std::string context,
             }
 
             // Write the formatted values.
-            ofs << buffer << std::endl;
+            out << buffer << std::endl;
         }
         else if (m_isContextPrinted)
         {
             // Write the context and the values with the proper separator.
-            ofs << context << m_separator << v1 << m_separator << v2 << m_separator << v3
+            out << context << m_separator << v1 << m_separator << v2 << m_separator << v3
                 << m_separator << v4 << m_separator << v5 << std::endl;
         }
         else
         {
             // Write the values with the proper separator.
-            ofs << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
+            out << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
                 << v5 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -606,8 +818,9 @@ MultiFileAggregator::Write6d(std::string context,
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         // Write the 6D data point to the file.
         if (m_fileType == FORMATTED)
@@ -627,21 +840,21 @@ MultiFileAggregator::Write6d(std::string context,
             }
 
             // Write the formatted values.
-            ofs << buffer << std::endl;
+            out << buffer << std::endl;
         }
         else if (m_isContextPrinted)
         {
             // Write the context and the values with the proper separator.
-            ofs << context << m_separator << v1 << m_separator << v2 << m_separator << v3
+            out << context << m_separator << v1 << m_separator << v2 << m_separator << v3
                 << m_separator << v4 << m_separator << v5 << m_separator << v6 << std::endl;
         }
         else
         {
             // Write the values with the proper separator.
-            ofs << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
+            out << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
                 << v5 << m_separator << v6 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -659,8 +872,9 @@ MultiFileAggregator::Write7d(std::string context,
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         // Write the 7D data point to the file.
         if (m_fileType == FORMATTED)
@@ -680,22 +894,22 @@ MultiFileAggregator::Write7d(std::string context,
             }
 
             // Write the formatted values.
-            ofs << buffer << std::endl;
+            out << buffer << std::endl;
         }
         else if (m_isContextPrinted)
         {
             // Write the context and the values with the proper separator.
-            ofs << context << m_separator << v1 << m_separator << v2 << m_separator << v3
+            out << context << m_separator << v1 << m_separator << v2 << m_separator << v3
                 << m_separator << v4 << m_separator << v5 << m_separator << v6 << m_separator << v7
                 << std::endl;
         }
         else
         {
             // Write the values with the proper separator.
-            ofs << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
+            out << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
                 << v5 << m_separator << v6 << m_separator << v7 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -714,8 +928,9 @@ MultiFileAggregator::Write8d(std::string context,
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         // Write the 8D data point to the file.
         if (m_fileType == FORMATTED)
@@ -735,22 +950,22 @@ MultiFileAggregator::Write8d(std::string context,
             }
 
             // Write the formatted values.
-            ofs << buffer << std::endl;
+            out << buffer << std::endl;
         }
         else if (m_isContextPrinted)
         {
             // Write the context and the values with the proper separator.
-            ofs << context << m_separator << v1 << m_separator << v2 << m_separator << v3
+            out << context << m_separator << v1 << m_separator << v2 << m_separator << v3
                 << m_separator << v4 << m_separator << v5 << m_separator << v6 << m_separator << v7
                 << m_separator << v8 << std::endl;
         }
         else
         {
             // Write the values with the proper separator.
-            ofs << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
+            out << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
                 << v5 << m_separator << v6 << m_separator << v7 << m_separator << v8 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -770,8 +985,9 @@ MultiFileAggregator::Write9d(std::string context,
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         // Write the 9D data point to the file.
         if (m_fileType == FORMATTED)
@@ -801,23 +1017,23 @@ MultiFileAggregator::Write9d(std::string context,
             }
 
             // Write the formatted values.
-            ofs << buffer << std::endl;
+            out << buffer << std::endl;
         }
         else if (m_isContextPrinted)
         {
             // Write the context and the values with the proper separator.
-            ofs << context << m_separator << v1 << m_separator << v2 << m_separator << v3
+            out << context << m_separator << v1 << m_separator << v2 << m_separator << v3
                 << m_separator << v4 << m_separator << v5 << m_separator << v6 << m_separator << v7
                 << m_separator << v8 << m_separator << v9 << std::endl;
         }
         else
         {
             // Write the values with the proper separator.
-            ofs << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
+            out << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
                 << v5 << m_separator << v6 << m_separator << v7 << m_separator << v8 << m_separator
                 << v9 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -838,8 +1054,9 @@ MultiFileAggregator::Write10d(std::string context,
 
     if (m_enabled)
     {
+        StatsProfiler::Scope profileScope(m_profile.Get("MultiFileAggregator", this));
         std::ofstream ofs;
-        OpenStream(context, &ofs);
+        std::ostream& out = OpenStream(context, &ofs);
 
         // Write the 10D data point to the file.
         if (m_fileType == FORMATTED)
@@ -870,23 +1087,23 @@ MultiFileAggregator::Write10d(std::string context,
             }
 
             // Write the formatted values.
-            ofs << buffer << std::endl;
+            out << buffer << std::endl;
         }
         else if (m_isContextPrinted)
         {
             // Write the context and the values with the proper separator.
-            ofs << context << m_separator << v1 << m_separator << v2 << m_separator << v3
+            out << context << m_separator << v1 << m_separator << v2 << m_separator << v3
                 << m_separator << v4 << m_separator << v5 << m_separator << v6 << m_separator << v7
                 << m_separator << v8 << m_separator << v9 << m_separator << v10 << std::endl;
         }
         else
         {
             // Write the values with the proper separator.
-            ofs << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
+            out << v1 << m_separator << v2 << m_separator << v3 << m_separator << v4 << m_separator
                 << v5 << m_separator << v6 << m_separator << v7 << m_separator << v8 << m_separator
                 << v9 << m_separator << v10 << std::endl;
         }
-        ofs.close();
+        CloseStream(&ofs);
     }
 }
 
@@ -913,7 +1130,7 @@ MultiFileAggregator::SetContext(std::string context)
 }
 
 std::string
-MultiFileAggregator::GetFullName(std::string context, std::string additionalData)
+MultiFileAggregator::GetFullName(std::string context, std::string additionalData) const
 {
     NS_LOG_FUNCTION(this << context << additionalData);
 
@@ -932,4 +1149,117 @@ MultiFileAggregator::GetFullName(std::string context, std::string additionalData
     return fileName.str();
 }
 
+std::string
+MultiFileAggregator::GetOutputFileName(std::string context) const
+{
+    // Remove any space and slash characters from the context.
+    for (size_t pos = context.find(" /"); pos != std::string::npos;
+         pos = context.find(" /", pos + 1, 1))
+    {
+        context[pos] = '_';
+    }
+
+    return GetFullName(context);
+}
+
+uint64_t
+MultiFileAggregator::GetMemoryUsage() const
+{
+    uint64_t usage = sizeof(MultiFileAggregator);
+    usage += MemoryUsage::GetStringUsage(m_outputFileName);
+    usage += MemoryUsage::GetStringUsage(m_generalHeading);
+    usage += MemoryUsage::GetTreeUsage(m_contexts.size(), sizeof(std::string));
+    usage += MemoryUsage::GetTreeUsage(m_contextWarningEnabled.size(), sizeof(std::string));
+    usage += MemoryUsage::GetTreeUsage(m_contextHeading.size(), 2 * sizeof(std::string));
+
+    for (const std::string& context : m_contexts)
+    {
+        usage += MemoryUsage::GetStringUsage(context);
+    }
+
+    for (const std::string& context : m_contextWarningEnabled)
+    {
+        usage += MemoryUsage::GetStringUsage(context);
+    }
+
+    for (const auto& heading : m_contextHeading)
+    {
+        usage += MemoryUsage::GetStringUsage(heading.first) +
+                 MemoryUsage::GetStringUsage(heading.second);
+    }
+
+    // The mappings themselves are backed by the files.
+    usage += MemoryUsage::GetTreeUsage(m_mappedFiles.size(),
+                                       sizeof(std::map<std::string, MappedFile_t>::value_type));
+
+    for (const auto& mappedFile : m_mappedFiles)
+    {
+        usage += MemoryUsage::GetStringUsage(mappedFile.first);
+    }
+
+    return usage;
+}
+
+uint32_t
+MultiFileAggregator::GetSerializedStateSize() const
+{
+    uint32_t size = 4;
+
+    for (const std::string& context : m_contexts)
+    {
+        size += CollectorState::GetStringSize(context) + 8;
+    }
+
+    return size;
+}
+
+void
+MultiFileAggregator::SerializeState(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    i.WriteU32(m_contexts.size());
+
+    for (const std::string& context : m_contexts)
+    {
+        CollectorState::WriteString(i, context);
+        i.WriteU64(GetFileLength(GetOutputFileName(context)));
+    }
+}
+
+uint32_t
+MultiFileAggregator::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this << GetName());
+    Buffer::Iterator i = start;
+
+    for (uint32_t n = i.ReadU32(); n > 0; n--)
+    {
+        const std::string context = CollectorState::ReadString(i);
+        const uint64_t length = i.ReadU64();
+        const std::string fileName = GetOutputFileName(context);
+
+        struct stat st;
+        if (stat(fileName.c_str(), &st) != 0 || GetFileLength(fileName) < length)
+        {
+            NS_FATAL_ERROR("File " << fileName << " is missing or shorter than the saved length "
+                                   << length);
+        }
+
+        // Drop what was written after the state was saved.
+        std::map<std::string, MappedFile_t>::iterator it = m_mappedFiles.find(fileName);
+        if (it != m_mappedFiles.end())
+        {
+            it->second.length = length;
+        }
+        else if (truncate(fileName.c_str(), length) != 0)
+        {
+            NS_FATAL_ERROR("Error truncating file " << fileName);
+        }
+
+        m_contexts.insert(context);
+    }
+
+    return i.GetDistanceFrom(start);
+}
+
 } // namespace ns3
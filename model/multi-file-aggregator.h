@@ -31,6 +31,9 @@
 #ifndef MULTI_FILE_AGGREGATOR_H
 #define MULTI_FILE_AGGREGATOR_H
 
+#include "stats-profiler.h"
+
+#include "ns3/buffer.h"
 #include "ns3/data-collection-object.h"
 
 #include <algorithm>
@@ -79,6 +82,19 @@ namespace ns3
  * attribute, and then followed by the context string. Finally, a ".txt"
  * extension is added at the end.
  *
+ * ### Memory-mapped output ###
+ * By default, every line is appended to its file through a file stream, which
+ * costs a few system calls per line. When the `MemoryMapped` attribute is
+ * enabled, each file is instead mapped into memory and extended in chunks of
+ * `MemoryMappedChunkSize` bytes, which are allocated on the disk in advance.
+ * The lines are then copied into the mapping without any system call, except
+ * when a chunk is full. When the aggregator is disposed, e.g., at the end of
+ * simulation, the mappings are released and each file is truncated to the
+ * length actually written. Until then, the size of the files seen by other
+ * processes includes the unused part of the last chunk, which is filled with
+ * zeros. Memory-mapped files require `posix_fallocate`, so on other platforms
+ * (e.g., macOS) the attribute is ignored with a warning.
+ *
  * @note All outputs are stored internally in string buffers. Upon destruction,
  *       e.g., at the end of simulation, the whole buffer content is written to
  *       the destination files.
@@ -122,6 +138,24 @@ class MultiFileAggregator : public DataCollectionObject
      */
     void SetFileType(enum FileType fileType);
 
+    /**
+     * @param isMemoryMapped whether the files are mapped into memory instead
+     *                       of being written through file streams.
+     *
+     * @brief Set the `MemoryMapped` attribute.
+     *
+     * On platforms without memory-mapped files (e.g., macOS, which lacks
+     * `posix_fallocate`), a warning is logged and the files are written
+     * through file streams. Disabling the attribute releases the current
+     * mappings.
+     */
+    void SetMemoryMapped(bool isMemoryMapped);
+
+    /**
+     * @return true if the files are mapped into memory.
+     */
+    bool IsMemoryMapped() const;
+
     /**
      * @param heading the heading string.
      *
@@ -414,6 +448,39 @@ class MultiFileAggregator : public DataCollectionObject
                   double v9,
                   double v10);
 
+    /**
+     * @return the memory used by the instance, including the contexts and
+     *         headings, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * @return the number of bytes written by SerializeState().
+     */
+    uint32_t GetSerializedStateSize() const;
+
+    /**
+     * @brief Save the known contexts and the current length of their files,
+     *        see CollectorState.
+     * @param start the iterator to write to.
+     */
+    void SerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by SerializeState().
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     *
+     * The files of the saved contexts are kept, i.e., they are not truncated
+     * by the first write to the context, and the data written to them after
+     * the state was saved is removed.
+     */
+    uint32_t DeserializeState(Buffer::Iterator start);
+
+  protected:
+    // Inherited from Object base class
+    virtual void DoDispose();
+
   private:
     /**
      * @param context determines to which file to write.
@@ -429,14 +496,57 @@ class MultiFileAggregator : public DataCollectionObject
      * @param context determines which file name stream to get.
      * @param additionalData add additional characters at the end of file name.
      */
-    std::string GetFullName(std::string context, std::string additionalData = "");
+    std::string GetFullName(std::string context, std::string additionalData = "") const;
+
+    /**
+     * Get the name of the file written by OpenStream().
+     * @param context determines which file name to get.
+     * @return the full name of the file, without any space and slash
+     *         characters from the context.
+     */
+    std::string GetOutputFileName(std::string context) const;
 
     /**
      * open a stream to a file
      * @param context determines which context to write.
      * @param ofs the stream to write to the file.
+     * @return the stream to write a line to, i.e., either the file stream, or
+     *         #m_record when the `MemoryMapped` attribute is enabled.
+     */
+    std::ostream& OpenStream(std::string context, std::ofstream* ofs);
+
+    /**
+     * Complete writing a line to the stream returned by OpenStream().
+     * @param ofs the stream to the file, which is closed.
+     */
+    void CloseStream(std::ofstream* ofs);
+
+    /// A file mapped into memory.
+    typedef struct
+    {
+        uint8_t* data;     ///< The start of the mapping.
+        uint64_t length;   ///< The number of bytes written to the file.
+        uint64_t capacity; ///< The size of the file and of the mapping.
+    } MappedFile_t;
+
+    /**
+     * Append data to a file mapped into memory, mapping the file or extending
+     * it by a chunk if necessary.
+     * @param fileName the name of the file.
+     * @param data the data to append.
      */
-    void OpenStream(std::string context, std::ofstream* ofs);
+    void WriteMapped(const std::string& fileName, const std::string& data);
+
+    /**
+     * Release every mapping and truncate the files to their written length.
+     */
+    void CloseMappedFiles();
+
+    /**
+     * @param fileName the name of a file written by the aggregator.
+     * @return the number of bytes written to the file.
+     */
+    uint64_t GetFileLength(const std::string& fileName) const;
 
     /// The file name.
     std::string m_outputFileName;
@@ -476,6 +586,20 @@ class MultiFileAggregator : public DataCollectionObject
     std::string m_9dFormat;  //!< Format string for 9D C-style sprintf() function.
     std::string m_10dFormat; //!< Format string for 10D C-style sprintf() function.
 
+    bool m_isMemoryMapped; //!< `MemoryMapped` attribute.
+    uint64_t m_chunkSize;  //!< `MemoryMappedChunkSize` attribute.
+
+    /// Files mapped into memory, indexed by file name.
+    std::map<std::string, MappedFile_t> m_mappedFiles;
+
+    /// The line being written when the `MemoryMapped` attribute is enabled.
+    std::ostringstream m_record;
+
+    /// The name of the file which #m_record is written to.
+    std::string m_recordFileName;
+
+    StatsProfiler::Handle m_profile; //!< Profiling counters, see StatsProfiler.
+
 }; // class MultiFileAggregator
 
 } // namespace ns3
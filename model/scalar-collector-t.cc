@@ -0,0 +1,74 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "scalar-collector-t.h"
+
+#include "magister-stats.h"
+
+#include <string>
+
+namespace ns3
+{
+
+template <>
+std::string
+ScalarCollectorInput<double>::GetName()
+{
+    return "double";
+}
+
+template <>
+std::string
+ScalarCollectorInput<uint32_t>::GetName()
+{
+    return "uint32_t";
+}
+
+template <>
+std::string
+ScalarCollectorInput<uint64_t>::GetName()
+{
+    return "uint64_t";
+}
+
+template <>
+std::string
+ScalarCollectorInput<bool>::GetName()
+{
+    return "bool";
+}
+
+NS_OBJECT_ENSURE_REGISTERED(DoubleSumCollector);
+NS_OBJECT_ENSURE_REGISTERED(DoubleCountCollector);
+NS_OBJECT_ENSURE_REGISTERED(DoubleAveragePerSampleCollector);
+NS_OBJECT_ENSURE_REGISTERED(DoubleAveragePerSecondCollector);
+NS_OBJECT_ENSURE_REGISTERED(Uinteger32SumCollector);
+NS_OBJECT_ENSURE_REGISTERED(Uinteger32CountCollector);
+NS_OBJECT_ENSURE_REGISTERED(Uinteger32AveragePerSampleCollector);
+NS_OBJECT_ENSURE_REGISTERED(Uinteger32AveragePerSecondCollector);
+NS_OBJECT_ENSURE_REGISTERED(Uinteger64SumCollector);
+NS_OBJECT_ENSURE_REGISTERED(Uinteger64CountCollector);
+NS_OBJECT_ENSURE_REGISTERED(Uinteger64AveragePerSampleCollector);
+NS_OBJECT_ENSURE_REGISTERED(Uinteger64AveragePerSecondCollector);
+NS_OBJECT_ENSURE_REGISTERED(BooleanSumCollector);
+NS_OBJECT_ENSURE_REGISTERED(BooleanCountCollector);
+NS_OBJECT_ENSURE_REGISTERED(BooleanAveragePerSampleCollector);
+NS_OBJECT_ENSURE_REGISTERED(BooleanAveragePerSecondCollector);
+
+} // end of namespace ns3
@@ -0,0 +1,363 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SCALAR_COLLECTOR_T_H
+#define SCALAR_COLLECTOR_T_H
+
+#include "stats-profiler.h"
+
+#include "ns3/data-collection-object.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "ns3/traced-callback.h"
+
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+namespace ns3
+{
+
+// INPUT TRAITS ///////////////////////////////////////////////////////////////
+
+/**
+ * @brief Compile-time properties of an input data type of ScalarCollectorT.
+ *
+ * Floating point inputs are accumulated in `double`, while integer and
+ * boolean inputs are accumulated in `uint64_t`, similar to the
+ * `INPUT_DATA_TYPE_DOUBLE` and `INPUT_DATA_TYPE_UINTEGER` modes of
+ * ScalarCollector.
+ */
+template <typename T>
+struct ScalarCollectorInput
+{
+    /// The type used to accumulate the input samples.
+    typedef typename std::conditional<std::is_floating_point<T>::value, double, uint64_t>::type
+        Sum_t;
+
+    /// @return the name of the input data type, used in the TypeId name.
+    static std::string GetName();
+};
+
+template <>
+std::string ScalarCollectorInput<double>::GetName();
+template <>
+std::string ScalarCollectorInput<uint32_t>::GetName();
+template <>
+std::string ScalarCollectorInput<uint64_t>::GetName();
+template <>
+std::string ScalarCollectorInput<bool>::GetName();
+
+// OUTPUT POLICIES ////////////////////////////////////////////////////////////
+
+/**
+ * @brief Output policy of ScalarCollectorT which emits the sum of all the
+ *        received inputs (equivalent to `OUTPUT_TYPE_SUM`).
+ */
+struct ScalarOutputSum
+{
+    static constexpr bool NEEDS_SUM = true;   ///< Whether inputs are summed.
+    static constexpr bool NEEDS_TIME = false; ///< Whether inputs are time stamped.
+
+    /// @return the name of the policy, used in the TypeId name.
+    static std::string GetName()
+    {
+        return "SUM";
+    }
+
+    /**
+     * @param sum the sum of all the received inputs.
+     * @param numOfSamples the number of received inputs.
+     * @param duration the time between the first and the last received input.
+     * @return the output value.
+     */
+    static double Compute(double sum, uint64_t numOfSamples, const Time& duration)
+    {
+        return sum;
+    }
+};
+
+/**
+ * @brief Output policy of ScalarCollectorT which emits the number of received
+ *        input samples (equivalent to `OUTPUT_TYPE_NUMBER_OF_SAMPLE`).
+ */
+struct ScalarOutputNumberOfSample
+{
+    static constexpr bool NEEDS_SUM = false;  ///< Whether inputs are summed.
+    static constexpr bool NEEDS_TIME = false; ///< Whether inputs are time stamped.
+
+    /// @return the name of the policy, used in the TypeId name.
+    static std::string GetName()
+    {
+        return "NUMBER_OF_SAMPLE";
+    }
+
+    /**
+     * @param sum the sum of all the received inputs.
+     * @param numOfSamples the number of received inputs.
+     * @param duration the time between the first and the last received input.
+     * @return the output value.
+     */
+    static double Compute(double sum, uint64_t numOfSamples, const Time& duration)
+    {
+        return static_cast<double>(numOfSamples);
+    }
+};
+
+/**
+ * @brief Output policy of ScalarCollectorT which emits the sum of the received
+ *        inputs divided by the number of input samples (equivalent to
+ *        `OUTPUT_TYPE_AVERAGE_PER_SAMPLE`).
+ *
+ * Equals to `-nan` if there is no input sample received.
+ */
+struct ScalarOutputAveragePerSample
+{
+    static constexpr bool NEEDS_SUM = true;   ///< Whether inputs are summed.
+    static constexpr bool NEEDS_TIME = false; ///< Whether inputs are time stamped.
+
+    /// @return the name of the policy, used in the TypeId name.
+    static std::string GetName()
+    {
+        return "AVERAGE_PER_SAMPLE";
+    }
+
+    /**
+     * @param sum the sum of all the received inputs.
+     * @param numOfSamples the number of received inputs.
+     * @param duration the time between the first and the last received input.
+     * @return the output value.
+     */
+    static double Compute(double sum, uint64_t numOfSamples, const Time& duration)
+    {
+        // This may produce -nan if number of sample is zero.
+        return sum / static_cast<double>(numOfSamples);
+    }
+};
+
+/**
+ * @brief Output policy of ScalarCollectorT which emits the sum of the received
+ *        inputs divided by the time difference between the last and the first
+ *        received input samples (equivalent to `OUTPUT_TYPE_AVERAGE_PER_SECOND`).
+ *
+ * This is the only policy which needs to read the simulation time upon
+ * receiving an input sample.
+ */
+struct ScalarOutputAveragePerSecond
+{
+    static constexpr bool NEEDS_SUM = true;  ///< Whether inputs are summed.
+    static constexpr bool NEEDS_TIME = true; ///< Whether inputs are time stamped.
+
+    /// @return the name of the policy, used in the TypeId name.
+    static std::string GetName()
+    {
+        return "AVERAGE_PER_SECOND";
+    }
+
+    /**
+     * @param sum the sum of all the received inputs.
+     * @param numOfSamples the number of received inputs.
+     * @param duration the time between the first and the last received input.
+     * @return the output value.
+     */
+    static double Compute(double sum, uint64_t numOfSamples, const Time& duration)
+    {
+        if (duration.IsZero())
+        {
+            return 0.0;
+        }
+        return sum / duration.GetSeconds();
+    }
+};
+
+// COLLECTOR //////////////////////////////////////////////////////////////////
+
+/**
+ * @ingroup aggregator
+ * @brief Compile-time specialized variant of ScalarCollector.
+ *
+ * ### Input ###
+ * This class provides a single trace sink, TraceSink(), which accepts the
+ * input data type `T`, e.g., `double`, `uint32_t`, `uint64_t`, or `bool`.
+ * Unlike ScalarCollector, there is no `InputDataType` attribute to check upon
+ * receiving an input sample; connecting a trace source of a different type is
+ * rejected by the compiler instead.
+ *
+ * ### Processing ###
+ * The received input values are accumulated as in ScalarCollector. The
+ * processing applied at the end is selected by the `OutputPolicy` template
+ * argument, which is one of ScalarOutputSum, ScalarOutputNumberOfSample,
+ * ScalarOutputAveragePerSample, or ScalarOutputAveragePerSecond. The current
+ * simulation time is only read when the policy needs it, i.e., with
+ * ScalarOutputAveragePerSecond.
+ *
+ * ### Output ###
+ * At the end of the instance's life (e.g., when the simulation ends), the
+ * `Output` trace source is fired to export the output, just like in
+ * ScalarCollector.
+ *
+ * Each combination of template arguments is a separate TypeId, named, for
+ * example, `ns3::ScalarCollectorT<double,AVERAGE_PER_SECOND>`. The
+ * combinations listed in the typedefs below are registered by this module and
+ * can be used with CollectorMap::SetType().
+ */
+template <typename T, typename OutputPolicy>
+class ScalarCollectorT : public DataCollectionObject
+{
+  public:
+    /// Creates a new collector instance.
+    ScalarCollectorT();
+
+    // inherited from ObjectBase base class
+    static TypeId GetTypeId();
+
+    // TRACE SINKS //////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Trace sink for receiving data from `T` valued trace sources.
+     * @param oldData the original value (discarded).
+     * @param newData the new value.
+     */
+    void TraceSink(T oldData, T newData);
+
+    /**
+     * @return the memory used by the instance, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+  protected:
+    // Inherited from Object base class
+    virtual void DoDispose();
+
+  private:
+    /// Sum of all input samples received.
+    typename ScalarCollectorInput<T>::Sum_t m_sum;
+
+    /// Number of input samples that have been received.
+    uint64_t m_numOfSamples;
+
+    /// The time when the first input sample is received.
+    Time m_firstSample;
+
+    /// The time when the last input sample is received.
+    Time m_lastSample;
+
+    TracedCallback<double> m_output; ///< `Output` trace source.
+
+    StatsProfiler::Handle m_profile; ///< Profiling counters, see StatsProfiler.
+
+}; // end of class ScalarCollectorT
+
+typedef ScalarCollectorT<double, ScalarOutputSum> DoubleSumCollector;
+typedef ScalarCollectorT<double, ScalarOutputNumberOfSample> DoubleCountCollector;
+typedef ScalarCollectorT<double, ScalarOutputAveragePerSample> DoubleAveragePerSampleCollector;
+typedef ScalarCollectorT<double, ScalarOutputAveragePerSecond> DoubleAveragePerSecondCollector;
+typedef ScalarCollectorT<uint32_t, ScalarOutputSum> Uinteger32SumCollector;
+typedef ScalarCollectorT<uint32_t, ScalarOutputNumberOfSample> Uinteger32CountCollector;
+typedef ScalarCollectorT<uint32_t, ScalarOutputAveragePerSample>
+    Uinteger32AveragePerSampleCollector;
+typedef ScalarCollectorT<uint32_t, ScalarOutputAveragePerSecond>
+    Uinteger32AveragePerSecondCollector;
+typedef ScalarCollectorT<uint64_t, ScalarOutputSum> Uinteger64SumCollector;
+typedef ScalarCollectorT<uint64_t, ScalarOutputNumberOfSample> Uinteger64CountCollector;
+typedef ScalarCollectorT<uint64_t, ScalarOutputAveragePerSample>
+    Uinteger64AveragePerSampleCollector;
+typedef ScalarCollectorT<uint64_t, ScalarOutputAveragePerSecond>
+    Uinteger64AveragePerSecondCollector;
+typedef ScalarCollectorT<bool, ScalarOutputSum> BooleanSumCollector;
+typedef ScalarCollectorT<bool, ScalarOutputNumberOfSample> BooleanCountCollector;
+typedef ScalarCollectorT<bool, ScalarOutputAveragePerSample> BooleanAveragePerSampleCollector;
+typedef ScalarCollectorT<bool, ScalarOutputAveragePerSecond> BooleanAveragePerSecondCollector;
+
+// TEMPLATE METHOD DEFINITIONS ////////////////////////////////////////////////
+
+template <typename T, typename OutputPolicy>
+ScalarCollectorT<T, OutputPolicy>::ScalarCollectorT()
+    : m_sum(0),
+      m_numOfSamples(0),
+      m_firstSample(MilliSeconds(0)),
+      m_lastSample(MilliSeconds(0))
+{
+}
+
+template <typename T, typename OutputPolicy>
+TypeId // static
+ScalarCollectorT<T, OutputPolicy>::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::ScalarCollectorT<" + ScalarCollectorInput<T>::GetName() + "," +
+               OutputPolicy::GetName() + ">")
+            .SetParent<DataCollectionObject>()
+            .AddConstructor<ScalarCollectorT<T, OutputPolicy>>()
+            .AddTraceSource("Output",
+                            "Single scalar output, fired once the instance is destroyed.",
+                            MakeTraceSourceAccessor(&ScalarCollectorT<T, OutputPolicy>::m_output),
+                            "ns3::CollectorOutputCallback");
+    return tid;
+}
+
+template <typename T, typename OutputPolicy>
+void
+ScalarCollectorT<T, OutputPolicy>::DoDispose()
+{
+    if (IsEnabled())
+    {
+        m_output(OutputPolicy::Compute(static_cast<double>(m_sum),
+                                       m_numOfSamples,
+                                       m_lastSample - m_firstSample));
+    }
+}
+
+template <typename T, typename OutputPolicy>
+void
+ScalarCollectorT<T, OutputPolicy>::TraceSink(T oldData, T newData)
+{
+    StatsProfiler::Scope profileScope(m_profile.Get("ScalarCollectorT", this));
+
+    if (IsEnabled())
+    {
+        if constexpr (OutputPolicy::NEEDS_SUM)
+        {
+            m_sum += newData;
+        }
+
+        if constexpr (OutputPolicy::NEEDS_TIME)
+        {
+            m_lastSample = Simulator::Now();
+            if (m_numOfSamples == 0)
+            {
+                m_firstSample = m_lastSample;
+            }
+        }
+
+        m_numOfSamples++;
+    }
+}
+
+template <typename T, typename OutputPolicy>
+uint64_t
+ScalarCollectorT<T, OutputPolicy>::GetMemoryUsage() const
+{
+    // The accumulators are kept inline, without any allocation.
+    return sizeof(ScalarCollectorT<T, OutputPolicy>);
+}
+
+} // end of namespace ns3
+
+#endif /* SCALAR_COLLECTOR_T_H */
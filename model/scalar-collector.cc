@@ -21,12 +21,18 @@
 
 #include "scalar-collector.h"
 
+#include "collector-state.h"
 #include "magister-stats.h"
+#include "memory-usage.h"
 
+#include "ns3/boolean.h"
+#include "ns3/double.h"
 #include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
+#include <cmath>
 #include <string>
 
 NS_LOG_COMPONENT_DEFINE("ScalarCollector");
@@ -78,7 +84,9 @@ ScalarCollector::ScalarCollector()
       m_lastSample(MilliSeconds(0)),
       m_hasReceivedSample(false),
       m_inputDataType(ScalarCollector::INPUT_DATA_TYPE_DOUBLE),
-      m_outputType(ScalarCollector::OUTPUT_TYPE_SUM)
+      m_outputType(ScalarCollector::OUTPUT_TYPE_SUM),
+      m_scale(1.0),
+      m_isConfidenceIntervalEnabled(false)
 
 {
     NS_LOG_FUNCTION(this << GetName());
@@ -129,10 +137,63 @@ ScalarCollector::GetTypeId()
                                 "AVERAGE_PER_SAMPLE",
                                 ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND,
                                 "AVERAGE_PER_SECOND"))
+            .AddAttribute("Scale",
+                          "Factor applied once to the output and to the confidence "
+                          "interval, e.g., to complete a linear unit conversion "
+                          "deferred by an upstream UnitConversionCollector. Not "
+                          "applied when the output type is `NUMBER_OF_SAMPLE`.",
+                          DoubleValue(1.0),
+                          MakeDoubleAccessor(&ScalarCollector::SetScale,
+                                             &ScalarCollector::GetScale),
+                          MakeDoubleChecker<double>())
             .AddTraceSource("Output",
                             "Single scalar output, fired once the instance is destroyed.",
                             MakeTraceSourceAccessor(&ScalarCollector::m_output),
-                            "ns3::CollectorOutputCallback");
+                            "ns3::CollectorOutputCallback")
+            .AddAttribute("ConfidenceInterval",
+                          "If true, estimate the confidence interval of the mean of "
+                          "the input samples using the method of batch means. The "
+                          "estimate is exported through the OutputConfidenceInterval "
+                          "and OutputInterimConfidenceInterval trace sources.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&ScalarCollector::SetConfidenceIntervalEnabled,
+                                              &ScalarCollector::IsConfidenceIntervalEnabled),
+                          MakeBooleanChecker())
+            .AddAttribute("NumOfBatches",
+                          "Number of batches kept in memory by the batch means "
+                          "estimator. Must be an even number not less than 4, "
+                          "otherwise the simulation is aborted.",
+                          UintegerValue(32),
+                          MakeUintegerAccessor(&ScalarCollector::SetNumOfBatches,
+                                               &ScalarCollector::GetNumOfBatches),
+                          MakeUintegerChecker<uint32_t>(4))
+            .AddAttribute("ConfidenceLevel",
+                          "Confidence level of the interval estimated by the batch "
+                          "means estimator. Must be between 0 and 1 (exclusive), "
+                          "otherwise the simulation is aborted.",
+                          DoubleValue(0.95),
+                          MakeDoubleAccessor(&ScalarCollector::SetConfidenceLevel,
+                                             &ScalarCollector::GetConfidenceLevel),
+                          MakeDoubleChecker<double>(0.0, 1.0))
+            .AddAttribute("WarmupTruncation",
+                          "If true, apply the MSER-5 rule to drop the initial "
+                          "transient batches from the confidence interval estimate.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&ScalarCollector::SetWarmupTruncationEnabled,
+                                              &ScalarCollector::IsWarmupTruncationEnabled),
+                          MakeBooleanChecker())
+            .AddTraceSource("OutputConfidenceInterval",
+                            "The mean of the input samples and the half-width of its "
+                            "confidence interval, fired once the instance is destroyed. "
+                            "Both values are NaN if less than 2 batches are available.",
+                            MakeTraceSourceAccessor(&ScalarCollector::m_outputConfidenceInterval),
+                            "ns3::CollectorConfidenceIntervalCallback")
+            .AddTraceSource(
+                "OutputInterimConfidenceInterval",
+                "The mean of the input samples and the half-width of its "
+                "confidence interval, fired every time a batch is completed.",
+                MakeTraceSourceAccessor(&ScalarCollector::m_outputInterimConfidenceInterval),
+                "ns3::CollectorConfidenceIntervalCallback");
     return tid;
 }
 
@@ -143,23 +204,7 @@ ScalarCollector::DoDispose()
 
     if (IsEnabled())
     {
-        double sum = 0.0;
-
-        switch (m_inputDataType)
-        {
-        case ScalarCollector::INPUT_DATA_TYPE_DOUBLE:
-            sum = m_sumDouble;
-            break;
-
-        case ScalarCollector::INPUT_DATA_TYPE_UINTEGER:
-        case ScalarCollector::INPUT_DATA_TYPE_BOOLEAN:
-            sum = static_cast<double>(m_sumUinteger);
-            break;
-
-        default:
-            break;
-        }
-
+        const double sum = GetSum();
         double output = 0.0;
 
         switch (m_outputType)
@@ -198,8 +243,22 @@ ScalarCollector::DoDispose()
             break;
         }
 
+        if (m_outputType != ScalarCollector::OUTPUT_TYPE_NUMBER_OF_SAMPLE)
+        {
+            output *= m_scale;
+        }
+
         m_output(output);
 
+        if (m_isConfidenceIntervalEnabled)
+        {
+            NS_LOG_INFO(this << " batch means: " << m_batchMeans.GetNumOfCompleteBatches()
+                             << " batches of " << m_batchMeans.GetBatchSize() << " samples, "
+                             << m_batchMeans.GetNumOfTruncatedBatches() << " truncated");
+            m_outputConfidenceInterval(m_scale * m_batchMeans.GetMean(),
+                                       std::fabs(m_scale) * m_batchMeans.GetHalfWidth());
+        }
+
     } // end of if (IsEnabled ())
 
 } // end of void DoDispose ();
@@ -230,10 +289,149 @@ ScalarCollector::GetOutputType() const
     return m_outputType;
 }
 
+void
+ScalarCollector::SetScale(double scale)
+{
+    NS_LOG_FUNCTION(this << GetName() << scale);
+    m_scale = scale;
+}
+
+double
+ScalarCollector::GetScale() const
+{
+    return m_scale;
+}
+
+double
+ScalarCollector::GetSum() const
+{
+    switch (m_inputDataType)
+    {
+    case ScalarCollector::INPUT_DATA_TYPE_DOUBLE:
+        return m_sumDouble;
+
+    case ScalarCollector::INPUT_DATA_TYPE_UINTEGER:
+    case ScalarCollector::INPUT_DATA_TYPE_BOOLEAN:
+        return static_cast<double>(m_sumUinteger);
+
+    default:
+        return 0.0;
+    }
+}
+
+uint32_t
+ScalarCollector::GetNumOfSamples() const
+{
+    return m_numOfSamples;
+}
+
+void
+ScalarCollector::SetConfidenceIntervalEnabled(bool confidenceInterval)
+{
+    NS_LOG_FUNCTION(this << GetName() << confidenceInterval);
+    m_isConfidenceIntervalEnabled = confidenceInterval;
+}
+
+bool
+ScalarCollector::IsConfidenceIntervalEnabled() const
+{
+    return m_isConfidenceIntervalEnabled;
+}
+
+void
+ScalarCollector::SetNumOfBatches(uint32_t numOfBatches)
+{
+    NS_LOG_FUNCTION(this << GetName() << numOfBatches);
+    m_batchMeans.SetNumOfBatches(numOfBatches);
+}
+
+uint32_t
+ScalarCollector::GetNumOfBatches() const
+{
+    return m_batchMeans.GetNumOfBatches();
+}
+
+void
+ScalarCollector::SetConfidenceLevel(double confidenceLevel)
+{
+    NS_LOG_FUNCTION(this << GetName() << confidenceLevel);
+    m_batchMeans.SetConfidenceLevel(confidenceLevel);
+}
+
+double
+ScalarCollector::GetConfidenceLevel() const
+{
+    return m_batchMeans.GetConfidenceLevel();
+}
+
+void
+ScalarCollector::SetWarmupTruncationEnabled(bool warmupTruncation)
+{
+    NS_LOG_FUNCTION(this << GetName() << warmupTruncation);
+    m_batchMeans.SetTruncationEnabled(warmupTruncation);
+}
+
+bool
+ScalarCollector::IsWarmupTruncationEnabled() const
+{
+    return m_batchMeans.IsTruncationEnabled();
+}
+
+void
+ScalarCollector::UpdateConfidenceInterval(double sample)
+{
+    if (m_batchMeans.AddSample(sample))
+    {
+        m_outputInterimConfidenceInterval(m_scale * m_batchMeans.GetMean(),
+                                          std::fabs(m_scale) * m_batchMeans.GetHalfWidth());
+    }
+}
+
+uint64_t
+ScalarCollector::GetMemoryUsage() const
+{
+    return sizeof(ScalarCollector) + m_batchMeans.GetMemoryUsage();
+}
+
+uint32_t
+ScalarCollector::GetSerializedStateSize() const
+{
+    return 8 + 8 + 4 + 8 + 8 + 1 + m_batchMeans.GetSerializedStateSize();
+}
+
+void
+ScalarCollector::SerializeState(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    CollectorState::WriteDouble(i, m_sumDouble);
+    i.WriteU64(m_sumUinteger);
+    i.WriteU32(m_numOfSamples);
+    CollectorState::WriteTime(i, m_firstSample);
+    CollectorState::WriteTime(i, m_lastSample);
+    i.WriteU8(m_hasReceivedSample ? 1 : 0);
+    m_batchMeans.SerializeState(i);
+}
+
+uint32_t
+ScalarCollector::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this << GetName());
+    Buffer::Iterator i = start;
+    m_sumDouble = CollectorState::ReadDouble(i);
+    m_sumUinteger = i.ReadU64();
+    m_numOfSamples = i.ReadU32();
+    m_firstSample = CollectorState::ReadTime(i);
+    m_lastSample = CollectorState::ReadTime(i);
+    m_hasReceivedSample = (i.ReadU8() != 0);
+    i.Next(m_batchMeans.DeserializeState(i));
+    return i.GetDistanceFrom(start);
+}
+
 void
 ScalarCollector::TraceSinkDouble(double oldData, double newData)
 {
     // NS_LOG_FUNCTION (this << GetName () << newData);
+    StatsProfiler::Scope profileScope(m_profile.Get("ScalarCollector", this));
 
     if (IsEnabled())
     {
@@ -245,10 +443,15 @@ ScalarCollector::TraceSinkDouble(double oldData, double newData)
 
             if (!m_hasReceivedSample)
             {
-                m_firstSample = Simulator::Now();
+                m_firstSample = m_lastSample;
                 m_hasReceivedSample = true;
                 NS_LOG_INFO(this << " first sample at " << m_firstSample.GetSeconds());
             }
+
+            if (m_isConfidenceIntervalEnabled)
+            {
+                UpdateConfidenceInterval(newData);
+            }
         }
         else
         {
@@ -283,6 +486,7 @@ void
 ScalarCollector::TraceSinkUinteger64(uint64_t oldData, uint64_t newData)
 {
     // NS_LOG_FUNCTION (this << GetName () << newData);
+    StatsProfiler::Scope profileScope(m_profile.Get("ScalarCollector", this));
 
     if (IsEnabled())
     {
@@ -294,10 +498,15 @@ ScalarCollector::TraceSinkUinteger64(uint64_t oldData, uint64_t newData)
 
             if (!m_hasReceivedSample)
             {
-                m_firstSample = Simulator::Now();
+                m_firstSample = m_lastSample;
                 m_hasReceivedSample = true;
                 NS_LOG_INFO(this << " first sample at " << m_firstSample.GetSeconds());
             }
+
+            if (m_isConfidenceIntervalEnabled)
+            {
+                UpdateConfidenceInterval(static_cast<double>(newData));
+            }
         }
         else
         {
@@ -311,6 +520,7 @@ void
 ScalarCollector::TraceSinkBoolean(bool oldData, bool newData)
 {
     // NS_LOG_FUNCTION (this << GetName () << newData);
+    StatsProfiler::Scope profileScope(m_profile.Get("ScalarCollector", this));
 
     if (IsEnabled())
     {
@@ -326,10 +536,15 @@ ScalarCollector::TraceSinkBoolean(bool oldData, bool newData)
 
             if (!m_hasReceivedSample)
             {
-                m_firstSample = Simulator::Now();
+                m_firstSample = m_lastSample;
                 m_hasReceivedSample = true;
                 NS_LOG_INFO(this << " first sample at " << m_firstSample.GetSeconds());
             }
+
+            if (m_isConfidenceIntervalEnabled)
+            {
+                UpdateConfidenceInterval(newData ? 1.0 : 0.0);
+            }
         }
         else
         {
@@ -22,6 +22,10 @@
 #ifndef SCALAR_COLLECTOR_H
 #define SCALAR_COLLECTOR_H
 
+#include "batch-means.h"
+#include "stats-profiler.h"
+
+#include "ns3/buffer.h"
 #include "ns3/data-collection-object.h"
 #include "ns3/nstime.h"
 #include "ns3/traced-callback.h"
@@ -55,10 +59,31 @@ namespace ns3
  * or setting the `OutputType` attribute. For boolean data type, a `true` value
  * is regarded as 1, while a `false` value is regarded as 0.
  *
+ * The `Scale` attribute specifies a factor which is applied once to the
+ * output, rather than to every input sample. It allows an upstream linear
+ * unit conversion to be deferred (see
+ * UnitConversionCollector::SetDeferLinearConversion()). The factor is not
+ * applied to the number of samples.
+ *
  * ### Output ###
  * At the end of the instance's life (e.g., when the simulation ends), the
  * `Output` trace source is fired to export the output. It contains a single
  * value in `double` type carrying the sum accumulated during the simulation.
+ *
+ * ### Confidence interval ###
+ * Optionally, the class can also estimate a confidence interval of the mean of
+ * the input samples within a single simulation run. This is enabled by setting
+ * the `ConfidenceInterval` attribute to true. The input samples are then also
+ * passed to a BatchMeans estimator, which uses `NumOfBatches` batches in
+ * constant memory and the confidence level specified by the `ConfidenceLevel`
+ * attribute. Setting the `WarmupTruncation` attribute enables the MSER-5
+ * warm-up truncation, which drops the initial transient batches.
+ *
+ * The mean and the half-width of the confidence interval are exported through
+ * the `OutputConfidenceInterval` trace source at the end of the instance's
+ * life. The `OutputInterimConfidenceInterval` trace source exports the same
+ * information every time a batch is completed, which is useful for monitoring
+ * the precision of the estimate during the simulation.
  */
 class ScalarCollector : public DataCollectionObject
 {
@@ -140,6 +165,70 @@ class ScalarCollector : public DataCollectionObject
      */
     OutputType_t GetOutputType() const;
 
+    /**
+     * @param scale the factor applied to the output and to the confidence
+     *              interval.
+     */
+    void SetScale(double scale);
+
+    /**
+     * @return the factor applied to the output and to the confidence interval.
+     */
+    double GetScale() const;
+
+    /**
+     * @return the sum of the input samples received so far, before the
+     *         `Scale` attribute is applied.
+     */
+    double GetSum() const;
+
+    /**
+     * @return the number of input samples received so far.
+     */
+    uint32_t GetNumOfSamples() const;
+
+    /**
+     * @param confidenceInterval whether to estimate the confidence interval of
+     *                           the mean of the input samples.
+     */
+    void SetConfidenceIntervalEnabled(bool confidenceInterval);
+
+    /**
+     * @return whether the confidence interval of the mean is estimated.
+     */
+    bool IsConfidenceIntervalEnabled() const;
+
+    /**
+     * @param numOfBatches the number of batches used by the batch means
+     *                     estimator; must be an even number not less than 4.
+     */
+    void SetNumOfBatches(uint32_t numOfBatches);
+
+    /**
+     * @return the number of batches used by the batch means estimator.
+     */
+    uint32_t GetNumOfBatches() const;
+
+    /**
+     * @param confidenceLevel the confidence level of the interval.
+     */
+    void SetConfidenceLevel(double confidenceLevel);
+
+    /**
+     * @return the confidence level of the interval.
+     */
+    double GetConfidenceLevel() const;
+
+    /**
+     * @param warmupTruncation whether to apply MSER-5 warm-up truncation.
+     */
+    void SetWarmupTruncationEnabled(bool warmupTruncation);
+
+    /**
+     * @return whether MSER-5 warm-up truncation is applied.
+     */
+    bool IsWarmupTruncationEnabled() const;
+
     // TRACE SINKS //////////////////////////////////////////////////////////////
 
     /**
@@ -226,11 +315,42 @@ class ScalarCollector : public DataCollectionObject
      */
     void TraceSinkBoolean(bool oldData, bool newData);
 
+    /**
+     * @return the memory used by the instance, see MemoryUsage.
+     */
+    uint64_t GetMemoryUsage() const;
+
+    /**
+     * @return the number of bytes written by SerializeState().
+     */
+    uint32_t GetSerializedStateSize() const;
+
+    /**
+     * @brief Save the sums, the number of samples, the time of the first and
+     *        the last samples, and the batches of the confidence interval
+     *        estimator, see CollectorState.
+     * @param start the iterator to write to.
+     */
+    void SerializeState(Buffer::Iterator start) const;
+
+    /**
+     * @brief Restore the state saved by SerializeState().
+     * @param start the iterator to read from.
+     * @return the number of bytes read.
+     */
+    uint32_t DeserializeState(Buffer::Iterator start);
+
   protected:
     // Inherited from Object base class
     virtual void DoDispose();
 
   private:
+    /**
+     * @brief Pass an accepted input sample to the batch means estimator.
+     * @param sample the input sample.
+     */
+    void UpdateConfidenceInterval(double sample);
+
     /// Sum of all `DOUBLE` input samples received.
     double m_sumDouble;
 
@@ -251,8 +371,22 @@ class ScalarCollector : public DataCollectionObject
 
     InputDataType_t m_inputDataType; ///< `InputDataType` attribute.
     OutputType_t m_outputType;       ///< `OutputType` attribute.
+    double m_scale;                  ///< `Scale` attribute.
     TracedCallback<double> m_output; ///< `Output` trace source.
 
+    /// Estimator of the confidence interval of the mean.
+    BatchMeans m_batchMeans;
+
+    bool m_isConfidenceIntervalEnabled; ///< `ConfidenceInterval` attribute.
+
+    /// `OutputConfidenceInterval` trace source.
+    TracedCallback<double, double> m_outputConfidenceInterval;
+
+    /// `OutputInterimConfidenceInterval` trace source.
+    TracedCallback<double, double> m_outputInterimConfidenceInterval;
+
+    StatsProfiler::Handle m_profile; ///< Profiling counters, see StatsProfiler.
+
 }; // end of class ScalarCollector
 
 } // end of namespace ns3
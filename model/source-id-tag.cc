@@ -0,0 +1,126 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "source-id-tag.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+#include <ostream>
+
+NS_LOG_COMPONENT_DEFINE("SourceIdTag");
+
+namespace ns3
+{
+
+NS_OBJECT_ENSURE_REGISTERED(SourceIdTag);
+
+SourceIdTag::SourceIdTag()
+    : Tag(),
+      m_sourceId(ANY_APPLICATION)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+SourceIdTag::SourceIdTag(uint32_t nodeId, uint32_t applicationIndex)
+    : Tag(),
+      m_sourceId(ANY_APPLICATION)
+{
+    NS_LOG_FUNCTION(this << nodeId << applicationIndex);
+    SetSource(nodeId, applicationIndex);
+}
+
+TypeId
+SourceIdTag::GetTypeId(void)
+{
+    static TypeId tid = TypeId("ns3::SourceIdTag").SetParent<Tag>().AddConstructor<SourceIdTag>();
+    return tid;
+}
+
+TypeId
+SourceIdTag::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+uint32_t
+SourceIdTag::GetSerializedSize() const
+{
+    return sizeof(uint32_t);
+}
+
+void
+SourceIdTag::Serialize(TagBuffer i) const
+{
+    i.WriteU32(m_sourceId);
+}
+
+void
+SourceIdTag::Deserialize(TagBuffer i)
+{
+    m_sourceId = i.ReadU32();
+}
+
+void
+SourceIdTag::Print(std::ostream& os) const
+{
+    NS_LOG_FUNCTION(this << &os);
+    os << "(NodeId=" << GetNodeId() << ", ApplicationIndex=";
+
+    if (GetApplicationIndex() == ANY_APPLICATION)
+    {
+        os << "ANY";
+    }
+    else
+    {
+        os << GetApplicationIndex();
+    }
+
+    os << ")";
+}
+
+void
+SourceIdTag::SetSource(uint32_t nodeId, uint32_t applicationIndex)
+{
+    NS_LOG_FUNCTION(this << nodeId << applicationIndex);
+    NS_ABORT_MSG_IF(nodeId > MAX_NODE_ID, "Node ID " << nodeId << " does not fit in SourceIdTag");
+    NS_ABORT_MSG_IF(applicationIndex > ANY_APPLICATION,
+                    "Application index " << applicationIndex << " does not fit in SourceIdTag");
+    m_sourceId = (nodeId << 8) | applicationIndex;
+}
+
+uint32_t
+SourceIdTag::GetSourceId() const
+{
+    return m_sourceId;
+}
+
+uint32_t
+SourceIdTag::GetNodeId() const
+{
+    return m_sourceId >> 8;
+}
+
+uint32_t
+SourceIdTag::GetApplicationIndex() const
+{
+    return m_sourceId & ANY_APPLICATION;
+}
+
+} // namespace ns3
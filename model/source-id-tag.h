@@ -0,0 +1,142 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef SOURCE_ID_TAG_H
+#define SOURCE_ID_TAG_H
+
+#include "ns3/tag.h"
+
+#include <ostream>
+#include <stdint.h>
+
+namespace ns3
+{
+
+/**
+ * @ingroup magister-stats
+ * @brief This class implements a tag that carries a compact identification of
+ *        the sender of the packet: the ID of the sending node and the index of
+ *        the sending application within the node.
+ *
+ * Both are packed into a single 32-bit source ID (the node ID in the upper 24
+ * bits, the application index in the lower 8 bits), so the tag takes 4 bytes
+ * in the tag buffer, whereas AddressTag takes the whole serialized Address.
+ * The statistics helpers resolve the source ID into an identifier by indexing
+ * into the identifier table built at install time, instead of searching a
+ * map of addresses.
+ *
+ * Senders which are not applications, e.g., a MAC layer, use
+ * #ANY_APPLICATION as the application index.
+ *
+ * @note This is a packet tag, which is only carried by the packet object it
+ *       is attached to. TCP segments the transmitted payload and reassembles
+ *       it into new packets at the receiver, so the packets received over TCP
+ *       do not have the tag, and the helpers identifying packets by their
+ *       sender discard them.
+ */
+class SourceIdTag : public Tag
+{
+  public:
+    /// Application index of a sender which is not an application.
+    static constexpr uint32_t ANY_APPLICATION = 0xFF;
+
+    /// Largest node ID which fits in the tag.
+    static constexpr uint32_t MAX_NODE_ID = 0xFFFFFF;
+
+    /**
+     * Creates a SourceIdTag instance of node 0 and #ANY_APPLICATION.
+     */
+    SourceIdTag();
+
+    /**
+     * @brief Creates a SourceIdTag instance with the given sender.
+     * @param nodeId the ID of the sending node, at most #MAX_NODE_ID.
+     * @param applicationIndex the index of the sending application within the
+     *                         node, below #ANY_APPLICATION, or
+     *                         #ANY_APPLICATION.
+     */
+    SourceIdTag(uint32_t nodeId, uint32_t applicationIndex = ANY_APPLICATION);
+
+    /**
+     * @brief Set the sender.
+     * @param nodeId the ID of the sending node, at most #MAX_NODE_ID.
+     * @param applicationIndex the index of the sending application within the
+     *                         node, or #ANY_APPLICATION.
+     *
+     * The simulation is aborted if either of them does not fit in the tag.
+     */
+    void SetSource(uint32_t nodeId, uint32_t applicationIndex = ANY_APPLICATION);
+
+    /**
+     * @return the packed 32-bit source ID.
+     */
+    uint32_t GetSourceId() const;
+
+    /**
+     * @return the ID of the sending node.
+     */
+    uint32_t GetNodeId() const;
+
+    /**
+     * @return the index of the sending application within the node, or
+     *         #ANY_APPLICATION.
+     */
+    uint32_t GetApplicationIndex() const;
+
+    /**
+     * Inherited from ObjectBase base class.
+     */
+    static TypeId GetTypeId();
+
+    /**
+     * @brief Get the type ID of instance
+     * @return the object TypeId
+     */
+    virtual TypeId GetInstanceTypeId() const;
+
+    /**
+     * Inherited from Tag base class.
+     */
+    virtual uint32_t GetSerializedSize() const;
+
+    /**
+     * Serializes information to buffer from this instance of SourceIdTag
+     * @param buf Buffer in which the information is serialized
+     */
+    virtual void Serialize(TagBuffer buf) const;
+
+    /**
+     * Deserializes information from buffer to this instance of SourceIdTag
+     * @param buf Buffer from which the information is deserialized
+     */
+    virtual void Deserialize(TagBuffer buf);
+
+    /**
+     * Print the sender of this instance of SourceIdTag
+     * @param &os Output stream to which the sender is printed.
+     */
+    virtual void Print(std::ostream& os) const;
+
+  private:
+    uint32_t m_sourceId; ///< The node ID and the application index, packed.
+};
+
+} // namespace ns3
+
+#endif /* SOURCE_ID_TAG_H */
@@ -0,0 +1,241 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#include "stats-profiler.h"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <sys/stat.h>
+
+NS_LOG_COMPONENT_DEFINE("StatsProfiler");
+
+namespace ns3
+{
+
+bool StatsProfiler::m_isEnabled = false;
+bool StatsProfiler::m_isReportScheduled = false;
+uint64_t StatsProfiler::m_generation = 0;
+uint64_t StatsProfiler::m_startTicks = 0;
+std::chrono::steady_clock::time_point StatsProfiler::m_startTime;
+Callback<void, const std::string&> StatsProfiler::m_reportCallback;
+
+/**
+ * @param fileName the name of a file.
+ * @return the size of the file in bytes, or zero if it does not exist.
+ */
+static int64_t
+GetFileSize(const std::string& fileName)
+{
+    struct stat st;
+    if (stat(fileName.c_str(), &st) != 0)
+    {
+        return 0;
+    }
+    return static_cast<int64_t>(st.st_size);
+}
+
+// HANDLE /////////////////////////////////////////////////////////////////////
+
+StatsProfiler::Handle::Handle()
+    : m_entry(nullptr),
+      m_generation(0)
+{
+}
+
+// PROFILER ///////////////////////////////////////////////////////////////////
+
+void // static
+StatsProfiler::SetEnabled(bool isEnabled)
+{
+    NS_LOG_FUNCTION(isEnabled);
+
+    if (isEnabled && !m_isEnabled)
+    {
+        m_startTicks = GetTicks();
+        m_startTime = std::chrono::steady_clock::now();
+    }
+
+    if (isEnabled)
+    {
+        ScheduleReport();
+    }
+
+    m_isEnabled = isEnabled;
+}
+
+void // static
+StatsProfiler::SetReportCallback(Callback<void, const std::string&> callback)
+{
+    NS_LOG_FUNCTION_NOARGS();
+    m_reportCallback = callback;
+}
+
+StatsProfiler::Entry_t* // static
+StatsProfiler::Register(const std::string& kind, const std::string& name)
+{
+    NS_LOG_FUNCTION(kind << name);
+
+    ScheduleReport();
+
+    std::deque<Entry_t>& entries = GetEntries();
+    entries.push_back(Entry_t{kind, name, 0, 0});
+    return &entries.back();
+}
+
+void // static
+StatsProfiler::AddOutputFile(const std::string& fileName)
+{
+    std::map<std::string, int64_t>& outputFiles = GetOutputFiles();
+
+    if (outputFiles.find(fileName) == outputFiles.end())
+    {
+        NS_LOG_FUNCTION(fileName);
+        outputFiles[fileName] = GetFileSize(fileName);
+    }
+}
+
+void // static
+StatsProfiler::PrintSummary(std::ostream& os)
+{
+    NS_LOG_FUNCTION_NOARGS();
+
+    const double secondsPerTick = GetSecondsPerTick();
+    const std::ios::fmtflags flags = os.flags();
+
+    os << std::left << std::setw(28) << "Object" << std::setw(40) << "Name" << std::right
+       << std::setw(14) << "Calls" << std::setw(14) << "Total (ms)" << std::setw(14)
+       << "Per call (ns)" << std::endl;
+
+    double totalSeconds = 0.0;
+    for (const Entry_t& entry : GetEntries())
+    {
+        if (entry.numOfCalls == 0)
+        {
+            continue;
+        }
+
+        const double seconds = entry.numOfTicks * secondsPerTick;
+        totalSeconds += seconds;
+
+        os << std::left << std::setw(28) << entry.kind << std::setw(40) << entry.name
+           << std::right << std::setw(14) << entry.numOfCalls << std::fixed
+           << std::setprecision(3) << std::setw(14) << seconds * 1e3 << std::setprecision(1)
+           << std::setw(14) << seconds * 1e9 / entry.numOfCalls << std::endl;
+        os.flags(flags);
+    }
+
+    os << std::left << std::setw(68) << "Total" << std::right << std::setw(14) << "" << std::fixed
+       << std::setprecision(3) << std::setw(14) << totalSeconds * 1e3 << std::endl;
+    os.flags(flags);
+
+    const std::map<std::string, int64_t>& outputFiles = GetOutputFiles();
+    if (!outputFiles.empty())
+    {
+        os << std::endl << std::left << std::setw(82) << "Output file" << std::right
+           << std::setw(14) << "Bytes" << std::endl;
+
+        for (const auto& outputFile : outputFiles)
+        {
+            os << std::left << std::setw(82) << outputFile.first << std::right << std::setw(14)
+               << GetFileSize(outputFile.first) - outputFile.second << std::endl;
+        }
+        os.flags(flags);
+    }
+}
+
+void // static
+StatsProfiler::Reset()
+{
+    NS_LOG_FUNCTION_NOARGS();
+
+    // The handles of the profiled objects notice the new generation, and
+    // register again instead of using the dropped entries.
+    GetEntries().clear();
+    m_generation++;
+
+    GetOutputFiles().clear();
+    m_startTicks = GetTicks();
+    m_startTime = std::chrono::steady_clock::now();
+}
+
+void // static
+StatsProfiler::Report()
+{
+    NS_LOG_FUNCTION_NOARGS();
+
+    std::ostringstream oss;
+    PrintSummary(oss);
+
+    if (m_reportCallback.IsNull())
+    {
+        std::clog << oss.str();
+    }
+    else
+    {
+        m_reportCallback(oss.str());
+    }
+
+    Reset();
+    m_isReportScheduled = false;
+}
+
+void // static
+StatsProfiler::ScheduleReport()
+{
+    if (!m_isReportScheduled)
+    {
+        Simulator::ScheduleDestroy(&StatsProfiler::Report);
+        m_isReportScheduled = true;
+    }
+}
+
+double // static
+StatsProfiler::GetSecondsPerTick()
+{
+    const uint64_t ticks = GetTicks() - m_startTicks;
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_startTime;
+
+    if (ticks == 0)
+    {
+        return 0.0;
+    }
+
+    return elapsed.count() / ticks;
+}
+
+std::deque<StatsProfiler::Entry_t>& // static
+StatsProfiler::GetEntries()
+{
+    static std::deque<Entry_t> entries;
+    return entries;
+}
+
+std::map<std::string, int64_t>& // static
+StatsProfiler::GetOutputFiles()
+{
+    static std::map<std::string, int64_t> outputFiles;
+    return outputFiles;
+}
+
+} // end of namespace ns3
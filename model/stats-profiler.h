@@ -0,0 +1,290 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#ifndef STATS_PROFILER_H
+#define STATS_PROFILER_H
+
+#include "ns3/callback.h"
+#include "ns3/data-collection-object.h"
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace ns3
+{
+
+/**
+ * @ingroup aggregator
+ * @brief Opt-in profiler of the time spent in the collectors and aggregators
+ *        of the module.
+ *
+ * Profiling is disabled by default and enabled by calling SetEnabled() before
+ * the simulation starts. Once enabled:
+ * - each profiled collector counts the samples received by its trace sinks and
+ *   accumulates the time spent processing them;
+ * - each profiled aggregator counts its write calls and accumulates the time
+ *   spent in them, and registers the files it writes to.
+ *
+ * The time is read from the time-stamp counter of the processor (`rdtsc`) on
+ * x86 processors, and from `std::chrono::steady_clock` elsewhere. Ticks are
+ * converted to seconds by calibrating them against `steady_clock` over the
+ * profiled period. The time of a collector includes the time spent in the
+ * collectors and aggregators connected to its output trace sources.
+ *
+ * When the simulator is destroyed, a summary table is built, listing every
+ * profiled object which has been active, and the size of each registered
+ * output file. The table is passed to the callback set by SetReportCallback(),
+ * or printed to `std::clog` if no callback is set. The entries are then
+ * dropped, so that the next simulation is profiled separately, and objects
+ * created for each simulation do not accumulate; call SetEnabled() again
+ * before it, to have it reported as well. The objects which outlive the
+ * simulation register again on their next sample or write.
+ *
+ * While profiling is disabled, the cost on the hot path is one branch per
+ * sample or write.
+ */
+class StatsProfiler
+{
+  public:
+    /**
+     * @brief Counters of a profiled object.
+     */
+    typedef struct
+    {
+        std::string kind;    ///< Type name of the object, e.g., "ScalarCollector".
+        std::string name;    ///< Name of the object.
+        uint64_t numOfCalls; ///< Number of samples received or write calls.
+        uint64_t numOfTicks; ///< Accumulated ticks spent in the calls.
+    } Entry_t;
+
+    /**
+     * @brief The entry of a profiled object, registered with the profiler on
+     *        first use while profiling is enabled, and again on first use
+     *        after the entries have been dropped by Reset().
+     *
+     * Profiled objects keep one instance as a member.
+     */
+    class Handle
+    {
+      public:
+        /// Creates a handle which is not registered yet.
+        Handle();
+
+        /**
+         * @param kind the type name of the object.
+         * @param object the object.
+         * @return the entry of the object, or a null pointer if profiling is
+         *         disabled.
+         */
+        inline Entry_t* Get(const char* kind, const DataCollectionObject* object)
+        {
+            if (!StatsProfiler::IsEnabled())
+            {
+                return nullptr;
+            }
+
+            if (m_entry == nullptr || m_generation != StatsProfiler::m_generation)
+            {
+                m_entry = StatsProfiler::Register(kind, object->GetName());
+                m_generation = StatsProfiler::m_generation;
+            }
+
+            return m_entry;
+        }
+
+        /**
+         * @param kind the type name of the object.
+         * @param name the name of the object, for objects which are not a
+         *             DataCollectionObject.
+         * @return the entry of the object, or a null pointer if profiling is
+         *         disabled.
+         */
+        inline Entry_t* Get(const char* kind, const char* name)
+        {
+            if (!StatsProfiler::IsEnabled())
+            {
+                return nullptr;
+            }
+
+            if (m_entry == nullptr || m_generation != StatsProfiler::m_generation)
+            {
+                m_entry = StatsProfiler::Register(kind, name);
+                m_generation = StatsProfiler::m_generation;
+            }
+
+            return m_entry;
+        }
+
+      private:
+        Entry_t* m_entry;      ///< The registered entry, if any.
+        uint64_t m_generation; ///< StatsProfiler::m_generation when #m_entry was registered.
+    };
+
+    /**
+     * @brief Counts one call and accumulates the time until the end of the
+     *        scope, unless constructed with a null entry.
+     */
+    class Scope
+    {
+      public:
+        /**
+         * @param entry the entry to update, or a null pointer to do nothing.
+         */
+        inline Scope(Entry_t* entry)
+            : m_entry(entry),
+              m_start(entry == nullptr ? 0 : StatsProfiler::GetTicks())
+        {
+        }
+
+        inline ~Scope()
+        {
+            if (m_entry != nullptr)
+            {
+                m_entry->numOfTicks += StatsProfiler::GetTicks() - m_start;
+                m_entry->numOfCalls++;
+            }
+        }
+
+      private:
+        Entry_t* m_entry; ///< The entry to update.
+        uint64_t m_start; ///< Ticks at the beginning of the scope.
+    };
+
+    /**
+     * @brief Enable or disable profiling.
+     * @param isEnabled whether profiling is enabled.
+     */
+    static void SetEnabled(bool isEnabled);
+
+    /**
+     * @return true if profiling is enabled.
+     */
+    static inline bool IsEnabled()
+    {
+        return m_isEnabled;
+    }
+
+    /**
+     * @brief Set the callback receiving the summary table when the simulator
+     *        is destroyed, instead of printing it to `std::clog`.
+     * @param callback the callback, or a null callback to print the table.
+     */
+    static void SetReportCallback(Callback<void, const std::string&> callback);
+
+    /**
+     * @brief Register an object to profile.
+     * @param kind the type name of the object.
+     * @param name the name of the object.
+     * @return the entry of the object, which remains valid until the next
+     *         Reset().
+     */
+    static Entry_t* Register(const std::string& kind, const std::string& name);
+
+    /**
+     * @brief Register a file written by a profiled aggregator. The size of the
+     *        file is reported in the summary table.
+     * @param fileName the name of the file.
+     */
+    static void AddOutputFile(const std::string& fileName);
+
+    /**
+     * @brief Write the summary table of the current counters.
+     * @param os the output stream.
+     */
+    static void PrintSummary(std::ostream& os);
+
+    /**
+     * @brief Drop every entry and forget the registered output files. The
+     *        handles of the profiled objects register again on first use.
+     */
+    static void Reset();
+
+    /**
+     * @return the current value of the profiler's clock, in ticks.
+     */
+    static inline uint64_t GetTicks()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+#endif
+    }
+
+  private:
+    /**
+     * @brief Report the summary table and reset the counters. Scheduled to run
+     *        when the simulator is destroyed.
+     */
+    static void Report();
+
+    /// Schedule Report() to run when the simulator is destroyed, unless it is already.
+    static void ScheduleReport();
+
+    /**
+     * @return the number of seconds per tick, calibrated since profiling was
+     *         enabled or last reset.
+     */
+    static double GetSecondsPerTick();
+
+    /**
+     * @return the entries of every object registered so far.
+     */
+    static std::deque<Entry_t>& GetEntries();
+
+    /**
+     * @return the registered output files, mapped to their sizes when they
+     *         were registered.
+     */
+    static std::map<std::string, int64_t>& GetOutputFiles();
+
+    /// Whether profiling is enabled.
+    static bool m_isEnabled;
+
+    /// Whether Report() is scheduled to run when the simulator is destroyed.
+    static bool m_isReportScheduled;
+
+    /// Incremented by Reset(), which invalidates the entries held by handles.
+    static uint64_t m_generation;
+
+    /// Ticks at the beginning of the profiled period.
+    static uint64_t m_startTicks;
+
+    /// Wall clock at the beginning of the profiled period.
+    static std::chrono::steady_clock::time_point m_startTime;
+
+    /// Receives the summary table.
+    static Callback<void, const std::string&> m_reportCallback;
+
+}; // end of class StatsProfiler
+
+} // end of namespace ns3
+
+#endif /* STATS_PROFILER_H */
@@ -0,0 +1,408 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "steady-state-controller.h"
+
+#include "magister-stats.h"
+#include "scalar-collector.h"
+
+#include "ns3/abort.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+
+NS_LOG_COMPONENT_DEFINE("SteadyStateController");
+
+namespace ns3
+{
+
+NS_OBJECT_ENSURE_REGISTERED(SteadyStateController);
+
+SteadyStateController::SteadyStateController()
+    : m_numOfConverged(0),
+      m_numOfActive(0),
+      m_hasStopped(false),
+      m_targetRelativePrecision(0.05),
+      m_minNumOfBatches(10),
+      m_minSimulationTime(Seconds(0)),
+      m_numOfBatches(32),
+      m_confidenceLevel(0.95),
+      m_warmupTruncation(false),
+      m_interval(Seconds(1))
+{
+    NS_LOG_FUNCTION(this << GetName());
+}
+
+TypeId // static
+SteadyStateController::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::SteadyStateController")
+            .SetParent<DataCollectionObject>()
+            .AddConstructor<SteadyStateController>()
+            .AddAttribute("TargetRelativePrecision",
+                          "The largest acceptable half-width of the confidence interval, "
+                          "relative to the absolute value of the mean, for a statistic "
+                          "to be regarded as converged.",
+                          DoubleValue(0.05),
+                          MakeDoubleAccessor(&SteadyStateController::m_targetRelativePrecision),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("MinNumOfBatches",
+                          "The minimum number of batches a statistic must have completed "
+                          "before it can be regarded as converged.",
+                          UintegerValue(10),
+                          MakeUintegerAccessor(&SteadyStateController::m_minNumOfBatches),
+                          MakeUintegerChecker<uint32_t>(2))
+            .AddAttribute("MinSimulationTime",
+                          "The simulation is never stopped before this time. If the "
+                          "statistics have converged earlier, the check is repeated "
+                          "at this time.",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&SteadyStateController::m_minSimulationTime),
+                          MakeTimeChecker())
+            .AddAttribute("NumOfBatches",
+                          "Number of batches kept in memory by the batch means estimator "
+                          "of statistics fed through TraceSinkDouble(). Must be an even "
+                          "number not less than 4.",
+                          UintegerValue(32),
+                          MakeUintegerAccessor(&SteadyStateController::m_numOfBatches),
+                          MakeUintegerChecker<uint32_t>(4))
+            .AddAttribute("ConfidenceLevel",
+                          "Confidence level of the interval estimated for statistics fed "
+                          "through TraceSinkDouble().",
+                          DoubleValue(0.95),
+                          MakeDoubleAccessor(&SteadyStateController::m_confidenceLevel),
+                          MakeDoubleChecker<double>(0.0, 1.0))
+            .AddAttribute("WarmupTruncation",
+                          "If true, apply the MSER-5 rule to statistics fed through "
+                          "TraceSinkDouble().",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&SteadyStateController::m_warmupTruncation),
+                          MakeBooleanChecker())
+            .AddAttribute("Interval",
+                          "Interval at which the collectors registered by "
+                          "AddScalarCollector() are read. Each interval produces one "
+                          "observation of the output of each collector. Must be "
+                          "strictly positive.",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&SteadyStateController::m_interval),
+                          MakeTimeChecker(Seconds(0)))
+            .AddTraceSource("SteadyState",
+                            "Fired once when every registered statistic has converged, "
+                            "right before the simulation is stopped. Contains the "
+                            "current simulation time in seconds.",
+                            MakeTraceSourceAccessor(&SteadyStateController::m_steadyState),
+                            "ns3::CollectorOutputCallback")
+            .AddTraceSource("OutputString",
+                            "Summary of every registered statistic, fired once the "
+                            "instance is destroyed.",
+                            MakeTraceSourceAccessor(&SteadyStateController::m_outputString),
+                            "ns3::CollectorInformationCallback");
+    return tid;
+}
+
+void
+SteadyStateController::DoDispose()
+{
+    NS_LOG_FUNCTION(this << GetName());
+
+    if (IsEnabled())
+    {
+        std::ostringstream oss;
+        oss << "% target_relative_precision: " << m_targetRelativePrecision << std::endl;
+        oss << "% steady_state: " << (m_hasStopped ? "true" : "false") << std::endl;
+
+        for (std::map<std::string, Statistic>::const_iterator it = m_statistics.begin();
+             it != m_statistics.end();
+             ++it)
+        {
+            std::string status = "not converged";
+            if (!it->second.isActive)
+            {
+                status = "idle";
+            }
+            else if (it->second.isConverged)
+            {
+                status = "converged";
+            }
+
+            oss << "% " << it->first << ": " << it->second.mean << " +- "
+                << it->second.halfWidth << " (" << it->second.numOfBatches << " batches, "
+                << status << ")" << std::endl;
+        }
+
+        m_outputString(oss.str());
+    }
+
+    m_readEvent.Cancel();
+    m_checkEvent.Cancel();
+    m_statistics.clear();
+    DataCollectionObject::DoDispose();
+}
+
+void
+SteadyStateController::AddStatistic(std::string context)
+{
+    NS_LOG_FUNCTION(this << GetName() << context);
+    GetStatistic(context);
+}
+
+void
+SteadyStateController::AddScalarCollector(std::string context, Ptr<ScalarCollector> collector)
+{
+    NS_LOG_FUNCTION(this << GetName() << context << collector);
+    NS_ASSERT(collector != nullptr);
+    NS_ABORT_MSG_IF(!m_interval.IsStrictlyPositive(),
+                    "The Interval attribute must be strictly positive, but it is " << m_interval);
+    Statistic& statistic = GetStatistic(context);
+    statistic.collector = collector;
+    statistic.lastSum = collector->GetSum();
+    statistic.lastNumOfSamples = collector->GetNumOfSamples();
+
+    if (m_readEvent.IsExpired())
+    {
+        m_readEvent = Simulator::Schedule(m_interval, &SteadyStateController::ReadCollectors, this);
+    }
+}
+
+uint32_t
+SteadyStateController::GetNumOfStatistics() const
+{
+    return m_statistics.size();
+}
+
+bool
+SteadyStateController::IsSteadyState() const
+{
+    return (m_numOfActive > 0) && (m_numOfConverged == m_numOfActive);
+}
+
+SteadyStateController::Statistic&
+SteadyStateController::GetStatistic(const std::string& context)
+{
+    std::map<std::string, Statistic>::iterator it = m_statistics.find(context);
+
+    if (it == m_statistics.end())
+    {
+        NS_LOG_INFO(this << " registering statistic " << context);
+        Statistic& statistic = m_statistics[context];
+        statistic.batchMeans.SetNumOfBatches(m_numOfBatches);
+        statistic.batchMeans.SetConfidenceLevel(m_confidenceLevel);
+        statistic.batchMeans.SetTruncationEnabled(m_warmupTruncation);
+        statistic.mean = std::numeric_limits<double>::quiet_NaN();
+        statistic.halfWidth = std::numeric_limits<double>::quiet_NaN();
+        statistic.numOfBatches = 0;
+        statistic.isConverged = false;
+        statistic.isActive = false;
+        statistic.lastSum = 0.0;
+        statistic.lastNumOfSamples = 0;
+        return statistic;
+    }
+
+    return it->second;
+}
+
+void
+SteadyStateController::TraceSinkDouble(std::string context, double value)
+{
+    // NS_LOG_FUNCTION (this << GetName () << context << value);
+
+    if (IsEnabled())
+    {
+        AddObservation(context, GetStatistic(context), value);
+    }
+}
+
+void
+SteadyStateController::TraceSinkConfidenceInterval(std::string context,
+                                                   double mean,
+                                                   double halfWidth)
+{
+    // NS_LOG_FUNCTION (this << GetName () << context << mean << halfWidth);
+
+    if (IsEnabled())
+    {
+        Statistic& statistic = GetStatistic(context);
+        ActivateStatistic(statistic);
+        statistic.mean = mean;
+        statistic.halfWidth = halfWidth;
+        statistic.numOfBatches++;
+        UpdateStatistic(context, statistic);
+    }
+}
+
+void
+SteadyStateController::AddObservation(const std::string& context,
+                                      Statistic& statistic,
+                                      double value)
+{
+    ActivateStatistic(statistic);
+
+    if (statistic.batchMeans.AddSample(value))
+    {
+        statistic.mean = statistic.batchMeans.GetMean();
+        statistic.halfWidth = statistic.batchMeans.GetHalfWidth();
+        statistic.numOfBatches++;
+        UpdateStatistic(context, statistic);
+    }
+}
+
+void
+SteadyStateController::ActivateStatistic(Statistic& statistic)
+{
+    if (!statistic.isActive)
+    {
+        statistic.isActive = true;
+        m_numOfActive++;
+    }
+}
+
+void
+SteadyStateController::ReadCollectors()
+{
+    NS_LOG_FUNCTION(this << GetName());
+
+    if (IsEnabled())
+    {
+        const double seconds = m_interval.GetSeconds();
+
+        for (std::map<std::string, Statistic>::iterator it = m_statistics.begin();
+             it != m_statistics.end();
+             ++it)
+        {
+            Statistic& statistic = it->second;
+            if (statistic.collector == nullptr || !statistic.collector->IsEnabled())
+            {
+                continue;
+            }
+
+            const double sum = statistic.collector->GetSum();
+            const uint32_t numOfSamples = statistic.collector->GetNumOfSamples();
+            if (numOfSamples == 0)
+            {
+                continue; // The statistic is still idle.
+            }
+
+            const double intervalSum = sum - statistic.lastSum;
+            const uint32_t intervalNumOfSamples = numOfSamples - statistic.lastNumOfSamples;
+            statistic.lastSum = sum;
+            statistic.lastNumOfSamples = numOfSamples;
+            const double scale = statistic.collector->GetScale();
+
+            switch (statistic.collector->GetOutputType())
+            {
+            case ScalarCollector::OUTPUT_TYPE_SUM:
+                AddObservation(it->first, statistic, scale * intervalSum);
+                break;
+
+            case ScalarCollector::OUTPUT_TYPE_NUMBER_OF_SAMPLE:
+                AddObservation(it->first, statistic, intervalNumOfSamples);
+                break;
+
+            case ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SAMPLE:
+                if (intervalNumOfSamples > 0)
+                {
+                    AddObservation(it->first,
+                                   statistic,
+                                   scale * intervalSum / intervalNumOfSamples);
+                }
+                break;
+
+            case ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND:
+                AddObservation(it->first, statistic, scale * intervalSum / seconds);
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+
+    if (!m_hasStopped)
+    {
+        m_readEvent = Simulator::Schedule(m_interval, &SteadyStateController::ReadCollectors, this);
+    }
+}
+
+void
+SteadyStateController::UpdateStatistic(const std::string& context, Statistic& statistic)
+{
+    // Comparisons with -nan are always false, hence an invalid interval is
+    // never regarded as converged.
+    const bool isConverged =
+        (statistic.numOfBatches >= m_minNumOfBatches) && (statistic.mean != 0.0) &&
+        (statistic.halfWidth <= m_targetRelativePrecision * std::fabs(statistic.mean));
+
+    if (isConverged != statistic.isConverged)
+    {
+        NS_LOG_INFO(this << " statistic " << context << (isConverged ? " has" : " has not")
+                         << " converged: " << statistic.mean << " +- " << statistic.halfWidth);
+        statistic.isConverged = isConverged;
+
+        if (isConverged)
+        {
+            m_numOfConverged++;
+        }
+        else
+        {
+            NS_ASSERT(m_numOfConverged > 0);
+            m_numOfConverged--;
+        }
+    }
+
+    CheckSteadyState();
+}
+
+void
+SteadyStateController::CheckSteadyState()
+{
+    if (m_hasStopped || !IsSteadyState())
+    {
+        return;
+    }
+
+    if (Simulator::Now() < m_minSimulationTime)
+    {
+        // Without this, the check would wait for the next update of a statistic.
+        if (m_checkEvent.IsExpired())
+        {
+            m_checkEvent = Simulator::Schedule(m_minSimulationTime - Simulator::Now(),
+                                               &SteadyStateController::CheckSteadyState,
+                                               this);
+        }
+        return;
+    }
+
+    NS_LOG_INFO(this << " all " << m_numOfActive << " active statistics out of "
+                     << m_statistics.size() << " have converged, stopping the simulation");
+    m_hasStopped = true;
+    m_readEvent.Cancel();
+    m_checkEvent.Cancel();
+    m_steadyState(Simulator::Now().GetSeconds());
+    Simulator::Stop();
+}
+
+} // end of namespace ns3
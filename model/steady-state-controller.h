@@ -0,0 +1,243 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef STEADY_STATE_CONTROLLER_H
+#define STEADY_STATE_CONTROLLER_H
+
+#include "batch-means.h"
+
+#include "ns3/data-collection-object.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/traced-callback.h"
+
+#include <map>
+#include <string>
+
+namespace ns3
+{
+
+class ScalarCollector;
+
+/**
+ * @ingroup aggregator
+ * @brief Stops the simulation once the selected statistics have reached the
+ *        desired precision.
+ *
+ * ### Input ###
+ * This class provides 2 trace sinks which act similarly to an aggregator's
+ * input methods, i.e., the first argument is a context string identifying the
+ * statistic:
+ * - TraceSinkDouble() accepts a stream of observations, such as the
+ *   `OutputWithoutTime` trace source of IntervalRateCollector. The
+ *   observations are passed to a BatchMeans estimator maintained for the
+ *   context.
+ * - TraceSinkConfidenceInterval() accepts confidence intervals which have
+ *   already been estimated, such as the `OutputInterimConfidenceInterval`
+ *   trace source of ScalarCollector.
+ *
+ * In addition, AddScalarCollector() registers a ScalarCollector as a
+ * statistic. Such a collector only produces its output at the end of the
+ * simulation, hence the controller reads its accumulated sum and number of
+ * samples at the end of every interval (see the `Interval` attribute), and
+ * passes the output the collector would produce for that interval alone as an
+ * observation to the BatchMeans estimator of the statistic. For example, the
+ * observations of a collector with the `OUTPUT_TYPE_AVERAGE_PER_SECOND` output
+ * type are the per-second averages of the successive intervals, which is the
+ * quantity reported by the collector, rather than the input samples.
+ *
+ * ### Processing ###
+ * A statistic is considered *converged* when the half-width of its confidence
+ * interval, relative to the absolute value of its mean, does not exceed the
+ * `TargetRelativePrecision` attribute, and at least `MinNumOfBatches` batches
+ * have been completed. Statistics can be registered in advance using
+ * AddStatistic(); unregistered contexts are registered upon their first
+ * input.
+ *
+ * A registered statistic which has not received any input yet, e.g., the
+ * statistic of an idle node, is regarded as *idle*. Idle statistics do not
+ * prevent the simulation from being stopped.
+ *
+ * ### Output ###
+ * Once every statistic which is not idle is converged at the same time, and
+ * the simulation time has reached the `MinSimulationTime` attribute, the
+ * instance calls Simulator::Stop() and fires the `SteadyState` trace source.
+ * If the statistics converge earlier than `MinSimulationTime`, the check is
+ * scheduled at `MinSimulationTime`. A summary of every statistic is exported
+ * through the `OutputString` trace source at the end of the instance's life.
+ */
+class SteadyStateController : public DataCollectionObject
+{
+  public:
+    /// Creates a new controller instance.
+    SteadyStateController();
+
+    // inherited from ObjectBase base class
+    static TypeId GetTypeId();
+
+    /**
+     * @brief Register a statistic which must converge before the simulation is
+     *        stopped.
+     * @param context the context string which identifies the statistic.
+     */
+    void AddStatistic(std::string context);
+
+    /**
+     * @brief Register a ScalarCollector whose output must converge before the
+     *        simulation is stopped.
+     * @param context the context string which identifies the statistic.
+     * @param collector the collector to read at the end of every interval.
+     *
+     * The observation of an interval is the sum per second, the sum, the
+     * number of samples, or the average per sample received by the collector
+     * during the interval, depending on the collector's output type, and
+     * multiplied by the collector's `Scale` attribute. Intervals without any
+     * sample are skipped for the average per sample.
+     *
+     * The simulation is aborted if the `Interval` attribute is not strictly
+     * positive.
+     */
+    void AddScalarCollector(std::string context, Ptr<ScalarCollector> collector);
+
+    /**
+     * @return the number of registered statistics.
+     */
+    uint32_t GetNumOfStatistics() const;
+
+    /**
+     * @return true if every registered statistic which is not idle is
+     *         currently converged, and at least one of them is not idle.
+     */
+    bool IsSteadyState() const;
+
+    // TRACE SINKS //////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Trace sink for receiving observations of a statistic.
+     * @param context the context string which identifies the statistic.
+     * @param value the observed value.
+     */
+    void TraceSinkDouble(std::string context, double value);
+
+    /**
+     * @brief Trace sink for receiving the confidence interval of a statistic.
+     * @param context the context string which identifies the statistic.
+     * @param mean the estimated mean of the statistic.
+     * @param halfWidth the half-width of the confidence interval.
+     */
+    void TraceSinkConfidenceInterval(std::string context, double mean, double halfWidth);
+
+  protected:
+    // Inherited from Object base class
+    virtual void DoDispose();
+
+  private:
+    /// State maintained for each registered statistic.
+    struct Statistic
+    {
+        BatchMeans batchMeans; ///< Estimator used by TraceSinkDouble().
+        double mean;           ///< The latest estimated mean.
+        double halfWidth;      ///< The latest half-width of the interval.
+        uint32_t numOfBatches; ///< Number of batches completed so far.
+        bool isConverged;      ///< Whether the target precision is met.
+        bool isActive;         ///< Whether any input has been received.
+
+        /// The collector read at every interval, if registered as one.
+        Ptr<ScalarCollector> collector;
+        double lastSum;            ///< Sum of #collector at the last interval.
+        uint32_t lastNumOfSamples; ///< Number of samples at the last interval.
+    };
+
+    /**
+     * @param context the context string which identifies the statistic.
+     * @return the statistic, which is registered if not yet done before.
+     */
+    Statistic& GetStatistic(const std::string& context);
+
+    /**
+     * @brief Pass an observation to the estimator of a statistic.
+     * @param context the context string which identifies the statistic.
+     * @param statistic the statistic.
+     * @param value the observed value.
+     */
+    void AddObservation(const std::string& context, Statistic& statistic, double value);
+
+    /**
+     * @brief Mark a statistic as not idle, upon its first input.
+     * @param statistic the statistic.
+     */
+    void ActivateStatistic(Statistic& statistic);
+
+    /**
+     * @brief Update the convergence status of a statistic and stop the
+     *        simulation if every statistic is converged.
+     * @param context the context string which identifies the statistic.
+     * @param statistic the statistic to update.
+     */
+    void UpdateStatistic(const std::string& context, Statistic& statistic);
+
+    /**
+     * @brief Stop the simulation if every statistic which is not idle is
+     *        converged and `MinSimulationTime` has been reached, otherwise
+     *        schedule the check at `MinSimulationTime` if only the latter is
+     *        missing.
+     */
+    void CheckSteadyState();
+
+    /**
+     * @brief Read the collectors registered by AddScalarCollector() at the end
+     *        of an interval, and schedule the end of the next interval.
+     */
+    void ReadCollectors();
+
+    /// The registered statistics, indexed by context.
+    std::map<std::string, Statistic> m_statistics;
+
+    /// Number of registered statistics which are currently converged.
+    uint32_t m_numOfConverged;
+
+    /// Number of registered statistics which are not idle.
+    uint32_t m_numOfActive;
+
+    /// True if Simulator::Stop() has been called by this instance.
+    bool m_hasStopped;
+
+    /// The end of the current interval, see ReadCollectors().
+    EventId m_readEvent;
+
+    /// The check scheduled at `MinSimulationTime`, see CheckSteadyState().
+    EventId m_checkEvent;
+
+    double m_targetRelativePrecision; ///< `TargetRelativePrecision` attribute.
+    uint32_t m_minNumOfBatches;       ///< `MinNumOfBatches` attribute.
+    Time m_minSimulationTime;         ///< `MinSimulationTime` attribute.
+    uint32_t m_numOfBatches;          ///< `NumOfBatches` attribute.
+    double m_confidenceLevel;         ///< `ConfidenceLevel` attribute.
+    bool m_warmupTruncation;          ///< `WarmupTruncation` attribute.
+    Time m_interval;                  ///< `Interval` attribute.
+
+    TracedCallback<double> m_steadyState;       ///< `SteadyState` trace source.
+    TracedCallback<std::string> m_outputString; ///< `OutputString` trace source.
+
+}; // end of class SteadyStateController
+
+} // end of namespace ns3
+
+#endif /* STEADY_STATE_CONTROLLER_H */
@@ -20,6 +20,9 @@
 
 #include "time-tag.h"
 
+#include "ns3/assert.h"
+#include "ns3/fatal-error.h"
+
 #include <ostream>
 
 namespace ns3
@@ -28,7 +31,8 @@ namespace ns3
 /*
  * There are 3 classes defined here: PhyTimeTag, MacTimeTag and
  * DevTimeTag. Except of the name difference, they share
- * exactly the same definitions.
+ * exactly the same definitions. LayerTimestampTag is defined
+ * at the end of the file.
  */
 
 // PHY ////////////////////////////////////////////////////////////////////////
@@ -235,4 +239,290 @@ DevTimeTag::SetSenderTimestamp(Time senderTimestamp)
     this->m_senderTimestamp = senderTimestamp;
 }
 
+// LAYERS /////////////////////////////////////////////////////////////////////
+
+/**
+ * @param value a signed integer.
+ * @return the zigzag encoding of the value, mapping small negative and
+ *         positive values to small unsigned values.
+ */
+static uint64_t
+ZigzagEncode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+/**
+ * @param value a zigzag encoded integer.
+ * @return the decoded signed integer.
+ */
+static int64_t
+ZigzagDecode(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+/**
+ * @param value a time stamp.
+ * @param first the time stamp of the first present layer.
+ * @return the difference of the time stamps, wrapped around modulo 2^64, so
+ *         that any pair of time stamps, e.g., the minimum and the maximum
+ *         ones, has a difference without a signed overflow.
+ */
+static int64_t
+GetWrappedDifference(int64_t value, int64_t first)
+{
+    return static_cast<int64_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(first));
+}
+
+/**
+ * @param first the time stamp of the first present layer.
+ * @param difference a difference returned by GetWrappedDifference().
+ * @return the original time stamp.
+ */
+static int64_t
+AddWrappedDifference(int64_t first, int64_t difference)
+{
+    return static_cast<int64_t>(static_cast<uint64_t>(first) + static_cast<uint64_t>(difference));
+}
+
+/**
+ * @param value an unsigned integer.
+ * @return the number of bytes of the variable-length encoding of the value.
+ */
+static uint32_t
+GetVarintSize(uint64_t value)
+{
+    uint32_t size = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+/**
+ * @param i the buffer to write to.
+ * @param value the unsigned integer to write, 7 bits per byte, least
+ *              significant group first.
+ */
+static void
+WriteVarint(TagBuffer& i, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        i.WriteU8(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    i.WriteU8(static_cast<uint8_t>(value));
+}
+
+/**
+ * @param i the buffer to read from.
+ * @return the unsigned integer read.
+ */
+static uint64_t
+ReadVarint(TagBuffer& i)
+{
+    uint64_t value = 0;
+    uint32_t shift = 0;
+    uint8_t byte;
+    do
+    {
+        byte = i.ReadU8();
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        shift += 7;
+    } while ((byte & 0x80) != 0 && shift < 64);
+    return value;
+}
+
+NS_OBJECT_ENSURE_REGISTERED(LayerTimestampTag);
+
+std::string // static
+LayerTimestampTag::GetLayerName(LayerTimestampTag::Layer_t layer)
+{
+    switch (layer)
+    {
+    case LayerTimestampTag::LAYER_APPLICATION:
+        return "LAYER_APPLICATION";
+    case LayerTimestampTag::LAYER_DEV:
+        return "LAYER_DEV";
+    case LayerTimestampTag::LAYER_MAC:
+        return "LAYER_MAC";
+    case LayerTimestampTag::LAYER_PHY:
+        return "LAYER_PHY";
+    default:
+        NS_FATAL_ERROR("LayerTimestampTag - Invalid layer");
+        break;
+    }
+
+    NS_FATAL_ERROR("LayerTimestampTag - Invalid layer");
+    return "";
+}
+
+LayerTimestampTag::LayerTimestampTag()
+    : m_layers(0),
+      m_timestamps()
+{
+    // Nothing to do here
+}
+
+TypeId
+LayerTimestampTag::GetTypeId(void)
+{
+    static TypeId tid =
+        TypeId("ns3::LayerTimestampTag").SetParent<Tag>().AddConstructor<LayerTimestampTag>();
+    return tid;
+}
+
+TypeId
+LayerTimestampTag::GetInstanceTypeId(void) const
+{
+    return GetTypeId();
+}
+
+uint32_t
+LayerTimestampTag::GetSerializedSize(void) const
+{
+    uint32_t size = 1; // the presence bitmask
+    bool isFirst = true;
+    int64_t first = 0;
+
+    for (uint32_t layer = 0; layer < LAYER_COUNT; layer++)
+    {
+        if ((m_layers & (1 << layer)) != 0)
+        {
+            if (isFirst)
+            {
+                first = m_timestamps[layer];
+                size += GetVarintSize(ZigzagEncode(first));
+                isFirst = false;
+            }
+            else
+            {
+                size += GetVarintSize(
+                    ZigzagEncode(GetWrappedDifference(m_timestamps[layer], first)));
+            }
+        }
+    }
+
+    return size;
+}
+
+void
+LayerTimestampTag::Serialize(TagBuffer i) const
+{
+    i.WriteU8(m_layers);
+    bool isFirst = true;
+    int64_t first = 0;
+
+    for (uint32_t layer = 0; layer < LAYER_COUNT; layer++)
+    {
+        if ((m_layers & (1 << layer)) != 0)
+        {
+            if (isFirst)
+            {
+                first = m_timestamps[layer];
+                WriteVarint(i, ZigzagEncode(first));
+                isFirst = false;
+            }
+            else
+            {
+                WriteVarint(i, ZigzagEncode(GetWrappedDifference(m_timestamps[layer], first)));
+            }
+        }
+    }
+}
+
+void
+LayerTimestampTag::Deserialize(TagBuffer i)
+{
+    m_layers = i.ReadU8();
+    bool isFirst = true;
+    int64_t first = 0;
+
+    for (uint32_t layer = 0; layer < LAYER_COUNT; layer++)
+    {
+        if ((m_layers & (1 << layer)) != 0)
+        {
+            if (isFirst)
+            {
+                first = ZigzagDecode(ReadVarint(i));
+                m_timestamps[layer] = first;
+                isFirst = false;
+            }
+            else
+            {
+                m_timestamps[layer] = AddWrappedDifference(first, ZigzagDecode(ReadVarint(i)));
+            }
+        }
+        else
+        {
+            m_timestamps[layer] = 0;
+        }
+    }
+}
+
+void
+LayerTimestampTag::Print(std::ostream& os) const
+{
+    for (uint32_t layer = 0; layer < LAYER_COUNT; layer++)
+    {
+        if ((m_layers & (1 << layer)) != 0)
+        {
+            os << GetLayerName(static_cast<Layer_t>(layer)) << "="
+               << TimeStep(m_timestamps[layer]) << " ";
+        }
+    }
+}
+
+bool
+LayerTimestampTag::HasTimestamp(LayerTimestampTag::Layer_t layer) const
+{
+    NS_ASSERT(layer < LAYER_COUNT);
+    return (m_layers & (1 << layer)) != 0;
+}
+
+Time
+LayerTimestampTag::GetTimestamp(LayerTimestampTag::Layer_t layer) const
+{
+    NS_ASSERT(layer < LAYER_COUNT);
+    return HasTimestamp(layer) ? TimeStep(m_timestamps[layer]) : Time(0);
+}
+
+void
+LayerTimestampTag::SetTimestamp(LayerTimestampTag::Layer_t layer, Time timestamp)
+{
+    NS_ASSERT(layer < LAYER_COUNT);
+    m_timestamps[layer] = timestamp.GetTimeStep();
+    m_layers |= (1 << layer);
+}
+
+void // static
+LayerTimestampTag::Stamp(Ptr<Packet> packet, LayerTimestampTag::Layer_t layer, Time timestamp)
+{
+    // Removing the tag reads it in the same pass over the tag list, whereas
+    // peeking and then replacing it would go through the list twice.
+    LayerTimestampTag tag;
+    packet->RemovePacketTag(tag);
+    tag.SetTimestamp(layer, timestamp);
+    packet->AddPacketTag(tag);
+}
+
+bool // static
+LayerTimestampTag::Peek(Ptr<const Packet> packet,
+                        LayerTimestampTag::Layer_t layer,
+                        Time& timestamp)
+{
+    LayerTimestampTag tag;
+    if (packet->PeekPacketTag(tag) && tag.HasTimestamp(layer))
+    {
+        timestamp = tag.GetTimestamp(layer);
+        return true;
+    }
+
+    return false;
+}
+
 } // namespace ns3
@@ -0,0 +1,385 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef TYPED_PROBE_H
+#define TYPED_PROBE_H
+
+#include "ns3/assert.h"
+#include "ns3/callback.h"
+#include "ns3/config.h"
+#include "ns3/log.h"
+#include "ns3/names.h"
+#include "ns3/nstime.h"
+#include "ns3/probe.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/traced-callback.h"
+
+#include <string>
+
+namespace ns3
+{
+
+/**
+ * @ingroup probes
+ * @brief The type of the (old value, new value) output of a TypedProbe, and
+ *        the conversion of the probed value into it.
+ *
+ * By default, the probed value is emitted as is. Specializations convert the
+ * value into a numerical type, e.g., Time into seconds. The conversion is
+ * resolved at compile time and inlined into the trace sink.
+ */
+template <typename Value>
+struct TypedProbeTraits
+{
+    /// The type of the (old value, new value) output.
+    typedef Value Output_t;
+
+    /**
+     * @param value a probed value.
+     * @return the value, as emitted by the (old value, new value) output.
+     */
+    static Output_t Convert(const Value& value)
+    {
+        return value;
+    }
+};
+
+/**
+ * @ingroup probes
+ * @brief Time values are emitted in seconds.
+ */
+template <>
+struct TypedProbeTraits<Time>
+{
+    /// The type of the (old value, new value) output.
+    typedef double Output_t;
+
+    /**
+     * @param value a probed time value.
+     * @return the time value in seconds.
+     */
+    static Output_t Convert(const Time& value)
+    {
+        return value.GetSeconds();
+    }
+};
+
+/**
+ * @ingroup probes
+ * @brief Probe of a trace source exporting a value of type `Value`, optionally
+ *        followed by further arguments of types `Extra...` (e.g., the address
+ *        of the sender of a packet).
+ *
+ * The probe exports the following trace sources:
+ * - without extra arguments, the trace source "Output" with the previous and
+ *   the current value, converted by TypedProbeTraits;
+ * - with extra arguments, the trace source "Output" with the value and the
+ *   extra arguments as they were received, and a second trace source with the
+ *   previous and the current value, converted by TypedProbeTraits.
+ *
+ * The trace sources emit values when either the probed trace source emits a
+ * new value, or when SetValue() is called. The second trace source is only
+ * computed when it has sinks. The current value can be polled with
+ * GetValue().
+ *
+ * The trace sink is defined in this header, so that it can be inlined by the
+ * compiler. A concrete probe type is declared by deriving from the template,
+ * passing the name of its log component to the constructor, and registering
+ * its TypeId with DeriveTypeId(), e.g.:
+ * @code
+ *   class AddressTimeProbe : public TypedProbe<Time, const Address&>
+ *   {
+ *     public:
+ *       AddressTimeProbe ();
+ *       static TypeId GetTypeId ();
+ *   };
+ *
+ *   NS_LOG_COMPONENT_DEFINE ("AddressTimeProbe");
+ *
+ *   AddressTimeProbe::AddressTimeProbe ()
+ *     : TypedProbe ("AddressTimeProbe")
+ *   {
+ *   }
+ *
+ *   TypeId
+ *   AddressTimeProbe::GetTypeId ()
+ *   {
+ *     static TypeId tid = DeriveTypeId<AddressTimeProbe> ("ns3::AddressTimeProbe",
+ *                                                         "OutputSeconds", ...);
+ *     return tid;
+ *   }
+ * @endcode
+ */
+template <typename Value, typename... Extra>
+class TypedProbe : public Probe
+{
+  public:
+    /// The type of the (old value, new value) output.
+    typedef typename TypedProbeTraits<Value>::Output_t Output_t;
+
+    /**
+     * @brief Creates a new probe.
+     * @param logComponent the name of the log component of the concrete probe
+     *                     type, which must be defined by the concrete type
+     *                     with NS_LOG_COMPONENT_DEFINE, e.g.,
+     *                     "AddressTimeProbe".
+     */
+    TypedProbe(const std::string& logComponent);
+
+    virtual ~TypedProbe();
+
+    /**
+     * @return the most recent value of the probe.
+     */
+    Value GetValue() const;
+
+    /**
+     * @brief Set a probe value
+     *
+     * @param value set the traced value equal to this
+     * @param extra the extra arguments to emit along with the value
+     */
+    void SetValue(Value value, Extra... extra);
+
+    /**
+     * @brief Set a probe value by its name in the Config system
+     *
+     * @param path config path to access the probe
+     * @param value set the traced value equal to this
+     * @param extra the extra arguments to emit along with the value
+     */
+    static void SetValueByPath(std::string path, Value value, Extra... extra);
+
+    /**
+     * @brief connect to a trace source attribute provided by a given object
+     *
+     * @param traceSource the name of the attribute TraceSource to connect to
+     * @param obj ns3::Object to connect to
+     * @return true if the trace source was successfully connected
+     */
+    virtual bool ConnectByObject(std::string traceSource, Ptr<Object> obj);
+
+    /**
+     * @brief connect to a trace source provided by a config path
+     *
+     * @param path Config path to bind to
+     *
+     * Note, if an invalid path is provided, the probe will not be connected
+     * to anything.
+     */
+    virtual void ConnectByPath(std::string path);
+
+  protected:
+    /**
+     * @brief Create the TypeId of a concrete probe type without extra
+     *        arguments.
+     * @param name the name of the TypeId, e.g., "ns3::BytesProbe".
+     * @param outputHelp help text of the "Output" trace source, which emits
+     *                   the previous and the current value.
+     * @param outputCallback the name of the signature of the "Output" trace
+     *                       source.
+     * @return the TypeId.
+     */
+    template <typename T>
+    static TypeId DeriveTypeId(std::string name,
+                               std::string outputHelp,
+                               std::string outputCallback);
+
+    /**
+     * @brief Create the TypeId of a concrete probe type with extra arguments.
+     * @param name the name of the TypeId, e.g., "ns3::AddressTimeProbe".
+     * @param changeName the name of the (old value, new value) trace source.
+     * @param outputHelp help text of the "Output" trace source.
+     * @param changeHelp help text of the (old value, new value) trace source.
+     * @param outputCallback the name of the signature of the "Output" trace
+     *                       source.
+     * @param changeCallback the name of the signature of the (old value, new
+     *                       value) trace source.
+     * @return the TypeId.
+     */
+    template <typename T>
+    static TypeId DeriveTypeId(std::string name,
+                               std::string changeName,
+                               std::string outputHelp,
+                               std::string changeHelp,
+                               std::string outputCallback,
+                               std::string changeCallback);
+
+  private:
+    /**
+     * @brief Method to connect to an underlying ns3::TraceSource.
+     *
+     * @param value the traced value
+     * @param extra the extra arguments of the traced value
+     */
+    void TraceSink(Value value, Extra... extra);
+
+    /**
+     * @brief Emit a value to the trace sources and remember it.
+     *
+     * @param value the new value
+     * @param extra the extra arguments of the value
+     */
+    void Emit(Value value, Extra... extra);
+
+    /// Output trace, the value and its extra arguments.
+    TracedCallback<Value, Extra...> m_output;
+    /// Output trace, previous value and current value.
+    TracedCallback<Output_t, Output_t> m_outputChange;
+
+    /// The most recent value.
+    Value m_value;
+
+    /// The log component of the concrete probe type.
+    NS_LOG_TEMPLATE_DECLARE;
+
+}; // end of class TypedProbe
+
+// TYPED PROBE IMPLEMENTATION /////////////////////////////////////////////////
+
+template <typename Value, typename... Extra>
+TypedProbe<Value, Extra...>::TypedProbe(const std::string& logComponent)
+    : Probe(),
+      m_value(),
+      NS_LOG_TEMPLATE_DEFINE(logComponent)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+template <typename Value, typename... Extra>
+TypedProbe<Value, Extra...>::~TypedProbe()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+template <typename Value, typename... Extra>
+template <typename T>
+TypeId // static
+TypedProbe<Value, Extra...>::DeriveTypeId(std::string name,
+                                          std::string outputHelp,
+                                          std::string outputCallback)
+{
+    static_assert(sizeof...(Extra) == 0, "Probes with extra arguments have two trace sources");
+    return TypeId(name)
+        .SetParent<Probe>()
+        .AddConstructor<T>()
+        .AddTraceSource("Output",
+                        outputHelp,
+                        MakeTraceSourceAccessor(&TypedProbe::m_outputChange),
+                        outputCallback);
+}
+
+template <typename Value, typename... Extra>
+template <typename T>
+TypeId // static
+TypedProbe<Value, Extra...>::DeriveTypeId(std::string name,
+                                          std::string changeName,
+                                          std::string outputHelp,
+                                          std::string changeHelp,
+                                          std::string outputCallback,
+                                          std::string changeCallback)
+{
+    static_assert(sizeof...(Extra) > 0, "Probes without extra arguments have one trace source");
+    return TypeId(name)
+        .SetParent<Probe>()
+        .AddConstructor<T>()
+        .AddTraceSource("Output",
+                        outputHelp,
+                        MakeTraceSourceAccessor(&TypedProbe::m_output),
+                        outputCallback)
+        .AddTraceSource(changeName,
+                        changeHelp,
+                        MakeTraceSourceAccessor(&TypedProbe::m_outputChange),
+                        changeCallback);
+}
+
+template <typename Value, typename... Extra>
+Value
+TypedProbe<Value, Extra...>::GetValue() const
+{
+    return m_value;
+}
+
+template <typename Value, typename... Extra>
+void
+TypedProbe<Value, Extra...>::SetValue(Value value, Extra... extra)
+{
+    NS_LOG_FUNCTION(this << value);
+    Emit(value, extra...);
+}
+
+template <typename Value, typename... Extra>
+void // static
+TypedProbe<Value, Extra...>::SetValueByPath(std::string path, Value value, Extra... extra)
+{
+    Ptr<TypedProbe> probe = DynamicCast<TypedProbe>(Names::Find<Object>(path));
+    NS_ASSERT_MSG(probe, "Error:  Can't find probe for path " << path);
+    probe->SetValue(value, extra...);
+}
+
+template <typename Value, typename... Extra>
+bool
+TypedProbe<Value, Extra...>::ConnectByObject(std::string traceSource, Ptr<Object> obj)
+{
+    NS_LOG_FUNCTION(this << traceSource << obj);
+    NS_LOG_DEBUG("Name of probe (if any) in names database: " << Names::FindPath(obj));
+    return obj->TraceConnectWithoutContext(traceSource, MakeCallback(&TypedProbe::TraceSink, this));
+}
+
+template <typename Value, typename... Extra>
+void
+TypedProbe<Value, Extra...>::ConnectByPath(std::string path)
+{
+    NS_LOG_FUNCTION(this << path);
+    NS_LOG_DEBUG("Name of probe to search for in config database: " << path);
+    Config::ConnectWithoutContext(path, MakeCallback(&TypedProbe::TraceSink, this));
+}
+
+template <typename Value, typename... Extra>
+inline void
+TypedProbe<Value, Extra...>::TraceSink(Value value, Extra... extra)
+{
+    NS_LOG_FUNCTION(this << value);
+    if (IsEnabled())
+    {
+        Emit(value, extra...);
+    }
+}
+
+template <typename Value, typename... Extra>
+inline void
+TypedProbe<Value, Extra...>::Emit(Value value, Extra... extra)
+{
+    if (sizeof...(Extra) > 0)
+    {
+        m_output(value, extra...);
+    }
+
+    if (!m_outputChange.IsEmpty())
+    {
+        m_outputChange(TypedProbeTraits<Value>::Convert(m_value),
+                       TypedProbeTraits<Value>::Convert(value));
+    }
+
+    m_value = value;
+}
+
+} // namespace ns3
+
+#endif /* TYPED_PROBE_H */
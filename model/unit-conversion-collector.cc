@@ -21,13 +21,19 @@
 
 #include "unit-conversion-collector.h"
 
+#include "collector-state.h"
+#include "event-time-cache.h"
 #include "magister-stats.h"
+#include "memory-usage.h"
 
+#include "ns3/boolean.h"
 #include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 
 #include <cmath>
+#include <cstring>
+#include <limits>
 #include <string>
 
 NS_LOG_COMPONENT_DEFINE("UnitConversionCollector");
@@ -62,10 +68,164 @@ UnitConversionCollector::GetConversionTypeName(
     }
 }
 
+bool // static
+UnitConversionCollector::IsLinearConversion(
+    UnitConversionCollector::ConversionType_t conversionType)
+{
+    return (conversionType != UnitConversionCollector::FROM_LINEAR_TO_DB) &&
+           (conversionType != UnitConversionCollector::FROM_LINEAR_TO_DBM);
+}
+
+double // static
+UnitConversionCollector::GetConversionScale(
+    UnitConversionCollector::ConversionType_t conversionType)
+{
+    switch (conversionType)
+    {
+    case UnitConversionCollector::TRANSPARENT:
+        return 1.0;
+    case UnitConversionCollector::FROM_BYTES_TO_BIT:
+        return 8.0;
+    case UnitConversionCollector::FROM_BYTES_TO_KBIT:
+        return 8.0 * 1e-3;
+    case UnitConversionCollector::FROM_BYTES_TO_MBIT:
+        return 8.0 * 1e-6;
+    case UnitConversionCollector::FROM_SECONDS_TO_MS:
+        return 1000.0;
+    default:
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+std::string // static
+UnitConversionCollector::GetConversionUnitName(
+    UnitConversionCollector::ConversionType_t conversionType)
+{
+    switch (conversionType)
+    {
+    case UnitConversionCollector::FROM_BYTES_TO_BIT:
+        return "bit";
+    case UnitConversionCollector::FROM_BYTES_TO_KBIT:
+        return "kbit";
+    case UnitConversionCollector::FROM_BYTES_TO_MBIT:
+        return "Mbit";
+    case UnitConversionCollector::FROM_SECONDS_TO_MS:
+        return "ms";
+    case UnitConversionCollector::FROM_LINEAR_TO_DB:
+        return "dB";
+    case UnitConversionCollector::FROM_LINEAR_TO_DBM:
+        return "dBm";
+    default:
+        return "";
+    }
+}
+
+void // static
+UnitConversionCollector::ConvertBatch(UnitConversionCollector::ConversionType_t conversionType,
+                                      const double* input,
+                                      double* output,
+                                      uint32_t n,
+                                      bool isApproximate)
+{
+    NS_LOG_FUNCTION(GetConversionTypeName(conversionType) << n << isApproximate);
+
+    switch (conversionType)
+    {
+    case UnitConversionCollector::FROM_LINEAR_TO_DB:
+        if (isApproximate)
+        {
+            for (uint32_t i = 0; i < n; i++)
+            {
+                output[i] = 10.0 * ApproximateLog10(input[i]);
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0; i < n; i++)
+            {
+                NS_ASSERT_MSG(input[i] > 0.0,
+                              "Error converting non-positive value " << input[i]
+                                                                     << " to decibel unit");
+                output[i] = 10.0 * std::log10(input[i]);
+            }
+        }
+        break;
+
+    case UnitConversionCollector::FROM_LINEAR_TO_DBM:
+        if (isApproximate)
+        {
+            for (uint32_t i = 0; i < n; i++)
+            {
+                output[i] = 10.0 * ApproximateLog10(input[i]) + 30.0;
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0; i < n; i++)
+            {
+                NS_ASSERT_MSG(input[i] > 0.0,
+                              "Error converting non-positive value " << input[i]
+                                                                     << " to decibel unit");
+                output[i] = 10.0 * std::log10(1000.0 * input[i]);
+            }
+        }
+        break;
+
+    default: {
+        NS_ASSERT_MSG(IsLinearConversion(conversionType), "Invalid conversion type");
+        const double scale = GetConversionScale(conversionType);
+        for (uint32_t i = 0; i < n; i++)
+        {
+            output[i] = scale * input[i];
+        }
+        break;
+    }
+    }
+
+} // end of `void ConvertBatch (ConversionType_t, const double *, double *, uint32_t, bool);`
+
+double // static
+UnitConversionCollector::ApproximateLog10(double x)
+{
+    // The bit pattern of sqrt(0.5), and the exponent bias of IEEE 754.
+    const uint64_t offset = 0x3FE6A09E667F3BCDULL;
+    const uint64_t bias = 0x3FFULL << 52;
+
+    uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+
+    // Split x into 2^k * m, where m is within [sqrt(0.5), sqrt(2)). The biased
+    // exponent of the split is within [0, 2047] for normal inputs, so a logical
+    // shift is enough and it is converted into double by placing it in the
+    // mantissa of 2^52. Unlike an arithmetic 64-bit shift and an integer
+    // conversion, both map to SSE2 instructions, so the loops of
+    // ConvertBatch() vectorize without AVX-512.
+    const uint64_t biasedK = (bits + bias - offset) >> 52;
+    const uint64_t kBits = biasedK | 0x4330000000000000ULL;
+    double k;
+    std::memcpy(&k, &kBits, sizeof(k));
+    k -= 4503599627370496.0 + 1023.0; // 2^52 + the bias
+    const uint64_t mantissaBits = bits - ((biasedK - 0x3FFULL) << 52);
+    double m;
+    std::memcpy(&m, &mantissaBits, sizeof(m));
+
+    // ln (m) = 2 atanh (t), where |t| <= 0.1716.
+    const double t = (m - 1.0) / (m + 1.0);
+    const double t2 = t * t;
+    const double lnM =
+        2.0 * t *
+        (1.0 + t2 * (1.0 / 3.0 + t2 * (1.0 / 5.0 + t2 * (1.0 / 7.0 + t2 * (1.0 / 9.0)))));
+
+    return k * 0.30102999566398119521 + lnM * 0.43429448190325182765;
+}
+
 UnitConversionCollector::UnitConversionCollector()
     : m_isFirstSample(true),
+      m_isConversionDeferred(false),
       m_conversionType(UnitConversionCollector::TRANSPARENT),
-      m_timeUnit(Time::S)
+      m_timeUnit(Time::S),
+      m_deferLinearConversion(false),
+      m_approximateLogarithm(false)
 {
     NS_LOG_FUNCTION(this << GetName());
 }
@@ -126,6 +286,25 @@ UnitConversionCollector::GetTypeId()
                                           "FS", // femtosecond
                                           Time::LAST,
                                           "LAST"))
+            .AddAttribute("DeferLinearConversion",
+                          "If true and the conversion type is linear, the input "
+                          "samples are emitted unchanged, and the downstream "
+                          "collector is expected to apply the conversion factor "
+                          "to its output instead (e.g., through its `Scale` "
+                          "attribute). Non-linear conversions are never deferred.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&UnitConversionCollector::SetDeferLinearConversion,
+                                              &UnitConversionCollector::IsDeferLinearConversion),
+                          MakeBooleanChecker())
+            .AddAttribute("ApproximateLogarithm",
+                          "If true, the batch conversion API (ConvertBatch) uses a "
+                          "polynomial approximation of the logarithm for the dB and "
+                          "dBm conversions, with an absolute error below 4e-9 dB. "
+                          "Otherwise, the exact logarithm is used.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&UnitConversionCollector::SetApproximateLogarithm,
+                                              &UnitConversionCollector::IsApproximateLogarithm),
+                          MakeBooleanChecker())
             .AddTraceSource("Output",
                             "The result traced value (old and new values) of the "
                             "conversion of an input sample.",
@@ -155,6 +334,7 @@ UnitConversionCollector::SetConversionType(UnitConversionCollector::ConversionTy
 {
     NS_LOG_FUNCTION(this << GetName() << GetConversionTypeName(conversionType));
     m_conversionType = conversionType;
+    m_isConversionDeferred = m_deferLinearConversion && IsLinearConversion(m_conversionType);
 }
 
 UnitConversionCollector::ConversionType_t
@@ -176,10 +356,88 @@ UnitConversionCollector::GetTimeUnit() const
     return m_timeUnit;
 }
 
+void
+UnitConversionCollector::SetDeferLinearConversion(bool deferLinearConversion)
+{
+    NS_LOG_FUNCTION(this << GetName() << deferLinearConversion);
+    m_deferLinearConversion = deferLinearConversion;
+    m_isConversionDeferred = m_deferLinearConversion && IsLinearConversion(m_conversionType);
+}
+
+bool
+UnitConversionCollector::IsDeferLinearConversion() const
+{
+    return m_deferLinearConversion;
+}
+
+void
+UnitConversionCollector::SetApproximateLogarithm(bool approximateLogarithm)
+{
+    NS_LOG_FUNCTION(this << GetName() << approximateLogarithm);
+    m_approximateLogarithm = approximateLogarithm;
+}
+
+bool
+UnitConversionCollector::IsApproximateLogarithm() const
+{
+    return m_approximateLogarithm;
+}
+
+void
+UnitConversionCollector::ConvertBatch(const double* input, double* output, uint32_t n) const
+{
+    ConvertBatch(m_conversionType, input, output, n, m_approximateLogarithm);
+}
+
+bool
+UnitConversionCollector::IsLinearConversion() const
+{
+    return IsLinearConversion(m_conversionType);
+}
+
+double
+UnitConversionCollector::GetConversionScale() const
+{
+    return GetConversionScale(m_conversionType);
+}
+
+std::string
+UnitConversionCollector::GetConversionUnitName() const
+{
+    return GetConversionUnitName(m_conversionType);
+}
+
+uint64_t
+UnitConversionCollector::GetMemoryUsage() const
+{
+    return sizeof(UnitConversionCollector);
+}
+
+uint32_t
+UnitConversionCollector::GetSerializedStateSize() const
+{
+    return 1;
+}
+
+void
+UnitConversionCollector::SerializeState(Buffer::Iterator start) const
+{
+    start.WriteU8(m_isFirstSample ? 1 : 0);
+}
+
+uint32_t
+UnitConversionCollector::DeserializeState(Buffer::Iterator start)
+{
+    NS_LOG_FUNCTION(this << GetName());
+    m_isFirstSample = (start.ReadU8() != 0);
+    return 1;
+}
+
 void
 UnitConversionCollector::TraceSinkDouble(double oldData, double newData)
 {
     NS_LOG_FUNCTION(this << GetName() << newData);
+    StatsProfiler::Scope profileScope(m_profile.Get("UnitConversionCollector", this));
 
     if (m_isFirstSample)
     {
@@ -189,11 +447,12 @@ UnitConversionCollector::TraceSinkDouble(double oldData, double newData)
 
     if (IsEnabled())
     {
-        const double convertedOldData = Convert(oldData);
-        const double convertedNewData = Convert(newData);
+        // A deferred conversion is applied by the downstream collector.
+        const double convertedOldData = m_isConversionDeferred ? oldData : Convert(oldData);
+        const double convertedNewData = m_isConversionDeferred ? newData : Convert(newData);
         m_output(convertedOldData, convertedNewData);
         m_outputValue(convertedNewData);
-        m_outputTimeValue(Simulator::Now().ToDouble(m_timeUnit), convertedNewData);
+        m_outputTimeValue(EventTimeCache::GetNow(m_timeUnit), convertedNewData);
     }
 }
 
@@ -0,0 +1,260 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+/**
+ * @file address-identifier-map-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for AddressIdentifierMap.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=address-identifier-map
+ * @endcode
+ */
+
+#include "ns3/address-identifier-map.h"
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("AddressIdentifierMapTest");
+
+namespace ns3
+{
+
+/**
+ * @param i an arbitrary number.
+ * @param type the address type.
+ * @return an address of a made-up type, unique for each number.
+ */
+static Address
+CreateTestAddress(uint32_t i, uint8_t type = 200)
+{
+    const uint8_t buffer[4] = {static_cast<uint8_t>(i >> 24),
+                               static_cast<uint8_t>(i >> 16),
+                               static_cast<uint8_t>(i >> 8),
+                               static_cast<uint8_t>(i)};
+    return Address(type, buffer, 4);
+}
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `address-identifier-map` test suite. Inserts addresses whose
+ * hashes fall into the same slot of the initial table, and verifies that each
+ * of them, and none of the others, is found through the linear probing.
+ */
+class AddressIdentifierMapCollisionTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    AddressIdentifierMapCollisionTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class AddressIdentifierMapCollisionTestCase`
+
+AddressIdentifierMapCollisionTestCase::AddressIdentifierMapCollisionTestCase()
+    : TestCase("address-identifier-map-collision")
+{
+}
+
+void
+AddressIdentifierMapCollisionTestCase::DoRun()
+{
+    // Pick four addresses in the same slot of the initial table of 16 entries.
+    std::vector<Address> colliding;
+    const uint64_t slot = AddressIdentifierMap::GetHash(CreateTestAddress(0)) & 15;
+    for (uint32_t i = 0; colliding.size() < 4; i++)
+    {
+        const Address address = CreateTestAddress(i);
+        if ((AddressIdentifierMap::GetHash(address) & 15) == slot)
+        {
+            colliding.push_back(address);
+        }
+    }
+
+    // The same bytes with another type is another address.
+    const Address otherType = CreateTestAddress(0, 201);
+    NS_TEST_ASSERT_MSG_NE(AddressIdentifierMap::GetHash(otherType),
+                          AddressIdentifierMap::GetHash(colliding[0]),
+                          "the type is hashed");
+
+    AddressIdentifierMap m;
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        m.Insert(colliding[i], 10 + i);
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(m.GetSize(), 3, "size");
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m.Find(colliding[i]), 10 + i, "colliding address " << i);
+    }
+    NS_TEST_ASSERT_MSG_EQ(m.Find(colliding[3]),
+                          AddressIdentifierMap::NOT_FOUND,
+                          "colliding address which is not inserted");
+    NS_TEST_ASSERT_MSG_EQ(m.Find(otherType),
+                          AddressIdentifierMap::NOT_FOUND,
+                          "address of another type");
+    NS_TEST_ASSERT_MSG_EQ(m.Find(Address()),
+                          AddressIdentifierMap::NOT_FOUND,
+                          "invalid address");
+
+} // end of `void DoRun ()`
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `address-identifier-map` test suite. Inserts enough addresses
+ * to double the table several times, and verifies that every address is
+ * found after the rehashing.
+ */
+class AddressIdentifierMapGrowTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    AddressIdentifierMapGrowTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class AddressIdentifierMapGrowTestCase`
+
+AddressIdentifierMapGrowTestCase::AddressIdentifierMapGrowTestCase()
+    : TestCase("address-identifier-map-grow")
+{
+}
+
+void
+AddressIdentifierMapGrowTestCase::DoRun()
+{
+    const uint32_t n = 1000;
+    AddressIdentifierMap m;
+    const uint64_t initialUsage = m.GetMemoryUsage();
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        m.Insert(CreateTestAddress(i), i);
+
+        // The first address is found while the table grows.
+        NS_TEST_ASSERT_MSG_EQ(m.Find(CreateTestAddress(0)), 0, "after " << i + 1 << " insertions");
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(m.GetSize(), n, "size");
+    NS_TEST_ASSERT_MSG_GT(m.GetMemoryUsage(), initialUsage, "the table has grown");
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m.Find(CreateTestAddress(i)), i, "address " << i);
+    }
+    NS_TEST_ASSERT_MSG_EQ(m.Find(CreateTestAddress(n)),
+                          AddressIdentifierMap::NOT_FOUND,
+                          "address which is not inserted");
+
+} // end of `void DoRun ()`
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `address-identifier-map` test suite. Replaces the identifier of
+ * an existing address through Insert() and operator[](), and clears the map,
+ * verifying that the result cached by Find() is never returned afterwards.
+ */
+class AddressIdentifierMapReplaceTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    AddressIdentifierMapReplaceTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class AddressIdentifierMapReplaceTestCase`
+
+AddressIdentifierMapReplaceTestCase::AddressIdentifierMapReplaceTestCase()
+    : TestCase("address-identifier-map-replace")
+{
+}
+
+void
+AddressIdentifierMapReplaceTestCase::DoRun()
+{
+    const Address a = CreateTestAddress(1);
+    const Address b = CreateTestAddress(2);
+    AddressIdentifierMap m;
+
+    m.Insert(a, 1);
+    m.Insert(b, 2);
+    NS_TEST_ASSERT_MSG_EQ(m.Find(a), 1, "first insertion");
+
+    // The latest result of Find() is cached, and must not outlive a replacement.
+    m.Insert(a, 3);
+    NS_TEST_ASSERT_MSG_EQ(m.GetSize(), 2, "size after replacing");
+    NS_TEST_ASSERT_MSG_EQ(m.Find(a), 3, "replaced by Insert()");
+    m[a] = 4;
+    NS_TEST_ASSERT_MSG_EQ(m.Find(a), 4, "replaced by operator[]");
+    NS_TEST_ASSERT_MSG_EQ(m.Find(b), 2, "the other address");
+    NS_TEST_ASSERT_MSG_EQ(m.GetSize(), 2, "size after operator[]");
+
+    // Like std::map, operator[] inserts a missing address with identifier 0.
+    const Address c = CreateTestAddress(3);
+    NS_TEST_ASSERT_MSG_EQ(m[c], 0, "default identifier");
+    NS_TEST_ASSERT_MSG_EQ(m.Find(c), 0, "inserted by operator[]");
+    NS_TEST_ASSERT_MSG_EQ(m.GetSize(), 3, "size after inserting by operator[]");
+
+    NS_TEST_ASSERT_MSG_EQ(m.Find(a), 4, "cached before clearing");
+    m.Clear();
+    NS_TEST_ASSERT_MSG_EQ(m.GetSize(), 0, "size after clearing");
+    NS_TEST_ASSERT_MSG_EQ(m.Find(a), AddressIdentifierMap::NOT_FOUND, "cleared");
+    NS_TEST_ASSERT_MSG_EQ(m.Find(b), AddressIdentifierMap::NOT_FOUND, "cleared");
+
+    m.Insert(a, 5);
+    NS_TEST_ASSERT_MSG_EQ(m.Find(a), 5, "inserted after clearing");
+
+} // end of `void DoRun ()`
+
+/**
+ * @brief Test suite `address-identifier-map`, verifying the
+ *        AddressIdentifierMap class.
+ */
+class AddressIdentifierMapTestSuite : public TestSuite
+{
+  public:
+    AddressIdentifierMapTestSuite();
+};
+
+AddressIdentifierMapTestSuite::AddressIdentifierMapTestSuite()
+    : TestSuite("address-identifier-map", Type::UNIT)
+{
+    AddTestCase(new AddressIdentifierMapCollisionTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new AddressIdentifierMapGrowTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new AddressIdentifierMapReplaceTestCase(), TestCase::Duration::QUICK);
+
+} // end of `AddressIdentifierMapTestSuite ()`
+
+static AddressIdentifierMapTestSuite g_addressIdentifierMapTestSuiteInstance;
+
+} // end of namespace ns3
@@ -0,0 +1,258 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+/**
+ * @file batch-means-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for BatchMeans.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=batch-means
+ * @endcode
+ */
+
+#include "ns3/batch-means.h"
+#include "ns3/core-module.h"
+
+NS_LOG_COMPONENT_DEFINE("BatchMeansTest");
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `batch-means` test suite. Feeds the samples 1, 2, 3, ... to an
+ * estimator with 4 batches and verifies the batch size, the number of
+ * complete batches, and the estimate before and after the batches are merged.
+ */
+class BatchMeansMergeTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    BatchMeansMergeTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class BatchMeansMergeTestCase`
+
+BatchMeansMergeTestCase::BatchMeansMergeTestCase()
+    : TestCase("batch-means-merge")
+{
+}
+
+void
+BatchMeansMergeTestCase::DoRun()
+{
+    BatchMeans batchMeans;
+    batchMeans.SetNumOfBatches(4);
+
+    // Batches of 1 sample: {1}, {2}, {3}, {4}.
+    for (uint32_t i = 1; i <= 4; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(batchMeans.AddSample(i), true, "Sample must complete a batch");
+    }
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetNumOfCompleteBatches(), 4, "Wrong number of batches");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetBatchSize(), 1, "Wrong batch size");
+    NS_TEST_ASSERT_MSG_EQ_TOL(batchMeans.GetMean(), 2.5, 1e-12, "Wrong mean");
+
+    // The 5th sample merges the batches into {1, 2} and {3, 4}, and starts a
+    // batch of 2 samples.
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.AddSample(5), false, "Sample must not complete a batch");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetNumOfCompleteBatches(), 2, "Wrong number of batches");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetBatchSize(), 2, "Wrong batch size");
+    NS_TEST_ASSERT_MSG_EQ_TOL(batchMeans.GetMean(), 2.5, 1e-12, "Wrong mean");
+
+    for (uint32_t i = 6; i <= 8; i++)
+    {
+        batchMeans.AddSample(i);
+    }
+
+    // Batch means 1.5, 3.5, 5.5, 7.5 with a sample standard deviation of
+    // sqrt(20/3), and t(0.975, 3) = 3.1824.
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetNumOfCompleteBatches(), 4, "Wrong number of batches");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetNumOfSamples(), 8, "Wrong number of samples");
+    NS_TEST_ASSERT_MSG_EQ_TOL(batchMeans.GetMean(), 4.5, 1e-12, "Wrong mean");
+    NS_TEST_ASSERT_MSG_EQ_TOL(batchMeans.GetHalfWidth(),
+                              3.1824 * std::sqrt(20.0 / 3.0) / 2.0,
+                              0.01,
+                              "Wrong half-width");
+
+    // The batches are merged again only when the 10th sample fills the
+    // current batch; the samples 9 to 12 form one batch of 4 samples.
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.AddSample(9), false, "Sample must not complete a batch");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetBatchSize(), 2, "Wrong batch size");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.AddSample(10), false, "Sample must not complete a batch");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetBatchSize(), 4, "Wrong batch size");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.AddSample(11), false, "Sample must not complete a batch");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.AddSample(12), true, "Sample must complete a batch");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetNumOfCompleteBatches(), 3, "Wrong number of batches");
+    NS_TEST_ASSERT_MSG_EQ_TOL(batchMeans.GetMean(), 6.5, 1e-12, "Wrong mean");
+
+    // Less than 2 batches.
+    batchMeans.Reset();
+    batchMeans.AddSample(1.0);
+    NS_TEST_ASSERT_MSG_EQ(std::isnan(batchMeans.GetMean()), true, "Mean must be NaN");
+    NS_TEST_ASSERT_MSG_EQ(std::isnan(batchMeans.GetHalfWidth()), true, "Half-width must be NaN");
+}
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `batch-means` test suite. Feeds 2 batches of a transient
+ * followed by 8 batches alternating between two levels, and verifies that
+ * MSER-5 truncates exactly the transient.
+ */
+class BatchMeansTruncationTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    BatchMeansTruncationTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class BatchMeansTruncationTestCase`
+
+BatchMeansTruncationTestCase::BatchMeansTruncationTestCase()
+    : TestCase("batch-means-mser-5")
+{
+}
+
+void
+BatchMeansTruncationTestCase::DoRun()
+{
+    BatchMeans batchMeans;
+    batchMeans.SetTruncationEnabled(true);
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetBatchSize(), 5, "MSER-5 must start with 5 samples");
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        batchMeans.AddSample(100.0);
+    }
+    for (uint32_t b = 0; b < 8; b++)
+    {
+        for (uint32_t i = 0; i < 5; i++)
+        {
+            batchMeans.AddSample((b % 2 == 0) ? 1.0 : 2.0);
+        }
+    }
+
+    // The remaining batch means 1, 2, 1, 2, ... have a sample standard
+    // deviation of sqrt(2/7), and t(0.975, 7) = 2.3646.
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetNumOfCompleteBatches(), 10, "Wrong number of batches");
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetNumOfTruncatedBatches(), 2, "Wrong truncation point");
+    NS_TEST_ASSERT_MSG_EQ_TOL(batchMeans.GetMean(), 1.5, 1e-12, "Wrong mean");
+    NS_TEST_ASSERT_MSG_EQ_TOL(batchMeans.GetHalfWidth(),
+                              2.3646 * std::sqrt(2.0 / 7.0) / std::sqrt(8.0),
+                              0.001,
+                              "Wrong half-width");
+
+    // Nothing is truncated when the truncation is disabled.
+    batchMeans.SetTruncationEnabled(false);
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        batchMeans.AddSample(100.0);
+    }
+    NS_TEST_ASSERT_MSG_EQ(batchMeans.GetNumOfTruncatedBatches(), 0, "Unexpected truncation");
+}
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `batch-means` test suite. Verifies the quantile of the
+ * Student's t distribution against a table of two-sided critical values.
+ */
+class BatchMeansStudentTTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    BatchMeansStudentTTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class BatchMeansStudentTTestCase`
+
+BatchMeansStudentTTestCase::BatchMeansStudentTTestCase()
+    : TestCase("batch-means-student-t")
+{
+}
+
+void
+BatchMeansStudentTTestCase::DoRun()
+{
+    // Closed forms.
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.975, 1), 12.7062, 1e-4, "df 1");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.95, 1), 6.3138, 1e-4, "df 1");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.975, 2), 4.3027, 1e-4, "df 2");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.95, 2), 2.9200, 1e-4, "df 2");
+
+    // Cornish-Fisher expansion, within the documented error of 0.01.
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.975, 3), 3.1824, 0.01, "df 3");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.995, 3), 5.8409, 0.1, "df 3");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.95, 4), 2.1318, 0.01, "df 4");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.975, 5), 2.5706, 0.01, "df 5");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.975, 10), 2.2281, 1e-3, "df 10");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.95, 20), 1.7247, 1e-3, "df 20");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.975, 30), 2.0423, 1e-3, "df 30");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.975, 100),
+                              1.9840,
+                              1e-3,
+                              "df 100");
+
+    // Symmetry around the median.
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetStudentTQuantile(0.025, 10),
+                              -BatchMeans::GetStudentTQuantile(0.975, 10),
+                              1e-9,
+                              "Quantile must be symmetric");
+
+    // The normal distribution is the limit.
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetNormalQuantile(0.975), 1.959964, 1e-6, "z 0.975");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetNormalQuantile(0.01), -2.326348, 1e-6, "z 0.01");
+    NS_TEST_ASSERT_MSG_EQ_TOL(BatchMeans::GetNormalQuantile(0.5), 0.0, 1e-9, "z 0.5");
+}
+
+/**
+ * @brief Test suite `batch-means`, verifying the BatchMeans class.
+ */
+class BatchMeansTestSuite : public TestSuite
+{
+  public:
+    BatchMeansTestSuite();
+};
+
+BatchMeansTestSuite::BatchMeansTestSuite()
+    : TestSuite("batch-means", Type::UNIT)
+{
+    AddTestCase(new BatchMeansMergeTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new BatchMeansTruncationTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new BatchMeansStudentTTestCase(), TestCase::Duration::QUICK);
+
+} // end of `BatchMeansTestSuite ()`
+
+static BatchMeansTestSuite g_batchMeansTestSuiteInstance;
+
+} // end of namespace ns3
@@ -0,0 +1,230 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * @file collector-bank-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for CollectorBank.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=collector-bank
+ * @endcode
+ */
+
+#include "ns3/collector-bank.h"
+#include "ns3/collector-map.h"
+#include "ns3/core-module.h"
+#include "ns3/scalar-collector.h"
+
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("CollectorBankTest");
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `collector-bank` test suite. Feeds the same samples to a
+ * CollectorBank and to a CollectorMap of ScalarCollector instances named
+ * after the identifiers, both with the same output type and `Scale`, and
+ * verifies that the bank emits the same context names and output values, in
+ * the same order. The identifiers cover several samples, a single sample
+ * (i.e., a zero duration), and no sample at all.
+ */
+class CollectorBankTestCase : public TestCase
+{
+  public:
+    /**
+     * @brief Construct a new test case.
+     * @param outputType the output type of both the bank and the collectors.
+     */
+    CollectorBankTestCase(ScalarCollector::OutputType_t outputType);
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    /**
+     * @brief Pass a sample of an identifier to the bank and to the map.
+     * @param identifier the identifier.
+     * @param value the sample.
+     */
+    void Feed(uint32_t identifier, double value);
+
+    /**
+     * @brief Trace sink for the `Output` trace source of the bank.
+     * @param context the name of the identifier.
+     * @param value the output of the identifier.
+     */
+    void BankOutputCallback(std::string context, double value);
+
+    /**
+     * @brief Trace sink for the `Output` trace source of the collectors in
+     *        the map, connected with the name of the collector as context.
+     * @param context the name of the collector.
+     * @param value the output of the collector.
+     */
+    void MapOutputCallback(std::string context, double value);
+
+    ScalarCollector::OutputType_t m_outputType; ///< The output type.
+    CollectorMap m_map;                         ///< The collectors of the reference.
+
+    /// The trace sinks of the bank, one per identifier.
+    std::vector<Callback<void, double, double>> m_bankSinks;
+
+    /// The context names and the output values of the bank.
+    std::vector<std::pair<std::string, double>> m_bankOutput;
+
+    /// The context names and the output values of the map.
+    std::vector<std::pair<std::string, double>> m_mapOutput;
+
+}; // end of `class CollectorBankTestCase`
+
+CollectorBankTestCase::CollectorBankTestCase(ScalarCollector::OutputType_t outputType)
+    : TestCase("collector-bank-" + ScalarCollector::GetOutputTypeName(outputType)),
+      m_outputType(outputType)
+{
+}
+
+void
+CollectorBankTestCase::Feed(uint32_t identifier, double value)
+{
+    m_bankSinks[identifier](0.0, value);
+    m_map.Get(identifier)->GetObject<ScalarCollector>()->TraceSinkDouble(0.0, value);
+}
+
+void
+CollectorBankTestCase::BankOutputCallback(std::string context, double value)
+{
+    m_bankOutput.push_back(std::make_pair(context, value));
+}
+
+void
+CollectorBankTestCase::MapOutputCallback(std::string context, double value)
+{
+    m_mapOutput.push_back(std::make_pair(context, value));
+}
+
+void
+CollectorBankTestCase::DoRun()
+{
+    const double scale = 8.0; // e.g., a deferred conversion from bytes to bits
+    const std::string names[] = {"1", "2", "3"};
+
+    Ptr<CollectorBank> bank = CreateObject<CollectorBank>();
+    bank->SetOutputType(m_outputType);
+    bank->SetScale(scale);
+    bank->TraceConnectWithoutContext(
+        "Output",
+        MakeCallback(&CollectorBankTestCase::BankOutputCallback, this));
+
+    m_map.SetType("ns3::ScalarCollector");
+    m_map.SetAttribute("InputDataType", EnumValue(ScalarCollector::INPUT_DATA_TYPE_DOUBLE));
+    m_map.SetAttribute("OutputType", EnumValue(m_outputType));
+    m_map.SetAttribute("Scale", DoubleValue(scale));
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        // The same naming as StatsHelper::CreateCollectorPerIdentifier().
+        m_map.SetAttribute("Name", StringValue(names[i]));
+        m_map.Create(i);
+        m_map.Get(i)->TraceConnect("Output",
+                                   names[i],
+                                   MakeCallback(&CollectorBankTestCase::MapOutputCallback, this));
+
+        NS_TEST_ASSERT_MSG_EQ(bank->AddIdentifier(names[i]), i, "Wrong index of identifier");
+        m_bankSinks.push_back(bank->GetTraceSinkDouble(i));
+    }
+
+    // Identifier 0 has several samples, identifier 1 a single one, and
+    // identifier 2 none.
+    Simulator::Schedule(Seconds(1.5), &CollectorBankTestCase::Feed, this, 0, 100.0);
+    Simulator::Schedule(Seconds(2.5), &CollectorBankTestCase::Feed, this, 0, 300.0);
+    Simulator::Schedule(Seconds(3.0), &CollectorBankTestCase::Feed, this, 1, 40.0);
+    Simulator::Schedule(Seconds(4.0), &CollectorBankTestCase::Feed, this, 0, 50.0);
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(bank->GetNumOfSamples(0), 3, "Wrong number of samples");
+    NS_TEST_ASSERT_MSG_EQ(bank->GetNumOfSamples(2), 0, "Wrong number of samples");
+
+    bank->Dispose();
+    for (CollectorMap::Iterator it = m_map.Begin(); it != m_map.End(); ++it)
+    {
+        it->second->Dispose();
+    }
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(m_bankOutput.size(), 3, "Wrong number of outputs of the bank");
+    NS_TEST_ASSERT_MSG_EQ(m_mapOutput.size(), 3, "Wrong number of outputs of the map");
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_bankOutput[i].first,
+                              m_mapOutput[i].first,
+                              "Wrong context name of output " << i);
+        if (std::isnan(m_mapOutput[i].second))
+        {
+            NS_TEST_ASSERT_MSG_EQ(std::isnan(m_bankOutput[i].second),
+                                  true,
+                                  "Expected nan for " << m_mapOutput[i].first);
+        }
+        else
+        {
+            NS_TEST_ASSERT_MSG_EQ_TOL(m_bankOutput[i].second,
+                                      m_mapOutput[i].second,
+                                      1e-9,
+                                      "Wrong output of " << m_mapOutput[i].first);
+        }
+    }
+}
+
+/**
+ * @brief Test suite `collector-bank`, verifying the CollectorBank class.
+ */
+class CollectorBankTestSuite : public TestSuite
+{
+  public:
+    CollectorBankTestSuite();
+};
+
+CollectorBankTestSuite::CollectorBankTestSuite()
+    : TestSuite("collector-bank", Type::UNIT)
+{
+    // LogComponentEnable ("CollectorBankTest", LOG_LEVEL_ALL);
+    // LogComponentEnable ("CollectorBank", LOG_LEVEL_ALL);
+
+    AddTestCase(new CollectorBankTestCase(ScalarCollector::OUTPUT_TYPE_SUM),
+                TestCase::Duration::QUICK);
+    AddTestCase(new CollectorBankTestCase(ScalarCollector::OUTPUT_TYPE_NUMBER_OF_SAMPLE),
+                TestCase::Duration::QUICK);
+    AddTestCase(new CollectorBankTestCase(ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SAMPLE),
+                TestCase::Duration::QUICK);
+    AddTestCase(new CollectorBankTestCase(ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND),
+                TestCase::Duration::QUICK);
+
+} // end of `CollectorBankTestSuite ()`
+
+static CollectorBankTestSuite g_collectorBankTestSuiteInstance;
+
+} // end of namespace ns3
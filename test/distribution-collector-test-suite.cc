@@ -30,6 +30,7 @@
  * @endcode
  */
 
+#include "ns3/buffer.h"
 #include "ns3/core-module.h"
 #include "ns3/distribution-collector.h"
 
@@ -377,6 +378,190 @@ DistributionCollectorTestCase::CollectorOutputSqrSumCallback(double sqrSum)
     NS_LOG_FUNCTION(this << GetName() << sqrSum);
 }
 
+/**
+ * @ingroup stats
+ *
+ * Part of the `distribution-collector` test suite. Feeds the first half of the
+ * input samples to a DistributionCollector, restores its saved state into a
+ * new instance, and feeds the second half to the new instance. Then verifies
+ * that the output of the new instance, including its count, mean and
+ * variance, is the same as the output of a third instance which received all
+ * the input samples.
+ */
+class DistributionCollectorStateTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    DistributionCollectorStateTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    /**
+     * @return a collector with adaptive bins, settled after 10 samples.
+     */
+    Ptr<DistributionCollector> CreateCollector() const;
+
+    /**
+     * @brief Trace sink for the `Output` trace source of the collectors.
+     * @param output the list to append the output to.
+     * @param sample the center of a bin.
+     * @param count the number of samples in the bin.
+     */
+    static void OutputCallback(std::list<double>* output, double sample, double count);
+
+    /**
+     * @brief Trace sink for the `OutputCount` trace source of the collectors.
+     * @param output the list to append the output to.
+     * @param count the number of samples.
+     */
+    static void CountCallback(std::list<double>* output, uint32_t count);
+
+    /**
+     * @brief Trace sink for the `OutputMean` and `OutputVariance` trace
+     *        sources of the collectors.
+     * @param output the list to append the output to.
+     * @param value the mean or the variance of the samples.
+     */
+    static void MomentCallback(std::list<double>* output, double value);
+
+    /**
+     * @brief Connect the trace sinks of this test case to a collector.
+     * @param collector the collector.
+     * @param output the list to append the output of the collector to.
+     */
+    static void ConnectOutput(Ptr<DistributionCollector> collector, std::list<double>* output);
+
+}; // end of `class DistributionCollectorStateTestCase`
+
+DistributionCollectorStateTestCase::DistributionCollectorStateTestCase()
+    : TestCase("d-5-restored-state")
+{
+}
+
+Ptr<DistributionCollector>
+DistributionCollectorStateTestCase::CreateCollector() const
+{
+    Ptr<DistributionCollector> collector = CreateObject<DistributionCollector>();
+    collector->SetOutputType(DistributionCollector::OUTPUT_TYPE_HISTOGRAM);
+    collector->SetNumOfBins(8);
+    collector->InitializeBins();
+    PointerValue bins;
+    collector->GetAttribute("Bins", bins);
+    bins.Get<AdaptiveBins>()->SetAttribute("SettlingSamples", UintegerValue(10));
+    return collector;
+}
+
+void // static
+DistributionCollectorStateTestCase::OutputCallback(std::list<double>* output,
+                                                   double sample,
+                                                   double count)
+{
+    output->push_back(sample);
+    output->push_back(count);
+}
+
+void // static
+DistributionCollectorStateTestCase::CountCallback(std::list<double>* output, uint32_t count)
+{
+    output->push_back(count);
+}
+
+void // static
+DistributionCollectorStateTestCase::MomentCallback(std::list<double>* output, double value)
+{
+    output->push_back(value);
+}
+
+void // static
+DistributionCollectorStateTestCase::ConnectOutput(Ptr<DistributionCollector> collector,
+                                                  std::list<double>* output)
+{
+    collector->TraceConnectWithoutContext(
+        "Output",
+        MakeBoundCallback(&DistributionCollectorStateTestCase::OutputCallback, output));
+    collector->TraceConnectWithoutContext(
+        "OutputCount",
+        MakeBoundCallback(&DistributionCollectorStateTestCase::CountCallback, output));
+    collector->TraceConnectWithoutContext(
+        "OutputMean",
+        MakeBoundCallback(&DistributionCollectorStateTestCase::MomentCallback, output));
+    collector->TraceConnectWithoutContext(
+        "OutputVariance",
+        MakeBoundCallback(&DistributionCollectorStateTestCase::MomentCallback, output));
+}
+
+void
+DistributionCollectorStateTestCase::DoRun()
+{
+    Ptr<DistributionCollector> original = CreateCollector();
+    Ptr<DistributionCollector> restored = CreateCollector();
+    Ptr<DistributionCollector> reference = CreateCollector();
+
+    // The state is saved before the bins are settled.
+    const uint32_t numOfSamples = 30;
+    for (uint32_t i = 0; i < numOfSamples / 5; i++)
+    {
+        original->TraceSinkDouble1((i * 37) % 23);
+    }
+
+    Buffer buffer;
+    buffer.AddAtStart(original->GetSerializedStateSize());
+    original->SerializeState(buffer.Begin());
+    NS_TEST_ASSERT_MSG_EQ(restored->DeserializeState(buffer.Begin()),
+                          buffer.GetSize(),
+                          "Inconsistent size of the saved state");
+
+    for (uint32_t i = 0; i < numOfSamples; i++)
+    {
+        if (i >= numOfSamples / 5)
+        {
+            restored->TraceSinkDouble1((i * 37) % 23);
+        }
+        reference->TraceSinkDouble1((i * 37) % 23);
+    }
+
+    std::list<double> restoredOutput;
+    std::list<double> referenceOutput;
+    ConnectOutput(restored, &restoredOutput);
+    ConnectOutput(reference, &referenceOutput);
+    restored->Dispose();
+    reference->Dispose();
+    original->Dispose();
+
+    NS_TEST_ASSERT_MSG_EQ(restoredOutput.size(), referenceOutput.size(), "Inconsistent output");
+    NS_TEST_ASSERT_MSG_EQ((restoredOutput == referenceOutput), true, "Inconsistent output");
+
+    // The count, the mean and the variance are the last values of the output.
+    NS_TEST_ASSERT_MSG_GT(restoredOutput.size(), 3, "Missing count, mean and variance");
+    std::list<double>::const_reverse_iterator it = restoredOutput.rbegin();
+    const double variance = *it++;
+    const double mean = *it++;
+    const double count = *it++;
+    double expectedMean = 0.0;
+    for (uint32_t i = 0; i < numOfSamples; i++)
+    {
+        expectedMean += ((i * 37) % 23) / static_cast<double>(numOfSamples);
+    }
+    double expectedVariance = 0.0;
+    for (uint32_t i = 0; i < numOfSamples; i++)
+    {
+        const double deviation = ((i * 37) % 23) - expectedMean;
+        expectedVariance += deviation * deviation / (numOfSamples - 1);
+    }
+    NS_TEST_ASSERT_MSG_EQ(count, numOfSamples, "Inconsistent count of the restored collector");
+    NS_TEST_ASSERT_MSG_EQ_TOL(mean,
+                              expectedMean,
+                              1e-9,
+                              "Inconsistent mean of the restored collector");
+    NS_TEST_ASSERT_MSG_EQ_TOL(variance,
+                              expectedVariance,
+                              1e-9,
+                              "Inconsistent variance of the restored collector");
+    Simulator::Destroy();
+}
+
 /**
  * @brief Test suite `distribution-collector`, verifying the
  *        DistributionCollector class.
@@ -471,6 +656,8 @@ DistributionCollectorTestSuite::DistributionCollectorTestSuite()
                     "-95 0 -85 0 -75 0.7 -65 0.7 -55 0.7 -45 0.7 -35 1 -25 1 -15 1 -5 1"),
                 TestCase::Duration::QUICK);
 
+    AddTestCase(new DistributionCollectorStateTestCase(), TestCase::Duration::QUICK);
+
 } // end of `DistributionCollectorTestSuite ()`
 
 static DistributionCollectorTestSuite g_distributionCollectorTestSuiteInstance;
@@ -0,0 +1,324 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * @file interval-rate-collector-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for IntervalRateCollector.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=interval-rate-collector
+ * @endcode
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/interval-rate-collector-group.h"
+#include "ns3/interval-rate-collector.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("IntervalRateCollectorTest");
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ * @brief Records the output of an IntervalRateCollector.
+ */
+class IntervalRateCollectorOutput
+{
+  public:
+    /// Creates an empty record.
+    IntervalRateCollectorOutput();
+
+    /**
+     * @brief Connect to the `OutputWithTime` and `OutputOverall` trace sources
+     *        of a collector.
+     * @param collector the collector.
+     */
+    void Connect(Ptr<IntervalRateCollector> collector);
+
+    /**
+     * @brief Trace sink for the `OutputWithTime` trace source.
+     * @param time the end of the interval.
+     * @param value the output of the interval.
+     */
+    void OutputWithTimeCallback(double time, double value);
+
+    /**
+     * @brief Trace sink for the `OutputOverall` trace source.
+     * @param value the output of all intervals.
+     */
+    void OutputOverallCallback(double value);
+
+    /// The end of every interval and its output, in the order of emission.
+    std::vector<std::pair<double, double>> m_intervals;
+
+    /// The overall output, or -1 if not emitted.
+    double m_overall;
+
+}; // end of `class IntervalRateCollectorOutput`
+
+IntervalRateCollectorOutput::IntervalRateCollectorOutput()
+    : m_intervals(),
+      m_overall(-1.0)
+{
+}
+
+void
+IntervalRateCollectorOutput::Connect(Ptr<IntervalRateCollector> collector)
+{
+    collector->TraceConnectWithoutContext(
+        "OutputWithTime",
+        MakeCallback(&IntervalRateCollectorOutput::OutputWithTimeCallback, this));
+    collector->TraceConnectWithoutContext(
+        "OutputOverall",
+        MakeCallback(&IntervalRateCollectorOutput::OutputOverallCallback, this));
+}
+
+void
+IntervalRateCollectorOutput::OutputWithTimeCallback(double time, double value)
+{
+    m_intervals.push_back(std::make_pair(time, value));
+}
+
+void
+IntervalRateCollectorOutput::OutputOverallCallback(double value)
+{
+    m_overall = value;
+}
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `interval-rate-collector` test suite. Feeds the same samples,
+ * none of them at an interval boundary, to a collector with scheduled
+ * intervals, to one with `LazyRollover`, and to one registered to an
+ * IntervalRateCollectorGroup, and verifies that all of them emit the expected
+ * output, including the empty intervals between the samples and the
+ * intervals closed by the final flush of the lazy collector. The simulation
+ * stops either exactly at an interval boundary or within an interval; neither
+ * the interval ending at the stop time nor the unfinished one is emitted.
+ */
+class IntervalRateCollectorRolloverTestCase : public TestCase
+{
+  public:
+    /**
+     * @brief Construct a new test case.
+     * @param name the suffix of the name of the test case.
+     * @param stopTime when the simulation stops.
+     */
+    IntervalRateCollectorRolloverTestCase(std::string name, Time stopTime);
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    /**
+     * @brief Verify the output of one collector.
+     * @param name the name of the collector, used in the messages.
+     * @param output the recorded output of the collector.
+     * @param expected the expected end of every interval and its output.
+     * @param expectedOverall the expected overall output.
+     */
+    void VerifyOutput(std::string name,
+                      const IntervalRateCollectorOutput& output,
+                      const std::vector<std::pair<double, double>>& expected,
+                      double expectedOverall);
+
+    Time m_stopTime; ///< When the simulation stops.
+
+}; // end of `class IntervalRateCollectorRolloverTestCase`
+
+IntervalRateCollectorRolloverTestCase::IntervalRateCollectorRolloverTestCase(std::string name,
+                                                                             Time stopTime)
+    : TestCase("interval-rate-collector-rollover-" + name),
+      m_stopTime(stopTime)
+{
+}
+
+void
+IntervalRateCollectorRolloverTestCase::VerifyOutput(
+    std::string name,
+    const IntervalRateCollectorOutput& output,
+    const std::vector<std::pair<double, double>>& expected,
+    double expectedOverall)
+{
+    NS_TEST_ASSERT_MSG_EQ(output.m_intervals.size(),
+                          expected.size(),
+                          "Wrong number of intervals of " << name);
+    for (uint32_t i = 0; i < expected.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(output.m_intervals[i].first,
+                                  expected[i].first,
+                                  1e-9,
+                                  "Wrong end of interval " << i << " of " << name);
+        NS_TEST_ASSERT_MSG_EQ_TOL(output.m_intervals[i].second,
+                                  expected[i].second,
+                                  1e-9,
+                                  "Wrong output of interval " << i << " of " << name);
+    }
+    NS_TEST_ASSERT_MSG_EQ_TOL(output.m_overall,
+                              expectedOverall,
+                              1e-9,
+                              "Wrong overall output of " << name);
+}
+
+void
+IntervalRateCollectorRolloverTestCase::DoRun()
+{
+    Ptr<IntervalRateCollector> scheduled = CreateObject<IntervalRateCollector>();
+    Ptr<IntervalRateCollector> lazy = CreateObject<IntervalRateCollector>();
+    lazy->SetLazyRollover(true);
+    Ptr<IntervalRateCollectorGroup> group = CreateObject<IntervalRateCollectorGroup>();
+    Ptr<IntervalRateCollector> grouped = CreateObject<IntervalRateCollector>();
+    grouped->SetIntervalGroup(group);
+
+    IntervalRateCollectorOutput scheduledOutput;
+    scheduledOutput.Connect(scheduled);
+    IntervalRateCollectorOutput lazyOutput;
+    lazyOutput.Connect(lazy);
+    IntervalRateCollectorOutput groupedOutput;
+    groupedOutput.Connect(grouped);
+
+    // The intervals of 1 second ending at 2, 3, and 5 seconds are empty, and
+    // the intervals after the last sample are only closed by the final flush.
+    const double times[] = {0.5, 0.75, 3.25};
+    const double values[] = {1.0, 2.0, 4.0};
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        Simulator::Schedule(Seconds(times[i]),
+                            &IntervalRateCollector::TraceSinkDouble,
+                            scheduled,
+                            0.0,
+                            values[i]);
+        Simulator::Schedule(Seconds(times[i]),
+                            &IntervalRateCollector::TraceSinkDouble,
+                            lazy,
+                            0.0,
+                            values[i]);
+        Simulator::Schedule(Seconds(times[i]),
+                            &IntervalRateCollector::TraceSinkDouble,
+                            grouped,
+                            0.0,
+                            values[i]);
+    }
+
+    // Every interval which has ended strictly before the stop time.
+    const double sums[] = {3.0, 0.0, 0.0, 4.0, 0.0};
+    std::vector<std::pair<double, double>> expected;
+    for (uint32_t i = 0; i < 5 && Seconds(i + 1) < m_stopTime; i++)
+    {
+        expected.push_back(std::make_pair(i + 1.0, sums[i]));
+    }
+
+    Simulator::Stop(m_stopTime);
+    Simulator::Run();
+
+    // The lazy collector has only emitted the intervals before its last sample.
+    NS_TEST_ASSERT_MSG_EQ(lazyOutput.m_intervals.size(),
+                          3,
+                          "Wrong number of intervals emitted before the flush");
+
+    // Destroying the simulator flushes the lazy collector.
+    Simulator::Destroy();
+    scheduled->Dispose();
+    lazy->Dispose();
+    grouped->Dispose();
+    group->Dispose();
+
+    VerifyOutput("scheduled", scheduledOutput, expected, 7.0);
+    VerifyOutput("lazy", lazyOutput, expected, 7.0);
+    VerifyOutput("grouped", groupedOutput, expected, 7.0);
+}
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `interval-rate-collector` test suite. Verifies that a lazy
+ * collector puts a sample received exactly at an interval boundary into the
+ * interval which begins at the boundary.
+ */
+class IntervalRateCollectorLazyBoundaryTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    IntervalRateCollectorLazyBoundaryTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class IntervalRateCollectorLazyBoundaryTestCase`
+
+IntervalRateCollectorLazyBoundaryTestCase::IntervalRateCollectorLazyBoundaryTestCase()
+    : TestCase("interval-rate-collector-lazy-boundary")
+{
+}
+
+void
+IntervalRateCollectorLazyBoundaryTestCase::DoRun()
+{
+    Ptr<IntervalRateCollector> lazy = CreateObject<IntervalRateCollector>();
+    lazy->SetLazyRollover(true);
+    IntervalRateCollectorOutput output;
+    output.Connect(lazy);
+
+    Simulator::Schedule(Seconds(1), &IntervalRateCollector::TraceSinkDouble, lazy, 0.0, 5.0);
+    Simulator::Stop(Seconds(2.5));
+    Simulator::Run();
+    Simulator::Destroy();
+    lazy->Dispose();
+
+    NS_TEST_ASSERT_MSG_EQ(output.m_intervals.size(), 2, "Wrong number of intervals");
+    NS_TEST_ASSERT_MSG_EQ_TOL(output.m_intervals[0].second, 0.0, 1e-9, "Wrong first interval");
+    NS_TEST_ASSERT_MSG_EQ_TOL(output.m_intervals[1].second, 5.0, 1e-9, "Wrong second interval");
+}
+
+/**
+ * @brief Test suite `interval-rate-collector`, verifying the
+ *        IntervalRateCollector class.
+ */
+class IntervalRateCollectorTestSuite : public TestSuite
+{
+  public:
+    IntervalRateCollectorTestSuite();
+};
+
+IntervalRateCollectorTestSuite::IntervalRateCollectorTestSuite()
+    : TestSuite("interval-rate-collector", Type::UNIT)
+{
+    // LogComponentEnable ("IntervalRateCollectorTest", LOG_LEVEL_ALL);
+    // LogComponentEnable ("IntervalRateCollector", LOG_LEVEL_ALL);
+
+    AddTestCase(new IntervalRateCollectorRolloverTestCase("stop-at-boundary", Seconds(5)),
+                TestCase::Duration::QUICK);
+    AddTestCase(new IntervalRateCollectorRolloverTestCase("stop-within-interval", Seconds(5.5)),
+                TestCase::Duration::QUICK);
+    AddTestCase(new IntervalRateCollectorLazyBoundaryTestCase(), TestCase::Duration::QUICK);
+
+} // end of `IntervalRateCollectorTestSuite ()`
+
+static IntervalRateCollectorTestSuite g_intervalRateCollectorTestSuiteInstance;
+
+} // end of namespace ns3
@@ -0,0 +1,333 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * @file magister-stats-perf-test-suite.cc
+ * @ingroup stats
+ * @brief Performance regression tests of the key paths of the module.
+ *
+ * The thresholds can be adjusted to the machine running the tests through
+ * the following environment variables:
+ * - `MAGISTER_STATS_PERF_MIN_COLLECTOR_SAMPLES_PER_SEC`: the floor of samples
+ *   per second fed into DistributionCollector (default 2e6);
+ * - `MAGISTER_STATS_PERF_MIN_AGGREGATOR_WRITES_PER_SEC`: the floor of writes
+ *   per second into MultiFileAggregator, including its destruction (default
+ *   2e5);
+ * - `MAGISTER_STATS_PERF_MAX_COLLECTOR_MAP_BYTES`: the ceiling of memory per
+ *   collector of a CollectorMap with 100k ScalarCollector instances, both as
+ *   estimated by CollectorMap::GetMemoryUsage() and as allocated on the heap
+ *   (default 1024).
+ *
+ * The heap is measured with `mallinfo2`, so the test case of the heap
+ * allocations is only part of the suite with glibc 2.33 or later.
+ *
+ * Usage example:
+ * @code
+ *    $ MAGISTER_STATS_PERF_MIN_COLLECTOR_SAMPLES_PER_SEC=5e6 ./test.py -s magister-stats-perf
+ * @endcode
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/collector-map.h"
+#include "ns3/core-module.h"
+#include "ns3/distribution-collector.h"
+#include "ns3/multi-file-aggregator.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#endif
+
+NS_LOG_COMPONENT_DEFINE("MagisterStatsPerfTest");
+
+namespace ns3
+{
+
+/**
+ * @param name the name of an environment variable.
+ * @param defaultValue the value to use when the variable is not set.
+ * @return the value of the environment variable as a number.
+ */
+static double
+GetThreshold(const char* name, double defaultValue)
+{
+    const char* value = std::getenv(name);
+    if (value == nullptr || *value == '\0')
+    {
+        return defaultValue;
+    }
+
+    char* end = nullptr;
+    const double threshold = std::strtod(value, &end);
+    NS_ABORT_MSG_IF(*end != '\0', "Invalid value " << value << " of " << name);
+    return threshold;
+}
+
+/**
+ * @return the heap memory allocated by this process in bytes, including large
+ *         blocks allocated with `mmap`, or zero without `mallinfo2`.
+ *
+ * Unlike the resident memory, the value does not depend on which pages have
+ * been touched or returned to the system.
+ */
+static uint64_t
+GetHeapBytes()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    const struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+/// The clock used for all measurements.
+typedef std::chrono::steady_clock Clock_t;
+
+// DISTRIBUTION COLLECTOR /////////////////////////////////////////////////////
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `magister-stats-perf` test suite. Feeds samples into a
+ * DistributionCollector and verifies that the number of samples per second
+ * stays above a floor.
+ */
+class DistributionCollectorPerfTestCase : public TestCase
+{
+  public:
+    /**
+     * @brief Construct a new test case.
+     * @param binType the bin type of the collector.
+     */
+    DistributionCollectorPerfTestCase(DistributionCollector::DistributionBinType_t binType);
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    DistributionCollector::DistributionBinType_t m_binType; ///< Bin type of the collector.
+
+}; // end of `class DistributionCollectorPerfTestCase`
+
+DistributionCollectorPerfTestCase::DistributionCollectorPerfTestCase(
+    DistributionCollector::DistributionBinType_t binType)
+    : TestCase("distribution-collector-" + DistributionCollector::GetBinTypeName(binType)),
+      m_binType(binType)
+{
+}
+
+void
+DistributionCollectorPerfTestCase::DoRun()
+{
+    const double floor = GetThreshold("MAGISTER_STATS_PERF_MIN_COLLECTOR_SAMPLES_PER_SEC", 2e6);
+    const uint32_t numOfSamples = 2000000;
+
+    Ptr<DistributionCollector> collector = CreateObject<DistributionCollector>();
+    collector->SetBinType(m_binType);
+    collector->SetSmallestSettlingValue(0.0);
+    collector->SetLargestSettlingValue(1000.0);
+    collector->InitializeBins();
+
+    // A cheap deterministic sequence covering the whole range.
+    const Clock_t::time_point start = Clock_t::now();
+    for (uint32_t i = 0; i < numOfSamples; i++)
+    {
+        collector->TraceSinkDouble1(static_cast<double>((i * 7919) % 1000));
+    }
+    const double seconds = std::chrono::duration<double>(Clock_t::now() - start).count();
+    const double samplesPerSecond = numOfSamples / seconds;
+
+    NS_LOG_INFO(GetName() << ": " << samplesPerSecond << " samples/s");
+    NS_TEST_ASSERT_MSG_GT(samplesPerSecond,
+                          floor,
+                          "DistributionCollector is slower than the floor of " << floor
+                                                                               << " samples/s");
+    collector->Dispose();
+}
+
+// MULTI FILE AGGREGATOR //////////////////////////////////////////////////////
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `magister-stats-perf` test suite. Writes lines with a
+ * MultiFileAggregator and verifies that the number of writes per second,
+ * including flushing the file, stays above a floor.
+ */
+class MultiFileAggregatorPerfTestCase : public TestCase
+{
+  public:
+    /**
+     * @brief Construct a new test case.
+     * @param multiFileMode whether each context is written to its own file.
+     */
+    MultiFileAggregatorPerfTestCase(bool multiFileMode);
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    bool m_multiFileMode; ///< The `MultiFileMode` attribute of the aggregator.
+
+}; // end of `class MultiFileAggregatorPerfTestCase`
+
+MultiFileAggregatorPerfTestCase::MultiFileAggregatorPerfTestCase(bool multiFileMode)
+    : TestCase(multiFileMode ? "multi-file-aggregator-multi" : "multi-file-aggregator-single"),
+      m_multiFileMode(multiFileMode)
+{
+}
+
+void
+MultiFileAggregatorPerfTestCase::DoRun()
+{
+    const double floor = GetThreshold("MAGISTER_STATS_PERF_MIN_AGGREGATOR_WRITES_PER_SEC", 2e5);
+    const uint32_t numOfWrites = 500000;
+    const uint32_t numOfContexts = 16;
+
+    std::vector<std::string> contexts(numOfContexts);
+    for (uint32_t c = 0; c < numOfContexts; c++)
+    {
+        std::ostringstream oss;
+        oss << c;
+        contexts[c] = oss.str();
+    }
+
+    Ptr<MultiFileAggregator> aggregator = CreateObject<MultiFileAggregator>();
+    aggregator->SetAttribute("OutputFileName", StringValue(CreateTempDirFilename(GetName())));
+    aggregator->SetAttribute("MultiFileMode", BooleanValue(m_multiFileMode));
+
+    const Clock_t::time_point start = Clock_t::now();
+    for (uint32_t i = 0; i < numOfWrites; i++)
+    {
+        aggregator->Write2d(contexts[i % numOfContexts], i, i * 0.5);
+    }
+    // Dispose() truncates any memory-mapped files, and the destructor writes
+    // the headings, so both are included in the measurement.
+    aggregator->Dispose();
+    aggregator = nullptr;
+    const double seconds = std::chrono::duration<double>(Clock_t::now() - start).count();
+    const double writesPerSecond = numOfWrites / seconds;
+
+    NS_LOG_INFO(GetName() << ": " << writesPerSecond << " writes/s");
+    NS_TEST_ASSERT_MSG_GT(writesPerSecond,
+                          floor,
+                          "MultiFileAggregator is slower than the floor of " << floor
+                                                                             << " writes/s");
+}
+
+// COLLECTOR MAP //////////////////////////////////////////////////////////////
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `magister-stats-perf` test suite. Creates a CollectorMap of
+ * 100k ScalarCollector instances and verifies that the memory per collector
+ * stays below a ceiling. The memory is either estimated by
+ * CollectorMap::GetMemoryUsage(), or measured as the growth of the heap.
+ */
+class CollectorMapMemoryTestCase : public TestCase
+{
+  public:
+    /**
+     * @brief Construct a new test case.
+     * @param isHeapMeasured whether to measure the growth of the heap with
+     *                       GetHeapBytes(), instead of using the estimate of
+     *                       CollectorMap::GetMemoryUsage().
+     */
+    CollectorMapMemoryTestCase(bool isHeapMeasured);
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    bool m_isHeapMeasured; ///< Whether the growth of the heap is measured.
+
+}; // end of `class CollectorMapMemoryTestCase`
+
+CollectorMapMemoryTestCase::CollectorMapMemoryTestCase(bool isHeapMeasured)
+    : TestCase(isHeapMeasured ? "collector-map-heap" : "collector-map-memory"),
+      m_isHeapMeasured(isHeapMeasured)
+{
+}
+
+void
+CollectorMapMemoryTestCase::DoRun()
+{
+    const double ceiling = GetThreshold("MAGISTER_STATS_PERF_MAX_COLLECTOR_MAP_BYTES", 1024);
+    const uint32_t numOfCollectors = 100000;
+
+    const uint64_t before = m_isHeapMeasured ? GetHeapBytes() : 0;
+
+    CollectorMap collectors;
+    collectors.SetType("ns3::ScalarCollector");
+    for (uint32_t i = 0; i < numOfCollectors; i++)
+    {
+        collectors.Create(i);
+    }
+
+    const uint64_t after = m_isHeapMeasured ? GetHeapBytes() : collectors.GetMemoryUsage();
+    NS_TEST_ASSERT_MSG_GT(after, before, "No memory used by the collectors");
+    const double bytesPerCollector = static_cast<double>(after - before) / numOfCollectors;
+
+    NS_LOG_INFO(GetName() << ": " << bytesPerCollector << " bytes/collector");
+    NS_TEST_ASSERT_MSG_LT(bytesPerCollector,
+                          ceiling,
+                          "CollectorMap uses more than the ceiling of " << ceiling
+                                                                        << " bytes/collector");
+}
+
+// TEST SUITE /////////////////////////////////////////////////////////////////
+
+/**
+ * @ingroup stats
+ * @brief Performance regression test suite of the module.
+ */
+class MagisterStatsPerfTestSuite : public TestSuite
+{
+  public:
+    MagisterStatsPerfTestSuite();
+};
+
+MagisterStatsPerfTestSuite::MagisterStatsPerfTestSuite()
+    : TestSuite("magister-stats-perf", Type::PERFORMANCE)
+{
+    AddTestCase(new DistributionCollectorPerfTestCase(DistributionCollector::BIN_TYPE_ADAPTIVE),
+                TestCase::Duration::QUICK);
+    AddTestCase(new DistributionCollectorPerfTestCase(DistributionCollector::BIN_TYPE_STATIC),
+                TestCase::Duration::QUICK);
+    AddTestCase(new MultiFileAggregatorPerfTestCase(false), TestCase::Duration::QUICK);
+    AddTestCase(new MultiFileAggregatorPerfTestCase(true), TestCase::Duration::QUICK);
+    AddTestCase(new CollectorMapMemoryTestCase(false), TestCase::Duration::QUICK);
+
+    // Without mallinfo2(), the heap cannot be measured, and the test case is
+    // left out of the suite rather than reported as passed.
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    AddTestCase(new CollectorMapMemoryTestCase(true), TestCase::Duration::QUICK);
+#endif
+
+} // end of `MagisterStatsPerfTestSuite ()`
+
+static MagisterStatsPerfTestSuite g_magisterStatsPerfTestSuiteInstance;
+
+} // end of namespace ns3
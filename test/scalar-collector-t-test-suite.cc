@@ -0,0 +1,269 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * @file scalar-collector-t-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for ScalarCollectorT.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=scalar-collector-t
+ * @endcode
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/scalar-collector-t.h"
+#include "ns3/scalar-collector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <type_traits>
+
+NS_LOG_COMPONENT_DEFINE("ScalarCollectorTTest");
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `scalar-collector-t` test suite. Feeds the same samples, at
+ * different simulation times, to a ScalarCollectorT and to a ScalarCollector
+ * with the equivalent input data type and output type, and verifies that
+ * both emit the same output. With no samples at all, both must also agree,
+ * including the `nan` of ScalarOutputAveragePerSample.
+ */
+template <typename T, typename OutputPolicy>
+class ScalarCollectorTTestCase : public TestCase
+{
+  public:
+    /**
+     * @brief Construct a new test case.
+     * @param outputType the output type of ScalarCollector which is equivalent
+     *                   to `OutputPolicy`.
+     * @param isEmpty whether no samples are fed at all.
+     */
+    ScalarCollectorTTestCase(ScalarCollector::OutputType_t outputType, bool isEmpty);
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    /**
+     * @brief Pass a sample to both collectors.
+     * @param value the sample.
+     */
+    void Feed(T value);
+
+    /**
+     * @brief Trace sink for the `Output` trace source of the ScalarCollectorT.
+     * @param value the output.
+     */
+    void OutputCallback(double value);
+
+    /**
+     * @brief Trace sink for the `Output` trace source of the ScalarCollector.
+     * @param value the output.
+     */
+    void ReferenceOutputCallback(double value);
+
+    ScalarCollector::OutputType_t m_outputType;         ///< The equivalent output type.
+    bool m_isEmpty;                                     ///< Whether no samples are fed.
+    Ptr<ScalarCollectorT<T, OutputPolicy>> m_collector; ///< The collector under test.
+    Ptr<ScalarCollector> m_reference;                   ///< The equivalent ScalarCollector.
+    double m_output;                                    ///< The output of the ScalarCollectorT.
+    double m_referenceOutput;                           ///< The output of the ScalarCollector.
+
+}; // end of `class ScalarCollectorTTestCase`
+
+template <typename T, typename OutputPolicy>
+ScalarCollectorTTestCase<T, OutputPolicy>::ScalarCollectorTTestCase(
+    ScalarCollector::OutputType_t outputType,
+    bool isEmpty)
+    : TestCase("scalar-collector-t-" + ScalarCollectorInput<T>::GetName() + "-" +
+               OutputPolicy::GetName() + (isEmpty ? "-empty" : "")),
+      m_outputType(outputType),
+      m_isEmpty(isEmpty),
+      m_output(-1.0),
+      m_referenceOutput(-1.0)
+{
+}
+
+template <typename T, typename OutputPolicy>
+void
+ScalarCollectorTTestCase<T, OutputPolicy>::Feed(T value)
+{
+    m_collector->TraceSink(T(), value);
+
+    if constexpr (std::is_same<T, double>::value)
+    {
+        m_reference->TraceSinkDouble(0.0, value);
+    }
+    else if constexpr (std::is_same<T, bool>::value)
+    {
+        m_reference->TraceSinkBoolean(false, value);
+    }
+    else if constexpr (std::is_same<T, uint32_t>::value)
+    {
+        m_reference->TraceSinkUinteger32(0, value);
+    }
+    else
+    {
+        m_reference->TraceSinkUinteger64(0, value);
+    }
+}
+
+template <typename T, typename OutputPolicy>
+void
+ScalarCollectorTTestCase<T, OutputPolicy>::OutputCallback(double value)
+{
+    m_output = value;
+}
+
+template <typename T, typename OutputPolicy>
+void
+ScalarCollectorTTestCase<T, OutputPolicy>::ReferenceOutputCallback(double value)
+{
+    m_referenceOutput = value;
+}
+
+template <typename T, typename OutputPolicy>
+void
+ScalarCollectorTTestCase<T, OutputPolicy>::DoRun()
+{
+    m_collector = CreateObject<ScalarCollectorT<T, OutputPolicy>>();
+    m_collector->TraceConnectWithoutContext(
+        "Output",
+        MakeCallback(&ScalarCollectorTTestCase<T, OutputPolicy>::OutputCallback, this));
+
+    m_reference = CreateObject<ScalarCollector>();
+    if constexpr (std::is_same<T, double>::value)
+    {
+        m_reference->SetInputDataType(ScalarCollector::INPUT_DATA_TYPE_DOUBLE);
+    }
+    else if constexpr (std::is_same<T, bool>::value)
+    {
+        m_reference->SetInputDataType(ScalarCollector::INPUT_DATA_TYPE_BOOLEAN);
+    }
+    else
+    {
+        m_reference->SetInputDataType(ScalarCollector::INPUT_DATA_TYPE_UINTEGER);
+    }
+    m_reference->SetOutputType(m_outputType);
+    m_reference->TraceConnectWithoutContext(
+        "Output",
+        MakeCallback(&ScalarCollectorTTestCase<T, OutputPolicy>::ReferenceOutputCallback, this));
+
+    if (!m_isEmpty)
+    {
+        // Integer inputs are truncated and boolean inputs are true unless zero.
+        const double times[] = {1.5, 2.0, 2.5, 4.0, 6.25};
+        const double values[] = {3.0, 0.0, 7.25, 1.0, 5.5};
+        for (uint32_t i = 0; i < 5; i++)
+        {
+            Simulator::Schedule(Seconds(times[i]),
+                                &ScalarCollectorTTestCase<T, OutputPolicy>::Feed,
+                                this,
+                                static_cast<T>(values[i]));
+        }
+    }
+
+    Simulator::Run();
+    m_collector->Dispose();
+    m_reference->Dispose();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_NE(m_referenceOutput, -1.0, "No output from ScalarCollector");
+    if (std::isnan(m_referenceOutput))
+    {
+        NS_TEST_ASSERT_MSG_EQ(std::isnan(m_output), true, "Expected nan, got " << m_output);
+    }
+    else
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(m_output,
+                                  m_referenceOutput,
+                                  1e-12 * std::max(1.0, std::fabs(m_referenceOutput)),
+                                  "Different output than ScalarCollector");
+    }
+
+    m_collector = nullptr;
+    m_reference = nullptr;
+}
+
+/**
+ * @brief Test suite `scalar-collector-t`, verifying the ScalarCollectorT
+ *        class template.
+ */
+class ScalarCollectorTTestSuite : public TestSuite
+{
+  public:
+    ScalarCollectorTTestSuite();
+
+  private:
+    /**
+     * @brief Add the test cases of every output policy, with and without
+     *        samples, for one input data type.
+     */
+    template <typename T>
+    void AddTestCases();
+};
+
+template <typename T>
+void
+ScalarCollectorTTestSuite::AddTestCases()
+{
+    for (const bool isEmpty : {false, true})
+    {
+        AddTestCase(
+            new ScalarCollectorTTestCase<T, ScalarOutputSum>(ScalarCollector::OUTPUT_TYPE_SUM,
+                                                             isEmpty),
+            TestCase::Duration::QUICK);
+        AddTestCase(new ScalarCollectorTTestCase<T, ScalarOutputNumberOfSample>(
+                        ScalarCollector::OUTPUT_TYPE_NUMBER_OF_SAMPLE,
+                        isEmpty),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new ScalarCollectorTTestCase<T, ScalarOutputAveragePerSample>(
+                        ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SAMPLE,
+                        isEmpty),
+                    TestCase::Duration::QUICK);
+        AddTestCase(new ScalarCollectorTTestCase<T, ScalarOutputAveragePerSecond>(
+                        ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND,
+                        isEmpty),
+                    TestCase::Duration::QUICK);
+    }
+}
+
+ScalarCollectorTTestSuite::ScalarCollectorTTestSuite()
+    : TestSuite("scalar-collector-t", Type::UNIT)
+{
+    // LogComponentEnable ("ScalarCollectorTTest", LOG_LEVEL_ALL);
+    // LogComponentEnable ("ScalarCollector", LOG_LEVEL_ALL);
+
+    AddTestCases<double>();
+    AddTestCases<uint32_t>();
+    AddTestCases<uint64_t>();
+    AddTestCases<bool>();
+
+} // end of `ScalarCollectorTTestSuite ()`
+
+static ScalarCollectorTTestSuite g_scalarCollectorTTestSuiteInstance;
+
+} // end of namespace ns3
@@ -0,0 +1,247 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+/**
+ * @file stats-checkpoint-helper-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for StatsCheckpointHelper.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=stats-checkpoint-helper
+ * @endcode
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/stats-checkpoint-helper.h"
+#include "ns3/stats-throughput-helper.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+NS_LOG_COMPONENT_DEFINE("StatsCheckpointHelperTest");
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ * @brief A throughput helper whose samples are given by the test cases
+ *        instead of applications.
+ */
+class CheckpointTestThroughputHelper : public StatsAppThroughputHelper
+{
+  public:
+    /**
+     * @brief Pass a received packet to the collector of the first identifier.
+     * @param bytes the size of the packet.
+     */
+    void AddSample(uint32_t bytes);
+
+}; // end of `class CheckpointTestThroughputHelper`
+
+void
+CheckpointTestThroughputHelper::AddSample(uint32_t bytes)
+{
+    PassSampleToCollector(0, bytes);
+}
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `stats-checkpoint-helper` test suite. Runs a scalar and a
+ * scatter throughput helper three times:
+ * - uninterrupted, as the reference;
+ * - with a snapshot saved at 2.5 seconds, in the middle of an interval of the
+ *   IntervalRateCollectorGroup, and stopped at 3.2 seconds;
+ * - restored from the snapshot into the output files of the second run, and
+ *   fed with the samples after 2.5 seconds only.
+ *
+ * The output files of the last run must be identical to the reference. This
+ * holds only if the rows written by the second run after the snapshot are
+ * truncated by MultiFileAggregator, and the samples of the pending interval
+ * before the snapshot are restored into the group.
+ */
+class StatsCheckpointHelperTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    StatsCheckpointHelperTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    /// The runs of the test case.
+    enum Run_t
+    {
+        RUN_REFERENCE, ///< Uninterrupted.
+        RUN_SAVE,      ///< Saving the snapshot.
+        RUN_RESTORE    ///< Restoring the snapshot.
+    };
+
+    /**
+     * @brief Install the helpers and run the simulation.
+     * @param outputPath the directory of the output files.
+     * @param run the kind of the run.
+     */
+    void RunSimulation(std::string outputPath, Run_t run);
+
+    /**
+     * @param fileName the name of a file.
+     * @return the content of the file.
+     */
+    static std::string ReadFile(std::string fileName);
+
+    std::string m_fileName; ///< The name of the snapshot file.
+
+}; // end of `class StatsCheckpointHelperTestCase`
+
+StatsCheckpointHelperTestCase::StatsCheckpointHelperTestCase()
+    : TestCase("stats-checkpoint-helper-save-restore"),
+      m_fileName()
+{
+}
+
+void
+StatsCheckpointHelperTestCase::RunSimulation(std::string outputPath, Run_t run)
+{
+    NodeContainer nodes;
+    nodes.Create(1);
+
+    Ptr<CheckpointTestThroughputHelper> scalar = CreateObject<CheckpointTestThroughputHelper>();
+    scalar->SetName("throughput-scalar");
+    scalar->SetAttribute("OutputPath", StringValue(outputPath));
+    scalar->SetIdentifierType(StatsHelper::IDENTIFIER_GLOBAL);
+    scalar->SetOutputType(StatsHelper::OUTPUT_SCALAR_FILE);
+    scalar->InstallNodes(nodes);
+    scalar->Install();
+
+    Ptr<CheckpointTestThroughputHelper> scatter = CreateObject<CheckpointTestThroughputHelper>();
+    scatter->SetName("throughput-scatter");
+    scatter->SetAttribute("OutputPath", StringValue(outputPath));
+    scatter->SetIdentifierType(StatsHelper::IDENTIFIER_GLOBAL);
+    scatter->SetOutputType(StatsHelper::OUTPUT_SCATTER_FILE);
+    scatter->InstallNodes(nodes);
+    scatter->Install();
+
+    Ptr<StatsCheckpointHelper> checkpoint = CreateObject<StatsCheckpointHelper>();
+    checkpoint->SetFileName(m_fileName);
+    checkpoint->AddHelper(scalar);
+    checkpoint->AddHelper(scatter);
+
+    const double times[] = {0.5, 1.5, 2.2, 2.7, 3.4, 4.2};
+    const uint32_t sizes[] = {1000, 2000, 500, 3000, 7000, 100};
+    for (uint32_t k = 0; k < 6; k++)
+    {
+        if (run == RUN_RESTORE && times[k] < 2.5)
+        {
+            continue; // Already in the snapshot.
+        }
+
+        Simulator::Schedule(Seconds(times[k]),
+                            &CheckpointTestThroughputHelper::AddSample,
+                            scalar,
+                            sizes[k]);
+        Simulator::Schedule(Seconds(times[k]),
+                            &CheckpointTestThroughputHelper::AddSample,
+                            scatter,
+                            sizes[k]);
+    }
+
+    if (run == RUN_SAVE)
+    {
+        Simulator::Schedule(Seconds(2.5), &StatsCheckpointHelper::Save, checkpoint);
+    }
+    else if (run == RUN_RESTORE)
+    {
+        // The pending interval is rescheduled to end at 3 seconds.
+        checkpoint->Restore();
+    }
+
+    Simulator::Stop(Seconds(run == RUN_SAVE ? 3.2 : 4.5));
+    Simulator::Run();
+
+    // The output is written when the collectors and aggregators are released.
+    checkpoint->Dispose();
+    scalar->Dispose();
+    scatter->Dispose();
+    checkpoint = nullptr;
+    scalar = nullptr;
+    scatter = nullptr;
+    Simulator::Destroy();
+}
+
+std::string // static
+StatsCheckpointHelperTestCase::ReadFile(std::string fileName)
+{
+    std::ifstream ifs(fileName);
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+    return oss.str();
+}
+
+void
+StatsCheckpointHelperTestCase::DoRun()
+{
+    m_fileName = CreateTempDirFilename("stats-checkpoint.bin");
+    const std::string referencePath = CreateTempDirFilename("checkpoint-reference");
+    const std::string restoredPath = CreateTempDirFilename("checkpoint-restored");
+
+    RunSimulation(referencePath, RUN_REFERENCE);
+    RunSimulation(restoredPath, RUN_SAVE);
+    RunSimulation(restoredPath, RUN_RESTORE);
+
+    // The scatter output has one file per identifier, "0" with IDENTIFIER_GLOBAL.
+    const std::string files[] = {"throughput-scalar.txt", "throughput-scatter-0.txt"};
+    for (const std::string& file : files)
+    {
+        const std::string reference = ReadFile(referencePath + "/" + file);
+        const std::string restored = ReadFile(restoredPath + "/" + file);
+        NS_TEST_ASSERT_MSG_EQ(reference.empty(), false, "Missing output " << file);
+        NS_TEST_ASSERT_MSG_EQ(restored, reference, "Wrong restored output of " << file);
+    }
+}
+
+/**
+ * @brief Test suite `stats-checkpoint-helper`, verifying the
+ *        StatsCheckpointHelper class.
+ */
+class StatsCheckpointHelperTestSuite : public TestSuite
+{
+  public:
+    StatsCheckpointHelperTestSuite();
+};
+
+StatsCheckpointHelperTestSuite::StatsCheckpointHelperTestSuite()
+    : TestSuite("stats-checkpoint-helper", Type::UNIT)
+{
+    // LogComponentEnable ("StatsCheckpointHelperTest", LOG_LEVEL_ALL);
+    // LogComponentEnable ("StatsCheckpointHelper", LOG_LEVEL_ALL);
+
+    AddTestCase(new StatsCheckpointHelperTestCase(), TestCase::Duration::QUICK);
+
+} // end of `StatsCheckpointHelperTestSuite ()`
+
+static StatsCheckpointHelperTestSuite g_statsCheckpointHelperTestSuiteInstance;
+
+} // end of namespace ns3
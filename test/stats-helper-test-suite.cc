@@ -0,0 +1,541 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+/**
+ * @file stats-helper-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for the identifier lookups and SetEnabled() of StatsHelper.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=stats-helper
+ * @endcode
+ */
+
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/network-module.h"
+#include "ns3/source-id-tag.h"
+#include "ns3/stats-helper.h"
+#include "ns3/unit-conversion-collector.h"
+
+NS_LOG_COMPONENT_DEFINE("StatsHelperTest");
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ * @brief A helper which installs nothing, exposing the identifier lookups of
+ *        StatsHelper to the test cases.
+ */
+class IdentifierTestStatsHelper : public StatsHelper
+{
+  public:
+    using StatsHelper::GetApplicationIdentifier;
+    using StatsHelper::GetFlowDestination;
+    using StatsHelper::GetFlowIdentifier;
+    using StatsHelper::GetSourceIdentifier;
+
+  protected:
+    // inherited from StatsHelper base class
+    virtual void DoInstall();
+
+}; // end of `class IdentifierTestStatsHelper`
+
+void
+IdentifierTestStatsHelper::DoInstall()
+{
+}
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `stats-helper` test suite. Installs two nodes with two and one
+ * applications, leaving out a third node, and verifies the identifier of each
+ * application with `IDENTIFIER_APPLICATION` and `IDENTIFIER_NODE`.
+ */
+class StatsHelperApplicationIdentifierTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    StatsHelperApplicationIdentifierTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class StatsHelperApplicationIdentifierTestCase`
+
+StatsHelperApplicationIdentifierTestCase::StatsHelperApplicationIdentifierTestCase()
+    : TestCase("stats-helper-application-identifier")
+{
+}
+
+void
+StatsHelperApplicationIdentifierTestCase::DoRun()
+{
+    NodeContainer nodes;
+    nodes.Create(3);
+    nodes.Get(0)->AddApplication(CreateObject<PacketSink>());
+    nodes.Get(0)->AddApplication(CreateObject<PacketSink>());
+    nodes.Get(1)->AddApplication(CreateObject<PacketSink>());
+    nodes.Get(2)->AddApplication(CreateObject<PacketSink>());
+    const uint32_t id0 = nodes.Get(0)->GetId();
+    const uint32_t id1 = nodes.Get(1)->GetId();
+    const uint32_t id2 = nodes.Get(2)->GetId();
+
+    Ptr<IdentifierTestStatsHelper> helper = CreateObject<IdentifierTestStatsHelper>();
+    helper->SetIdentifierType(StatsHelper::IDENTIFIER_APPLICATION);
+    helper->SetOutputType(StatsHelper::OUTPUT_SCALAR_FILE);
+    helper->InstallNodes(nodes.Get(0));
+    helper->InstallNodes(nodes.Get(1));
+    helper->Install();
+
+    NS_TEST_ASSERT_MSG_EQ(helper->GetNumOfIdentifiers(), 3, "number of identifiers");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetApplicationIdentifier(id0, 0), 0, "node 0 app 0");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetApplicationIdentifier(id0, 1), 1, "node 0 app 1");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetApplicationIdentifier(id1, 0), 2, "node 1 app 0");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetApplicationIdentifier(id0, 2),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "nonexistent application");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetApplicationIdentifier(id2, 0),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "node which is not installed");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetApplicationIdentifier(id2 + 100, 0),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "nonexistent node");
+    helper->Dispose();
+
+    helper = CreateObject<IdentifierTestStatsHelper>();
+    helper->SetIdentifierType(StatsHelper::IDENTIFIER_NODE);
+    helper->SetOutputType(StatsHelper::OUTPUT_SCALAR_FILE);
+    helper->InstallNodes(nodes.Get(0));
+    helper->InstallNodes(nodes.Get(1));
+    helper->Install();
+
+    NS_TEST_ASSERT_MSG_EQ(helper->GetApplicationIdentifier(id0, 1), id0, "node 0 app 1");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetApplicationIdentifier(id1, 0), id1, "node 1 app 0");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetApplicationIdentifier(id2, 0),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "node which is not installed");
+    helper->Dispose();
+
+    Simulator::Destroy();
+
+} // end of `void DoRun ()`
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `stats-helper` test suite. Installs packet sinks listening to
+ * the wildcard address on a node with two interfaces, adds flows towards the
+ * second interface, and verifies the destination determined for each sink and
+ * the identifier of each flow.
+ */
+class StatsHelperFlowIdentifierTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    StatsHelperFlowIdentifierTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class StatsHelperFlowIdentifierTestCase`
+
+StatsHelperFlowIdentifierTestCase::StatsHelperFlowIdentifierTestCase()
+    : TestCase("stats-helper-flow-identifier")
+{
+}
+
+void
+StatsHelperFlowIdentifierTestCase::DoRun()
+{
+    Ptr<Node> node = CreateObject<Node>();
+    InternetStackHelper internet;
+    internet.Install(node);
+
+    SimpleNetDeviceHelper simple;
+    Ipv4AddressHelper address;
+    address.SetBase("10.1.1.0", "255.255.255.0");
+    address.Assign(simple.Install(node));
+    address.SetBase("10.1.2.0", "255.255.255.0");
+    address.Assign(simple.Install(node));
+
+    // Both sinks listen to every address of the node.
+    ApplicationContainer sinks;
+    PacketSinkHelper sink9("ns3::UdpSocketFactory",
+                           InetSocketAddress(Ipv4Address::GetAny(), 9));
+    sinks.Add(sink9.Install(node));
+    PacketSinkHelper sink10("ns3::UdpSocketFactory",
+                            InetSocketAddress(Ipv4Address::GetAny(), 10));
+    sinks.Add(sink10.Install(node));
+
+    StatsHelper::FlowTuple_t anyPortFlow;
+    anyPortFlow.sourceAddress = Ipv4Address("10.1.3.1");
+    anyPortFlow.destinationAddress = Ipv4Address("10.1.2.1");
+    anyPortFlow.sourcePort = 0;
+    anyPortFlow.destinationPort = 9;
+    anyPortFlow.protocol = UdpL4Protocol::PROT_NUMBER;
+    StatsHelper::FlowTuple_t exactFlow = anyPortFlow;
+    exactFlow.sourceAddress = Ipv4Address("10.1.3.2");
+    exactFlow.sourcePort = 5000;
+
+    Ptr<IdentifierTestStatsHelper> helper = CreateObject<IdentifierTestStatsHelper>();
+    helper->SetIdentifierType(StatsHelper::IDENTIFIER_FLOW);
+    helper->SetOutputType(StatsHelper::OUTPUT_SCALAR_FILE);
+    helper->AddFlow(anyPortFlow);
+    helper->AddFlow(exactFlow);
+    helper->InstallNodes(node);
+    helper->Install();
+
+    NS_TEST_ASSERT_MSG_EQ(helper->GetNumOfIdentifiers(), 2, "number of identifiers");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetApplicationIdentifier(node->GetId(), 0),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "applications have no identifier with IDENTIFIER_FLOW");
+
+    // The flows are sent to the second interface, not to the first one.
+    StatsHelper::FlowTuple_t destination;
+    NS_TEST_ASSERT_MSG_EQ(helper->GetFlowDestination(sinks.Get(0), destination),
+                          true,
+                          "destination of the sink on port 9");
+    NS_TEST_ASSERT_MSG_EQ(destination.destinationAddress,
+                          Ipv4Address("10.1.2.1"),
+                          "address matching the added flows");
+    NS_TEST_ASSERT_MSG_EQ(destination.destinationPort, 9, "destination port");
+    NS_TEST_ASSERT_MSG_EQ(static_cast<uint32_t>(destination.protocol),
+                          static_cast<uint32_t>(UdpL4Protocol::PROT_NUMBER),
+                          "protocol");
+
+    destination.sourceAddress = Ipv4Address("10.1.3.1");
+    destination.sourcePort = 49153;
+    NS_TEST_ASSERT_MSG_EQ(helper->GetFlowIdentifier(destination), 0, "any source port");
+    destination.sourceAddress = Ipv4Address("10.1.3.2");
+    destination.sourcePort = 5000;
+    NS_TEST_ASSERT_MSG_EQ(helper->GetFlowIdentifier(destination), 1, "exact source port");
+    destination.sourcePort = 5001;
+    NS_TEST_ASSERT_MSG_EQ(helper->GetFlowIdentifier(destination),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "other source port");
+    destination.sourceAddress = Ipv4Address("10.1.3.3");
+    destination.sourcePort = 49153;
+    NS_TEST_ASSERT_MSG_EQ(helper->GetFlowIdentifier(destination),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "unknown sender");
+
+    // Without a matching flow, the first non-loopback address is used.
+    StatsHelper::FlowTuple_t otherDestination;
+    NS_TEST_ASSERT_MSG_EQ(helper->GetFlowDestination(sinks.Get(1), otherDestination),
+                          true,
+                          "destination of the sink on port 10");
+    NS_TEST_ASSERT_MSG_EQ(otherDestination.destinationAddress,
+                          Ipv4Address("10.1.1.1"),
+                          "first non-loopback address");
+    NS_TEST_ASSERT_MSG_EQ(otherDestination.destinationPort, 10, "destination port");
+
+    helper->Dispose();
+    Simulator::Destroy();
+
+} // end of `void DoRun ()`
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `stats-helper` test suite. Resolves SourceIdTag instances of
+ * installed and other senders, with and without an application index, into
+ * identifiers with `IDENTIFIER_APPLICATION`, `IDENTIFIER_NODE`, and
+ * `IDENTIFIER_GLOBAL`.
+ */
+class StatsHelperSourceIdentifierTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    StatsHelperSourceIdentifierTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    /**
+     * @param identifierType the identifier type of the helper.
+     * @param nodes the nodes installed to the helper.
+     * @return a new helper, already installed.
+     */
+    Ptr<IdentifierTestStatsHelper> CreateHelper(StatsHelper::IdentifierType_t identifierType,
+                                                NodeContainer nodes);
+
+}; // end of `class StatsHelperSourceIdentifierTestCase`
+
+StatsHelperSourceIdentifierTestCase::StatsHelperSourceIdentifierTestCase()
+    : TestCase("stats-helper-source-identifier")
+{
+}
+
+Ptr<IdentifierTestStatsHelper>
+StatsHelperSourceIdentifierTestCase::CreateHelper(StatsHelper::IdentifierType_t identifierType,
+                                                  NodeContainer nodes)
+{
+    Ptr<IdentifierTestStatsHelper> helper = CreateObject<IdentifierTestStatsHelper>();
+    helper->SetIdentifierType(identifierType);
+    helper->SetOutputType(StatsHelper::OUTPUT_SCALAR_FILE);
+    helper->InstallNodes(nodes);
+    helper->Install();
+    return helper;
+}
+
+void
+StatsHelperSourceIdentifierTestCase::DoRun()
+{
+    NodeContainer nodes;
+    nodes.Create(2);
+    nodes.Get(0)->AddApplication(CreateObject<PacketSink>());
+    nodes.Get(0)->AddApplication(CreateObject<PacketSink>());
+    nodes.Get(1)->AddApplication(CreateObject<PacketSink>());
+    Ptr<Node> other = CreateObject<Node>();
+    other->AddApplication(CreateObject<PacketSink>());
+    const uint32_t id0 = nodes.Get(0)->GetId();
+    const uint32_t id1 = nodes.Get(1)->GetId();
+    const uint32_t otherId = other->GetId();
+
+    // The tag packs both fields into a single source ID.
+    SourceIdTag tag(id1, 0);
+    NS_TEST_ASSERT_MSG_EQ(tag.GetNodeId(), id1, "node ID");
+    NS_TEST_ASSERT_MSG_EQ(tag.GetApplicationIndex(), 0, "application index");
+    NS_TEST_ASSERT_MSG_EQ(SourceIdTag().GetApplicationIndex(),
+                          SourceIdTag::ANY_APPLICATION,
+                          "default application index");
+
+    Ptr<IdentifierTestStatsHelper> helper =
+        CreateHelper(StatsHelper::IDENTIFIER_APPLICATION, nodes);
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(id0, 1)),
+                          helper->GetApplicationIdentifier(id0, 1),
+                          "application of node 0");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(id1, 0)),
+                          2,
+                          "application of node 1");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(id0, 2)),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "beyond the last application of node 0");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(id1, 1)),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "beyond the last application of node 1");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(id1)),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "a node is not an application");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(otherId, 0)),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "sender which is not installed");
+    helper->Dispose();
+
+    helper = CreateHelper(StatsHelper::IDENTIFIER_NODE, nodes);
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(id0, 1)),
+                          id0,
+                          "application of node 0");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(id1)), id1, "node 1");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(id0, 2)),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "beyond the last application of node 0");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(otherId)),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "sender which is not installed");
+    helper->Dispose();
+
+    helper = CreateHelper(StatsHelper::IDENTIFIER_GLOBAL, nodes);
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(id0)), 0, "node 0");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(id1, 0)),
+                          0,
+                          "application of node 1");
+    NS_TEST_ASSERT_MSG_EQ(helper->GetSourceIdentifier(SourceIdTag(otherId)),
+                          StatsHelper::INVALID_IDENTIFIER,
+                          "sender which is not installed");
+    helper->Dispose();
+
+    Simulator::Destroy();
+
+} // end of `void DoRun ()`
+
+/**
+ * @ingroup stats
+ * @brief A helper which connects a single trace sink, counting the samples
+ *        received through it.
+ */
+class EnabledTestStatsHelper : public StatsHelper
+{
+  public:
+    /// Creates a helper without any source.
+    EnabledTestStatsHelper();
+
+    /**
+     * @param source a UnitConversionCollector, whose `OutputValue` trace
+     *               source is connected by Install().
+     */
+    void SetSource(Ptr<UnitConversionCollector> source);
+
+    /**
+     * @return the number of samples received so far.
+     */
+    uint32_t GetNumOfSamples() const;
+
+  protected:
+    // inherited from StatsHelper base class
+    virtual void DoInstall();
+
+  private:
+    /**
+     * @brief Trace sink for the `OutputValue` trace source of the source.
+     * @param value the sample.
+     */
+    void SampleCallback(double value);
+
+    Ptr<UnitConversionCollector> m_source; ///< The source of the samples.
+    uint32_t m_numOfSamples;               ///< The number of samples received so far.
+
+}; // end of `class EnabledTestStatsHelper`
+
+EnabledTestStatsHelper::EnabledTestStatsHelper()
+    : m_source(nullptr),
+      m_numOfSamples(0)
+{
+}
+
+void
+EnabledTestStatsHelper::SetSource(Ptr<UnitConversionCollector> source)
+{
+    m_source = source;
+}
+
+uint32_t
+EnabledTestStatsHelper::GetNumOfSamples() const
+{
+    return m_numOfSamples;
+}
+
+void
+EnabledTestStatsHelper::DoInstall()
+{
+    ConnectTraceSource(m_source,
+                       "OutputValue",
+                       MakeCallback(&EnabledTestStatsHelper::SampleCallback, this));
+}
+
+void
+EnabledTestStatsHelper::SampleCallback(double value)
+{
+    m_numOfSamples++;
+}
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `stats-helper` test suite. Toggles SetEnabled() of a helper
+ * connected to a trace source, before and after Install(), and verifies that
+ * the helper receives the samples only while enabled, that enabling twice
+ * does not connect the trace sink twice, and that disposing the helper
+ * disconnects it.
+ */
+class StatsHelperEnabledTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    StatsHelperEnabledTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class StatsHelperEnabledTestCase`
+
+StatsHelperEnabledTestCase::StatsHelperEnabledTestCase()
+    : TestCase("stats-helper-enabled")
+{
+}
+
+void
+StatsHelperEnabledTestCase::DoRun()
+{
+    Ptr<UnitConversionCollector> source = CreateObject<UnitConversionCollector>();
+
+    Ptr<EnabledTestStatsHelper> helper = CreateObject<EnabledTestStatsHelper>();
+    helper->SetOutputType(StatsHelper::OUTPUT_SCALAR_FILE);
+    helper->SetSource(source);
+    helper->Install();
+
+    // Disabled before Install(), so the connection is only remembered.
+    Ptr<EnabledTestStatsHelper> lateHelper = CreateObject<EnabledTestStatsHelper>();
+    lateHelper->SetOutputType(StatsHelper::OUTPUT_SCALAR_FILE);
+    lateHelper->SetSource(source);
+    lateHelper->SetEnabled(false);
+    lateHelper->Install();
+
+    source->TraceSinkDouble(0.0, 1.0);
+    NS_TEST_ASSERT_MSG_EQ(helper->GetNumOfSamples(), 1, "Sample not received");
+    NS_TEST_ASSERT_MSG_EQ(lateHelper->GetNumOfSamples(), 0, "Sample received while disabled");
+
+    helper->SetEnabled(false);
+    helper->SetEnabled(false);
+    NS_TEST_ASSERT_MSG_EQ(helper->IsEnabled(), false, "Helper not disabled");
+    source->TraceSinkDouble(0.0, 2.0);
+    NS_TEST_ASSERT_MSG_EQ(helper->GetNumOfSamples(), 1, "Sample received while disabled");
+
+    // Enabling twice connects the trace sink only once.
+    helper->SetEnabled(true);
+    helper->SetEnabled(true);
+    lateHelper->SetEnabled(true);
+    source->TraceSinkDouble(0.0, 3.0);
+    NS_TEST_ASSERT_MSG_EQ(helper->GetNumOfSamples(), 2, "Wrong samples after reconnecting");
+    NS_TEST_ASSERT_MSG_EQ(lateHelper->GetNumOfSamples(), 1, "Wrong samples after connecting");
+
+    helper->Dispose();
+    source->TraceSinkDouble(0.0, 4.0);
+    NS_TEST_ASSERT_MSG_EQ(helper->GetNumOfSamples(), 2, "Sample received after disposal");
+    NS_TEST_ASSERT_MSG_EQ(lateHelper->GetNumOfSamples(), 2, "Sample not received");
+
+    lateHelper->Dispose();
+    source->Dispose();
+    Simulator::Destroy();
+
+} // end of `void DoRun ()`
+
+/**
+ * @brief Test suite `stats-helper`, verifying the identifier lookups and
+ *        SetEnabled() of the StatsHelper class.
+ */
+class StatsHelperTestSuite : public TestSuite
+{
+  public:
+    StatsHelperTestSuite();
+};
+
+StatsHelperTestSuite::StatsHelperTestSuite()
+    : TestSuite("stats-helper", Type::UNIT)
+{
+    AddTestCase(new StatsHelperApplicationIdentifierTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new StatsHelperFlowIdentifierTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new StatsHelperSourceIdentifierTestCase(), TestCase::Duration::QUICK);
+    AddTestCase(new StatsHelperEnabledTestCase(), TestCase::Duration::QUICK);
+
+} // end of `StatsHelperTestSuite ()`
+
+static StatsHelperTestSuite g_statsHelperTestSuiteInstance;
+
+} // end of namespace ns3
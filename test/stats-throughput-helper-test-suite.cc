@@ -0,0 +1,180 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * @file stats-throughput-helper-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for StatsThroughputHelper.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=stats-throughput-helper
+ * @endcode
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/stats-throughput-helper.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+NS_LOG_COMPONENT_DEFINE("StatsThroughputHelperTest");
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ * @brief A throughput helper whose samples are given by the test cases
+ *        instead of applications.
+ */
+class ThroughputTestHelper : public StatsAppThroughputHelper
+{
+  public:
+    /**
+     * @brief Pass a received packet to the collector of an identifier.
+     * @param identifier the identifier, i.e., the node ID.
+     * @param bytes the size of the packet.
+     */
+    void AddSample(uint32_t identifier, uint32_t bytes);
+
+}; // end of `class ThroughputTestHelper`
+
+void
+ThroughputTestHelper::AddSample(uint32_t identifier, uint32_t bytes)
+{
+    PassSampleToCollector(identifier, bytes);
+}
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `stats-throughput-helper` test suite. Runs a scalar throughput
+ * helper per node twice, with and without the `FusedPipeline` attribute, and
+ * verifies that the fused CollectorBank writes the same output file as the
+ * per-identifier UnitConversionCollector and ScalarCollector instances. The
+ * nodes receive several samples, a single sample, and no sample at all.
+ */
+class StatsThroughputHelperFusedPipelineTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    StatsThroughputHelperFusedPipelineTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    /**
+     * @brief Install the helper and run the simulation.
+     * @param outputPath the directory of the output file.
+     * @param isFused the value of the `FusedPipeline` attribute.
+     */
+    void RunSimulation(std::string outputPath, bool isFused);
+
+}; // end of `class StatsThroughputHelperFusedPipelineTestCase`
+
+StatsThroughputHelperFusedPipelineTestCase::StatsThroughputHelperFusedPipelineTestCase()
+    : TestCase("stats-throughput-helper-fused-pipeline")
+{
+}
+
+void
+StatsThroughputHelperFusedPipelineTestCase::RunSimulation(std::string outputPath, bool isFused)
+{
+    NodeContainer nodes;
+    nodes.Create(3);
+
+    Ptr<ThroughputTestHelper> helper = CreateObject<ThroughputTestHelper>();
+    helper->SetName("throughput-scalar");
+    helper->SetAttribute("OutputPath", StringValue(outputPath));
+    helper->SetAttribute("FusedPipeline", BooleanValue(isFused));
+    helper->SetIdentifierType(StatsHelper::IDENTIFIER_NODE);
+    helper->SetOutputType(StatsHelper::OUTPUT_SCALAR_FILE);
+    helper->InstallNodes(nodes);
+    helper->Install();
+
+    // The first node has several samples, the second one a single sample, and
+    // the third one none.
+    const double times[] = {0.5, 1.25, 2.0, 3.75};
+    const uint32_t nodeIndices[] = {0, 1, 0, 0};
+    const uint32_t sizes[] = {1000, 1500, 3000, 512};
+    for (uint32_t k = 0; k < 4; k++)
+    {
+        Simulator::Schedule(Seconds(times[k]),
+                            &ThroughputTestHelper::AddSample,
+                            helper,
+                            nodes.Get(nodeIndices[k])->GetId(),
+                            sizes[k]);
+    }
+
+    Simulator::Stop(Seconds(5));
+    Simulator::Run();
+
+    // The output is written when the collectors and aggregators are released.
+    helper->Dispose();
+    helper = nullptr;
+    Simulator::Destroy();
+}
+
+void
+StatsThroughputHelperFusedPipelineTestCase::DoRun()
+{
+    const std::string separatePath = CreateTempDirFilename("throughput-separate");
+    const std::string fusedPath = CreateTempDirFilename("throughput-fused");
+
+    RunSimulation(separatePath, false);
+    RunSimulation(fusedPath, true);
+
+    std::ifstream separateFile(separatePath + "/throughput-scalar.txt");
+    std::ostringstream separate;
+    separate << separateFile.rdbuf();
+    std::ifstream fusedFile(fusedPath + "/throughput-scalar.txt");
+    std::ostringstream fused;
+    fused << fusedFile.rdbuf();
+
+    NS_TEST_ASSERT_MSG_EQ(separate.str().empty(), false, "Missing output");
+    NS_TEST_ASSERT_MSG_EQ(fused.str(), separate.str(), "Wrong output of the fused pipeline");
+}
+
+/**
+ * @brief Test suite `stats-throughput-helper`, verifying the
+ *        StatsThroughputHelper class.
+ */
+class StatsThroughputHelperTestSuite : public TestSuite
+{
+  public:
+    StatsThroughputHelperTestSuite();
+};
+
+StatsThroughputHelperTestSuite::StatsThroughputHelperTestSuite()
+    : TestSuite("stats-throughput-helper", Type::UNIT)
+{
+    // LogComponentEnable ("StatsThroughputHelperTest", LOG_LEVEL_ALL);
+    // LogComponentEnable ("StatsThroughputHelper", LOG_LEVEL_ALL);
+
+    AddTestCase(new StatsThroughputHelperFusedPipelineTestCase(), TestCase::Duration::QUICK);
+
+} // end of `StatsThroughputHelperTestSuite ()`
+
+static StatsThroughputHelperTestSuite g_statsThroughputHelperTestSuiteInstance;
+
+} // end of namespace ns3
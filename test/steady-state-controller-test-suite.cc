@@ -0,0 +1,184 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+/**
+ * @file steady-state-controller-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for SteadyStateController.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=steady-state-controller
+ * @endcode
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/scalar-collector.h"
+#include "ns3/steady-state-controller.h"
+
+#include <cmath>
+#include <sstream>
+#include <string>
+
+NS_LOG_COMPONENT_DEFINE("SteadyStateControllerTest");
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `steady-state-controller` test suite. Feeds a ScalarCollector
+ * registered by AddScalarCollector() with a stationary series whose sum
+ * alternates between 11 and 10 in successive intervals of 1 second, and
+ * verifies that the controller stops the simulation once `MinNumOfBatches`
+ * observations are available, and reports the expected confidence interval.
+ */
+class SteadyStateControllerScalarTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    SteadyStateControllerScalarTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    /**
+     * @brief Trace sink for the `SteadyState` trace source of the controller.
+     * @param time the simulation time in seconds.
+     */
+    void SteadyStateCallback(double time);
+
+    /**
+     * @brief Trace sink for the `OutputString` trace source of the controller.
+     * @param output the summary of the statistics.
+     */
+    void OutputStringCallback(std::string output);
+
+    double m_steadyStateTime; ///< The time given to SteadyStateCallback().
+    std::string m_output;     ///< The summary given to OutputStringCallback().
+
+}; // end of `class SteadyStateControllerScalarTestCase`
+
+SteadyStateControllerScalarTestCase::SteadyStateControllerScalarTestCase()
+    : TestCase("steady-state-controller-scalar"),
+      m_steadyStateTime(-1.0),
+      m_output()
+{
+}
+
+void
+SteadyStateControllerScalarTestCase::SteadyStateCallback(double time)
+{
+    m_steadyStateTime = time;
+}
+
+void
+SteadyStateControllerScalarTestCase::OutputStringCallback(std::string output)
+{
+    m_output = output;
+}
+
+void
+SteadyStateControllerScalarTestCase::DoRun()
+{
+    Ptr<ScalarCollector> collector = CreateObject<ScalarCollector>();
+    collector->SetOutputType(ScalarCollector::OUTPUT_TYPE_SUM);
+
+    // One sample in the middle of every interval: 11, 10, 11, 10, ...
+    for (uint32_t k = 1; k <= 100; k++)
+    {
+        Simulator::Schedule(Seconds(k - 0.5),
+                            &ScalarCollector::TraceSinkDouble,
+                            collector,
+                            0.0,
+                            10.0 + (k % 2));
+    }
+
+    Ptr<SteadyStateController> controller = CreateObject<SteadyStateController>();
+    controller->SetAttribute("MinNumOfBatches", UintegerValue(10));
+    controller->SetAttribute("Interval", TimeValue(Seconds(1)));
+    controller->TraceConnectWithoutContext(
+        "SteadyState",
+        MakeCallback(&SteadyStateControllerScalarTestCase::SteadyStateCallback, this));
+    controller->TraceConnectWithoutContext(
+        "OutputString",
+        MakeCallback(&SteadyStateControllerScalarTestCase::OutputStringCallback, this));
+    controller->AddScalarCollector("sum", collector);
+
+    Simulator::Stop(Seconds(100));
+    Simulator::Run();
+
+    // The 10 observations of the first 10 seconds form 10 batches of one
+    // observation, whose relative half-width is already below 5%.
+    NS_TEST_ASSERT_MSG_EQ(controller->IsSteadyState(), true, "Statistic must have converged");
+    NS_TEST_ASSERT_MSG_EQ_TOL(m_steadyStateTime, 10.0, 1e-9, "Wrong convergence time");
+    NS_TEST_ASSERT_MSG_EQ_TOL(Simulator::Now().GetSeconds(), 10.0, 1e-9, "Wrong stop time");
+
+    controller->Dispose();
+
+    // The observations have a sample standard deviation of sqrt(2.5/9), and
+    // t(0.975, 9) = 2.2622.
+    const std::string prefix = "% sum: ";
+    const std::string::size_type pos = m_output.find(prefix);
+    NS_TEST_ASSERT_MSG_NE(pos, std::string::npos, "Missing statistic in " << m_output);
+
+    std::istringstream iss(m_output.substr(pos + prefix.size()));
+    double mean = 0.0;
+    std::string plusMinus;
+    double halfWidth = 0.0;
+    iss >> mean >> plusMinus >> halfWidth;
+    NS_TEST_ASSERT_MSG_EQ_TOL(mean, 10.5, 1e-9, "Wrong mean");
+    NS_TEST_ASSERT_MSG_EQ_TOL(halfWidth,
+                              2.2622 * std::sqrt(2.5 / 9.0) / std::sqrt(10.0),
+                              0.001,
+                              "Wrong half-width");
+    NS_TEST_ASSERT_MSG_NE(m_output.find("(10 batches, converged)"),
+                          std::string::npos,
+                          "Wrong status in " << m_output);
+
+    collector->Dispose();
+    Simulator::Destroy();
+}
+
+/**
+ * @brief Test suite `steady-state-controller`, verifying the
+ *        SteadyStateController class.
+ */
+class SteadyStateControllerTestSuite : public TestSuite
+{
+  public:
+    SteadyStateControllerTestSuite();
+};
+
+SteadyStateControllerTestSuite::SteadyStateControllerTestSuite()
+    : TestSuite("steady-state-controller", Type::UNIT)
+{
+    // LogComponentEnable ("SteadyStateControllerTest", LOG_LEVEL_ALL);
+    // LogComponentEnable ("SteadyStateController", LOG_LEVEL_ALL);
+
+    AddTestCase(new SteadyStateControllerScalarTestCase(), TestCase::Duration::QUICK);
+
+} // end of `SteadyStateControllerTestSuite ()`
+
+static SteadyStateControllerTestSuite g_steadyStateControllerTestSuiteInstance;
+
+} // end of namespace ns3
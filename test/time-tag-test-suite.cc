@@ -0,0 +1,208 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+/**
+ * @file time-tag-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for LayerTimestampTag.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=time-tag
+ * @endcode
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/time-tag.h"
+
+#include <limits>
+#include <stdint.h>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("TimeTagTest");
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `time-tag` test suite. Serializes LayerTimestampTag instances
+ * carrying every subset of the layers, with positive and negative differences
+ * between the layers and with the extreme time stamps which take 10-byte
+ * variable-length integers, and verifies that Serialize(), Deserialize(), and
+ * GetSerializedSize() agree.
+ */
+class LayerTimestampTagSerializationTestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    LayerTimestampTagSerializationTestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    /**
+     * @brief Serialize a tag and deserialize it into another tag, verifying
+     *        the number of bytes written and the time stamps read back.
+     * @param tag the tag to verify.
+     * @param expectedSize the expected serialized size, or zero to skip
+     *                     verifying the size itself.
+     */
+    void VerifyRoundTrip(const LayerTimestampTag& tag, uint32_t expectedSize);
+
+}; // end of `class LayerTimestampTagSerializationTestCase`
+
+LayerTimestampTagSerializationTestCase::LayerTimestampTagSerializationTestCase()
+    : TestCase("layer-timestamp-tag-serialization")
+{
+}
+
+void
+LayerTimestampTagSerializationTestCase::VerifyRoundTrip(const LayerTimestampTag& tag,
+                                                        uint32_t expectedSize)
+{
+    const uint32_t size = tag.GetSerializedSize();
+    if (expectedSize > 0)
+    {
+        NS_TEST_ASSERT_MSG_EQ(size, expectedSize, "serialized size");
+    }
+
+    /*
+     * Serialize twice, into buffers filled with different values. Exactly the
+     * first `size` bytes are written when they are equal in both buffers and
+     * the spare bytes after them are untouched.
+     */
+    const uint32_t spare = 16;
+    std::vector<uint8_t> zeros(size + spare, 0x00);
+    std::vector<uint8_t> ones(size + spare, 0xFF);
+    tag.Serialize(TagBuffer(zeros.data(), zeros.data() + zeros.size()));
+    tag.Serialize(TagBuffer(ones.data(), ones.data() + ones.size()));
+
+    for (uint32_t j = 0; j < size; j++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(static_cast<uint32_t>(zeros[j]),
+                              static_cast<uint32_t>(ones[j]),
+                              "byte " << j << " of " << size << " is not written");
+    }
+
+    for (uint32_t j = size; j < size + spare; j++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(static_cast<uint32_t>(zeros[j]),
+                              0,
+                              "byte " << j << " is written beyond the serialized size " << size);
+        NS_TEST_ASSERT_MSG_EQ(static_cast<uint32_t>(ones[j]),
+                              0xFF,
+                              "byte " << j << " is written beyond the serialized size " << size);
+    }
+
+    LayerTimestampTag other;
+    other.Deserialize(TagBuffer(ones.data(), ones.data() + ones.size()));
+    NS_TEST_ASSERT_MSG_EQ(other.GetSerializedSize(), size, "size after deserialization");
+
+    for (uint32_t layer = 0; layer < LayerTimestampTag::LAYER_COUNT; layer++)
+    {
+        const LayerTimestampTag::Layer_t l = static_cast<LayerTimestampTag::Layer_t>(layer);
+        NS_TEST_ASSERT_MSG_EQ(other.HasTimestamp(l),
+                              tag.HasTimestamp(l),
+                              "presence of " << LayerTimestampTag::GetLayerName(l));
+        NS_TEST_ASSERT_MSG_EQ(other.GetTimestamp(l).GetTimeStep(),
+                              tag.GetTimestamp(l).GetTimeStep(),
+                              "time stamp of " << LayerTimestampTag::GetLayerName(l));
+    }
+
+} // end of `void VerifyRoundTrip (const LayerTimestampTag &, uint32_t);`
+
+void
+LayerTimestampTagSerializationTestCase::DoRun()
+{
+    const int64_t minStep = std::numeric_limits<int64_t>::min();
+    const int64_t maxStep = std::numeric_limits<int64_t>::max();
+
+    // An empty tag is only the presence bitmask.
+    VerifyRoundTrip(LayerTimestampTag(), 1);
+
+    /*
+     * Every subset of the layers. The later layers are stamped both after and
+     * before the earlier ones, so the differences are positive and negative.
+     */
+    const int64_t base = Seconds(12.5).GetTimeStep();
+    const int64_t offsets[LayerTimestampTag::LAYER_COUNT] = {0, 1500, -250, -7};
+
+    for (uint32_t layers = 0; layers < (1u << LayerTimestampTag::LAYER_COUNT); layers++)
+    {
+        LayerTimestampTag tag;
+        for (uint32_t layer = 0; layer < LayerTimestampTag::LAYER_COUNT; layer++)
+        {
+            if ((layers & (1u << layer)) != 0)
+            {
+                tag.SetTimestamp(static_cast<LayerTimestampTag::Layer_t>(layer),
+                                 TimeStep(base + offsets[layer]));
+            }
+        }
+        VerifyRoundTrip(tag, 0);
+    }
+
+    // The extreme time stamps take 10-byte variable-length integers.
+    LayerTimestampTag minTag;
+    minTag.SetTimestamp(LayerTimestampTag::LAYER_DEV, TimeStep(minStep));
+    VerifyRoundTrip(minTag, 1 + 10);
+
+    LayerTimestampTag maxTag;
+    maxTag.SetTimestamp(LayerTimestampTag::LAYER_PHY, TimeStep(maxStep));
+    VerifyRoundTrip(maxTag, 1 + 10);
+
+    // The difference of the extremes wraps around without an overflow.
+    LayerTimestampTag extremeTag;
+    extremeTag.SetTimestamp(LayerTimestampTag::LAYER_APPLICATION, TimeStep(minStep));
+    extremeTag.SetTimestamp(LayerTimestampTag::LAYER_DEV, TimeStep(maxStep));
+    extremeTag.SetTimestamp(LayerTimestampTag::LAYER_MAC, TimeStep(0));
+    extremeTag.SetTimestamp(LayerTimestampTag::LAYER_PHY, TimeStep(-1));
+    VerifyRoundTrip(extremeTag, 0);
+
+    LayerTimestampTag reverseTag;
+    reverseTag.SetTimestamp(LayerTimestampTag::LAYER_APPLICATION, TimeStep(maxStep));
+    reverseTag.SetTimestamp(LayerTimestampTag::LAYER_MAC, TimeStep(minStep));
+    reverseTag.SetTimestamp(LayerTimestampTag::LAYER_PHY, TimeStep(1));
+    VerifyRoundTrip(reverseTag, 0);
+
+} // end of `void DoRun ()`
+
+/**
+ * @brief Test suite `time-tag`, verifying the LayerTimestampTag class.
+ */
+class TimeTagTestSuite : public TestSuite
+{
+  public:
+    TimeTagTestSuite();
+};
+
+TimeTagTestSuite::TimeTagTestSuite()
+    : TestSuite("time-tag", Type::UNIT)
+{
+    AddTestCase(new LayerTimestampTagSerializationTestCase(), TestCase::Duration::QUICK);
+
+} // end of `TimeTagTestSuite ()`
+
+static TimeTagTestSuite g_timeTagTestSuiteInstance;
+
+} // end of namespace ns3
@@ -0,0 +1,347 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2026 Magister Solutions
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * @file unit-conversion-collector-test-suite.cc
+ * @ingroup stats
+ * @brief Test cases for UnitConversionCollector.
+ *
+ * Usage example:
+ * @code
+ *    $ ./test.py --suite=unit-conversion-collector
+ * @endcode
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/interval-rate-collector.h"
+#include "ns3/scalar-collector.h"
+#include "ns3/unit-conversion-collector.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE("UnitConversionCollectorTest");
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `unit-conversion-collector` test suite. Verifies the error bound
+ * of UnitConversionCollector::ApproximateLog10() against `std::log10` over the
+ * whole range of positive normal values, i.e., 64 mantissas and both sides of
+ * the `sqrt(2)` split point in every binary exponent, and then the same bound
+ * in decibel through the approximate dB and dBm paths of ConvertBatch(), both
+ * the static one and the one of a collector instance.
+ */
+class ApproximateLog10TestCase : public TestCase
+{
+  public:
+    /// Construct a new test case.
+    ApproximateLog10TestCase();
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+}; // end of `class ApproximateLog10TestCase`
+
+ApproximateLog10TestCase::ApproximateLog10TestCase()
+    : TestCase("approximate-log10")
+{
+}
+
+void
+ApproximateLog10TestCase::DoRun()
+{
+    std::vector<double> input;
+    for (int e = DBL_MIN_EXP - 1; e < DBL_MAX_EXP; e++)
+    {
+        for (uint32_t j = 0; j < 64; j++)
+        {
+            input.push_back(std::ldexp(1.0 + j / 64.0, e));
+        }
+        input.push_back(std::ldexp(std::nextafter(std::sqrt(2.0), 0.0), e));
+        input.push_back(std::ldexp(std::sqrt(2.0), e));
+    }
+    input.push_back(DBL_MIN);
+    input.push_back(DBL_MAX);
+
+    double maxError = 0.0;
+    double maxErrorInput = 0.0;
+    for (const double x : input)
+    {
+        const double approximate = UnitConversionCollector::ApproximateLog10(x);
+        const double error = std::fabs(approximate - std::log10(x));
+        if (!(error <= maxError)) // also catches nan
+        {
+            maxError = error;
+            maxErrorInput = x;
+        }
+    }
+    NS_LOG_INFO("Largest error of ApproximateLog10: " << maxError << " at " << maxErrorInput);
+    NS_TEST_ASSERT_MSG_LT(maxError,
+                          4e-10,
+                          "ApproximateLog10 (" << maxErrorInput << ") is off by " << maxError);
+
+    // The same bound, multiplied by 10, through the dB and dBm conversions.
+    const uint32_t n = input.size();
+    std::vector<double> output(n);
+    UnitConversionCollector::ConvertBatch(UnitConversionCollector::FROM_LINEAR_TO_DB,
+                                          input.data(),
+                                          output.data(),
+                                          n,
+                                          true);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(output[i],
+                                  10.0 * std::log10(input[i]),
+                                  4e-9,
+                                  "Wrong dB value of " << input[i]);
+    }
+
+    // 1000 * x overflows for the largest inputs, so the reference adds 30 dB.
+    Ptr<UnitConversionCollector> collector = CreateObject<UnitConversionCollector>();
+    collector->SetConversionType(UnitConversionCollector::FROM_LINEAR_TO_DBM);
+    collector->SetApproximateLogarithm(true);
+    collector->ConvertBatch(input.data(), output.data(), n);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ_TOL(output[i],
+                                  10.0 * std::log10(input[i]) + 30.0,
+                                  4e-9,
+                                  "Wrong dBm value of " << input[i]);
+    }
+}
+
+/**
+ * @ingroup stats
+ * @brief A UnitConversionCollector connected to a ScalarCollector and an
+ *        IntervalRateCollector, recording their output.
+ */
+class ConversionPipeline
+{
+  public:
+    /**
+     * @brief Create the collectors and connect them.
+     * @param conversionType the conversion type.
+     * @param isDeferred whether the linear conversions are deferred to the
+     *                   `Scale` attribute of the downstream collectors.
+     */
+    ConversionPipeline(UnitConversionCollector::ConversionType_t conversionType, bool isDeferred);
+
+    /**
+     * @brief Trace sink for the `Output` trace source of the ScalarCollector.
+     * @param value the output.
+     */
+    void ScalarOutputCallback(double value);
+
+    /**
+     * @brief Trace sink for the `OutputWithoutTime` trace source of the
+     *        IntervalRateCollector.
+     * @param value the output of an interval.
+     */
+    void IntervalOutputCallback(double value);
+
+    Ptr<UnitConversionCollector> m_conversion; ///< The first-level collector.
+    Ptr<ScalarCollector> m_scalar;             ///< The second-level scalar collector.
+    Ptr<IntervalRateCollector> m_interval;     ///< The second-level interval collector.
+    double m_scalarOutput;                     ///< The output of the scalar collector.
+    std::vector<double> m_intervalOutput;      ///< The outputs of the interval collector.
+
+}; // end of `class ConversionPipeline`
+
+ConversionPipeline::ConversionPipeline(UnitConversionCollector::ConversionType_t conversionType,
+                                       bool isDeferred)
+    : m_scalarOutput(-1.0)
+{
+    m_conversion = CreateObject<UnitConversionCollector>();
+    m_conversion->SetConversionType(conversionType);
+    m_conversion->SetDeferLinearConversion(isDeferred);
+
+    // The scale completing a deferred conversion, as used by the helpers.
+    const double scale =
+        (isDeferred && m_conversion->IsLinearConversion()) ? m_conversion->GetConversionScale()
+                                                           : 1.0;
+
+    m_scalar = CreateObject<ScalarCollector>();
+    m_scalar->SetInputDataType(ScalarCollector::INPUT_DATA_TYPE_DOUBLE);
+    m_scalar->SetOutputType(ScalarCollector::OUTPUT_TYPE_AVERAGE_PER_SECOND);
+    m_scalar->SetScale(scale);
+    m_scalar->TraceConnectWithoutContext(
+        "Output",
+        MakeCallback(&ConversionPipeline::ScalarOutputCallback, this));
+
+    m_interval = CreateObject<IntervalRateCollector>();
+    m_interval->SetInputDataType(IntervalRateCollector::INPUT_DATA_TYPE_DOUBLE);
+    m_interval->SetAttribute("Scale", DoubleValue(scale));
+    m_interval->TraceConnectWithoutContext(
+        "OutputWithoutTime",
+        MakeCallback(&ConversionPipeline::IntervalOutputCallback, this));
+
+    m_conversion->TraceConnectWithoutContext(
+        "Output",
+        MakeCallback(&ScalarCollector::TraceSinkDouble, m_scalar));
+    m_conversion->TraceConnectWithoutContext(
+        "Output",
+        MakeCallback(&IntervalRateCollector::TraceSinkDouble, m_interval));
+}
+
+void
+ConversionPipeline::ScalarOutputCallback(double value)
+{
+    m_scalarOutput = value;
+}
+
+void
+ConversionPipeline::IntervalOutputCallback(double value)
+{
+    m_intervalOutput.push_back(value);
+}
+
+/**
+ * @ingroup stats
+ *
+ * Part of the `unit-conversion-collector` test suite. Feeds the same samples
+ * to two pipelines of a UnitConversionCollector followed by a ScalarCollector
+ * and an IntervalRateCollector: one converting every sample, and one with
+ * `DeferLinearConversion` and the factor of the conversion in the `Scale`
+ * attribute of the downstream collectors. Verifies that both pipelines emit
+ * the same output, and that a non-linear conversion is not deferred.
+ */
+class DeferLinearConversionTestCase : public TestCase
+{
+  public:
+    /**
+     * @brief Construct a new test case.
+     * @param conversionType the conversion type.
+     */
+    DeferLinearConversionTestCase(UnitConversionCollector::ConversionType_t conversionType);
+
+  private:
+    // inherited from TestCase base class
+    virtual void DoRun();
+
+    UnitConversionCollector::ConversionType_t m_conversionType; ///< The conversion type.
+
+}; // end of `class DeferLinearConversionTestCase`
+
+DeferLinearConversionTestCase::DeferLinearConversionTestCase(
+    UnitConversionCollector::ConversionType_t conversionType)
+    : TestCase("defer-linear-conversion-" +
+               UnitConversionCollector::GetConversionTypeName(conversionType)),
+      m_conversionType(conversionType)
+{
+}
+
+void
+DeferLinearConversionTestCase::DoRun()
+{
+    ConversionPipeline perSample(m_conversionType, false);
+    ConversionPipeline deferred(m_conversionType, true);
+
+    // Two samples in the first interval, none in the second one.
+    const double times[] = {0.25, 0.5, 2.75};
+    const uint32_t values[] = {1500, 40, 1000};
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        Simulator::Schedule(Seconds(times[i]),
+                            &UnitConversionCollector::TraceSinkUinteger32,
+                            perSample.m_conversion,
+                            0,
+                            values[i]);
+        Simulator::Schedule(Seconds(times[i]),
+                            &UnitConversionCollector::TraceSinkUinteger32,
+                            deferred.m_conversion,
+                            0,
+                            values[i]);
+    }
+
+    Simulator::Stop(Seconds(3.5));
+    Simulator::Run();
+
+    for (ConversionPipeline* pipeline : {&perSample, &deferred})
+    {
+        pipeline->m_conversion->Dispose();
+        pipeline->m_scalar->Dispose();
+        pipeline->m_interval->Dispose();
+    }
+    Simulator::Destroy();
+
+    // The scale is applied to the sum instead of to every sample, so the
+    // outputs differ only by rounding.
+    const double expected = perSample.m_scalarOutput;
+    NS_TEST_ASSERT_MSG_GT(expected, 0.0, "No output of the scalar collector");
+    NS_TEST_ASSERT_MSG_EQ_TOL(deferred.m_scalarOutput,
+                              expected,
+                              1e-12 * expected,
+                              "Wrong scalar output of the deferred conversion");
+
+    NS_TEST_ASSERT_MSG_EQ(perSample.m_intervalOutput.size(), 3, "Wrong number of intervals");
+    NS_TEST_ASSERT_MSG_EQ(deferred.m_intervalOutput.size(),
+                          perSample.m_intervalOutput.size(),
+                          "Wrong number of intervals of the deferred conversion");
+    for (uint32_t i = 0; i < perSample.m_intervalOutput.size(); i++)
+    {
+        const double expectedInterval = perSample.m_intervalOutput[i];
+        NS_TEST_ASSERT_MSG_EQ_TOL(deferred.m_intervalOutput[i],
+                                  expectedInterval,
+                                  1e-12 * std::max(1.0, std::fabs(expectedInterval)),
+                                  "Wrong output of interval " << i
+                                                              << " of the deferred conversion");
+    }
+}
+
+/**
+ * @brief Test suite `unit-conversion-collector`, verifying the
+ *        UnitConversionCollector class.
+ */
+class UnitConversionCollectorTestSuite : public TestSuite
+{
+  public:
+    UnitConversionCollectorTestSuite();
+};
+
+UnitConversionCollectorTestSuite::UnitConversionCollectorTestSuite()
+    : TestSuite("unit-conversion-collector", Type::UNIT)
+{
+    // LogComponentEnable ("UnitConversionCollectorTest", LOG_LEVEL_ALL);
+    // LogComponentEnable ("UnitConversionCollector", LOG_LEVEL_ALL);
+
+    AddTestCase(new ApproximateLog10TestCase(), TestCase::Duration::QUICK);
+
+    const UnitConversionCollector::ConversionType_t conversionTypes[] = {
+        UnitConversionCollector::FROM_BYTES_TO_BIT,
+        UnitConversionCollector::FROM_BYTES_TO_KBIT,
+        UnitConversionCollector::FROM_BYTES_TO_MBIT,
+        UnitConversionCollector::FROM_SECONDS_TO_MS,
+        UnitConversionCollector::FROM_LINEAR_TO_DB};
+    for (const UnitConversionCollector::ConversionType_t conversionType : conversionTypes)
+    {
+        AddTestCase(new DeferLinearConversionTestCase(conversionType), TestCase::Duration::QUICK);
+    }
+
+} // end of `UnitConversionCollectorTestSuite ()`
+
+static UnitConversionCollectorTestSuite g_unitConversionCollectorTestSuiteInstance;
+
+} // end of namespace ns3